@@ -11,9 +11,7 @@
 #include <driver/ledc.h>
 #include <ESPmDNS.h>
 #include <ArduinoOTA.h>
-#include <deque>
 #include <time.h>
-#include <WebSocketsServer.h> // Added for WebSockets
 
 // Include all our module headers
 #include "config.h"
@@ -22,14 +20,32 @@
 #include "led_controller.h"
 #include "light_controller.h"
 #include "ota_handler.h"
+#include "status_cache.h"
+#include "ws_broadcaster.h"
+#include "sse_broadcaster.h"
+#include "history_store.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "boot_timing.h"
+#include "state_store.h"
+#include "rules.h"
+#include "scheduler.h"
+#include "mqtt_history.h"
+#include "heap_guard.h"
+#include "json_pool.h"
+#include "printer_commands.h"
+#include "mqtt_bridge.h"
+#include "logger.h"
 // #include "utils.h" // This file is obsolete
 
 // Global instances
-WebServer server(80);
+GuardedWebServer server(80);
 WiFiManager wm;
 WiFiClientSecure espClient;
 PubSubClient client(espClient);
+#if ENABLE_WEBSOCKET
 WebSocketsServer webSocket = WebSocketsServer(81); // Added for WebSockets
+#endif
 
 // Global state variables
 String current_light_mode = "UNKNOWN";
@@ -46,15 +62,14 @@ int current_time_remaining = 0;
 int current_layer = 0;
 int current_stage = -1;
 String current_wifi_signal = "N/A";
+char wifi_ssid[33] = "";
 unsigned long finishTime = 0;
+bool printer_state_stale = false; // Restored from a checkpoint, no live report yet
 const unsigned long FINISH_LIGHT_TIMEOUT = 120000;
 String mqtt_topic_status;
+String mqtt_topic_request;
 
-// Added for LED Animations
-unsigned long lastAnimationUpdate = 0;
-
-// Non-blocking reconnect timer
-unsigned long lastReconnectAttempt = 0;
+// Non-blocking reconnect backoff (TIMER_MQTT_RECONNECT)
 const unsigned long RECONNECT_INTERVAL = 5000;
 
 // File upload state
@@ -62,60 +77,100 @@ File restoreFile;
 bool restoreSuccess = false;
 
 // --- WebSocket Event Handler ---
+#if ENABLE_WEBSOCKET
 void onWebSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length) {
   switch (type) {
     case WStype_DISCONNECTED:
-      Serial.printf("[%u] WebSocket Disconnected!\n", num);
+      LOG_INFO("[%u] WebSocket Disconnected!", num);
+      wsClientDisconnected(num);
       break;
     case WStype_CONNECTED: {
       IPAddress ip = webSocket.remoteIP(num);
-      Serial.printf("[%u] WebSocket Connected from %d.%d.%d.%d\n", num, ip[0], ip[1], ip[2], ip[3]);
+      LOG_INFO("[%u] WebSocket Connected from %d.%d.%d.%d", num, ip[0], ip[1], ip[2], ip[3]);
       
       // When a new client connects, immediately send them the *current* status
-      DynamicJsonDocument doc(1024);
-      createStatusJson(doc); 
-      String json_output;
-      serializeJson(doc, json_output);
-      webSocket.sendTXT(num, json_output);
+      wsClientConnected(num);
       break;
     }
     case WStype_TEXT:
-      Serial.printf("[%u] got text: %s\n", num, payload);
+      LOG_DEBUG("[%u] got text: %s", num, (char*)payload);
       // Handle light control commands from WebSocket
       if (strcmp((char*)payload, "LIGHT_ON") == 0) {
-        Serial.println("WebSocket received LIGHT_ON command");
+        LOG_INFO("WebSocket received LIGHT_ON command");
         handleLightOn(); // Reuse existing handler
         broadcastWebSocketStatus(); // Push update back
       } else if (strcmp((char*)payload, "LIGHT_OFF") == 0) {
-        Serial.println("WebSocket received LIGHT_OFF command");
+        LOG_INFO("WebSocket received LIGHT_OFF command");
         handleLightOff();
         broadcastWebSocketStatus(); // Push update back
       } else if (strcmp((char*)payload, "LIGHT_AUTO") == 0) {
-        Serial.println("WebSocket received LIGHT_AUTO command");
+        LOG_INFO("WebSocket received LIGHT_AUTO command");
         handleLightAuto();
         broadcastWebSocketStatus(); // Push update back
+      } else if (strncmp((char*)payload, "CMD:", 4) == 0) {
+        // Printer command; the outcome reaches clients in the status JSON
+        if (!queuePrinterCommandText((char*)payload + 4)) {
+          LOG_WARN("[%u] printer command rejected: %s", num, (char*)payload + 4);
+        }
+      } else if (strcmp((char*)payload, "PROTO:BIN") == 0) {
+        wsSetClientBinary(num, true);
+      } else if (strcmp((char*)payload, "PROTO:JSON") == 0) {
+        wsSetClientBinary(num, false);
       }
       break;
+    default:
+      // Binary messages, fragments and pings carry nothing for us
+      break;
   }
 }
+#endif
+
+// --- Periodic timers ---
+// Record temperatures / progress once a second
+static void historyTimer() {
+  PROFILE_SCOPE(PROF_HISTORY);
+  historyTick();
+  bootMarkFlush(); // Phases reached on other tasks, e.g. the SNTP sync
+}
+
+// Checkpoint printer state for the next boot
+static void stateCheckpointTimer() {
+  PROFILE_SCOPE(PROF_STATE_CHECKPOINT);
+  stateCheckpointTick();
+}
 
 void setup() {
   Serial.begin(115200);
   delay(100);
+  setupLog(); // First, so every module can log
   Serial.println("\n\nBooting Bambu Light Controller...");
+  bootMark(BOOT_SETUP_START);
   yield();
   // Check for factory reset
   bool forceReset = checkFactoryReset();
+
+  // Start associating with the saved network straight away; the rest of
+  // setup runs while the radio connects
+  if (!forceReset) {
+    Serial.println("Setting WiFi Tx Power to 11dBm to reduce current spike...");
+    WiFi.mode(WIFI_STA);
+    WiFi.setTxPower(WIFI_POWER_11dBm);
+    WiFi.begin();
+  }
+
   // Initialize file system
   if (!initFileSystem()) {
     Serial.println("LITTLEFS MOUNT FAILED! Restarting...");
     delay(2000);
     ESP.restart();
   }
+  bootMark(BOOT_FS_MOUNTED);
 
   // --- FIX for Highlighted Log ---
   // Add initial boot message to log using the new struct
-  mqtt_history.push_back({getTimestamp() + " System Booted. Initializing...", true});
+  setupMqttHistory();
+  setupJsonPool(); // Before loadConfig(), which may import a config.json
+  mqttHistoryPrintf(true, "System Booted. Initializing...");
   // --- END FIX ---
   
   // Handle factory reset
@@ -132,41 +187,33 @@ void setup() {
   // Apply temporary fixes for invalid config
   applyConfigFixes();
 
+  // Compile user rules into their decision table
+  loadRules();
+
   // Print loaded config
   printConfig();
+  bootMark(BOOT_CONFIG_LOADED);
   // Initialize hardware
   initChamberLight();
   initLEDStrip();
+  // Show the last known state until the printer reports in
+  restorePrinterState();
+  bootMark(BOOT_HARDWARE_READY);
 
   // Setup WiFiManager parameters
   setupWiFiManagerParams();
-  // Set lower WiFi power
-  Serial.println("Setting WiFi Tx Power to 11dBm to reduce current spike...");
-  WiFi.setTxPower(WIFI_POWER_11dBm);
-  // Connect to WiFi
-  if (!connectWiFi(forceReset)) {
-    Serial.println("Failed to connect via portal and timed out. Restarting...");
-    delay(3000);
-    ESP.restart();
-    delay(5000);
-  }
 
-  Serial.println("Connected to WiFi!");
-  Serial.print("Connected to SSID: ");
-  Serial.println(WiFi.SSID());
-  Serial.print("IP Address: ");
-  Serial.println(WiFi.localIP());
-  yield();
-  // Configure time
+  // Configure time (SNTP syncs in the background once Wi-Fi is up)
   configureTime();
 
-  // Re-initialize pins if changed in portal
-  reinitHardwareIfNeeded();
-
-  // Setup OTA
-  setupOTA();
   // Setup MQTT
   setupMQTT();
+  setupMqttBridge(); // Connects from loop() once Wi-Fi is up
+
+  // Temperature / progress history (one fixed allocation)
+  setupHistory();
+  timerStart(TIMER_HISTORY, 1000, historyTimer, 1000);
+  timerStart(TIMER_STATE_CHECKPOINT, STATE_CHECKPOINT_INTERVAL_MS, stateCheckpointTimer, STATE_CHECKPOINT_INTERVAL_MS);
 
   // Setup web server
   setupWebServer();
@@ -188,25 +235,96 @@ void setup() {
   });
 
   // --- Added for WebSockets ---
+#if ENABLE_WEBSOCKET
   webSocket.begin();
   webSocket.onEvent(onWebSocketEvent);
+#endif
+  bootMark(BOOT_WEB_SERVER_READY);
+
+  // Wait for the early association; fall back to the WiFiManager portal
+  // (which needs port 80 to itself) if it fails or a reset was requested
+  if (forceReset || WiFi.waitForConnectResult(EARLY_WIFI_TIMEOUT_MS) != WL_CONNECTED) {
+    server.stop();
+    WiFi.setTxPower(WIFI_POWER_11dBm);
+    if (!connectWiFi(forceReset)) {
+      Serial.println("Failed to connect via portal and timed out. Restarting...");
+      delay(3000);
+      ESP.restart();
+      delay(5000);
+    }
+    server.begin();
+  }
+  bootMark(BOOT_WIFI_CONNECTED);
+
+  Serial.println("Connected to WiFi!");
+  strlcpy(wifi_ssid, WiFi.SSID().c_str(), sizeof(wifi_ssid));
+  Serial.print("Connected to SSID: ");
+  Serial.println(wifi_ssid);
+  Serial.print("Status page available at http://");
+  Serial.println(WiFi.localIP());
+  yield();
+
+  // Re-initialize pins if changed in portal
+  reinitHardwareIfNeeded();
 
+  // Setup OTA
+  setupOTA();
+
+  bootMark(BOOT_SETUP_DONE);
   Serial.println("--- Setup Complete ---");
+  HEAP_GUARD_ARM(); // Last: loop() must not allocate from here on
 }
 
 void loop() {
+  // Loop latency histogram and MQTT message rate for /metrics
+  metricsLoopTick();
+  PROFILE_LOOP_BEGIN();
+
   // Handle OTA updates
-  ArduinoOTA.handle();
+  {
+    PROFILE_SCOPE(PROF_OTA);
+    HEAP_GUARD_EXEMPT();
+    ArduinoOTA.handle();
+  }
 
   // Handle web client requests
-  server.handleClient();
+  {
+    PROFILE_SCOPE(PROF_HTTP);
+    HEAP_GUARD_EXEMPT(); // Request parsing; GuardedWebServer re-arms the guard in handlers
+    server.handleClient();
+  }
   
   // --- Added for WebSockets ---
-  webSocket.loop(); 
+#if ENABLE_WEBSOCKET
+  {
+    PROFILE_SCOPE(PROF_WEBSOCKET);
+    {
+      HEAP_GUARD_EXEMPT();
+      webSocket.loop();
+    }
+    serviceWebSocketClients(); // Rate-limited, latest-value-wins status push
+  }
+#endif
+  {
+    PROFILE_SCOPE(PROF_SSE);
+    serviceSseClients();
+  }
   
-  // Handle MQTT connection
-  handleMQTTConnection();
+  // Printer MQTT connection, then the home-automation bridge
+  {
+    PROFILE_SCOPE(PROF_MQTT);
+    handleMQTTConnection();
+    serviceMqttBridge();
+  }
+
+  // Finish timeout, LED animation frames, history and checkpoints
+  uint32_t nextDeadline;
+  {
+    PROFILE_SCOPE(PROF_TIMERS);
+    nextDeadline = timerRunDue();
+  }
+
+  PROFILE_LOOP_END();
 
-  // Handle finish timers
-  handleFinishTimers();
+  loopIdle(nextDeadline);
 }
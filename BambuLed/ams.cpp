@@ -0,0 +1,215 @@
+#include "ams.h"
+#include "status_cache.h"
+#include "logger.h"
+
+struct AmsModel {
+  AmsUnit units[AMS_MAX_UNITS];
+  uint8_t tray_now;
+  uint32_t version;
+};
+
+static AmsModel model = { {}, AMS_TRAY_NONE, 0 };
+static AmsStats stats = {};
+static uint32_t parsed_hash = 0;
+static uint32_t pending_hash = 0;
+
+// --- Raw section hash ---
+
+static inline bool isJsonSpace(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Finds "ams": {...} and returns the FNV-1a hash of the object's bytes. The
+// nested "ams": [...] array is skipped because it is not an object.
+static bool hashAmsSection(const uint8_t* p, unsigned int n, uint32_t* hash) {
+  static const char KEY[] = "\"ams\"";
+  const unsigned int KEY_LEN = sizeof(KEY) - 1;
+  for (unsigned int i = 0; i + KEY_LEN < n; i++) {
+    const uint8_t* quote = (const uint8_t*)memchr(p + i, '"', n - i);
+    if (!quote) return false;
+    i = quote - p;
+    if (i + KEY_LEN >= n || memcmp(p + i, KEY, KEY_LEN) != 0 || (i > 0 && p[i - 1] == '\\')) continue;
+    unsigned int j = i + KEY_LEN;
+    while (j < n && isJsonSpace(p[j])) j++;
+    if (j >= n || p[j] != ':') continue;
+    j++;
+    while (j < n && isJsonSpace(p[j])) j++;
+    if (j >= n || p[j] != '{') continue;
+
+    uint32_t h = 2166136261u;
+    int depth = 0;
+    bool in_string = false;
+    for (unsigned int k = j; k < n; k++) {
+      uint8_t c = p[k];
+      h = (h ^ c) * 16777619u;
+      if (in_string) {
+        if (c == '\\' && k + 1 < n) {
+          k++;
+          h = (h ^ p[k]) * 16777619u;
+        } else if (c == '"') {
+          in_string = false;
+        }
+      } else if (c == '"') {
+        in_string = true;
+      } else if (c == '{' || c == '[') {
+        depth++;
+      } else if ((c == '}' || c == ']') && --depth == 0) {
+        *hash = h;
+        return true;
+      }
+    }
+    return false; // Cut off; the parser will reject the report
+  }
+  return false;
+}
+
+bool amsSectionChanged(const uint8_t* payload, unsigned int length) {
+  uint32_t start = micros();
+  uint32_t hash;
+  bool found = hashAmsSection(payload, length, &hash);
+  if (!found) return false;
+  stats.scans++;
+  stats.last_scan_us = micros() - start;
+  if (hash == parsed_hash) {
+    stats.skips++;
+    return false;
+  }
+  pending_hash = hash;
+  return true;
+}
+
+// --- Parsing ---
+
+// The printer sends most numbers as strings ("4", "24.5")
+static int jsonInt(JsonVariant v, int fallback) {
+  if (v.is<const char*>()) return atoi(v.as<const char*>());
+  return v.is<int>() ? v.as<int>() : fallback;
+}
+
+static float jsonFloat(JsonVariant v, float fallback) {
+  if (v.is<const char*>()) return atof(v.as<const char*>());
+  return v.is<float>() ? v.as<float>() : fallback;
+}
+
+// Fixed, zero-padded fields, so two models compare with memcmp()
+static void copyField(char* dst, size_t size, const char* src) {
+  strncpy(dst, src ? src : "", size - 1);
+  dst[size - 1] = '\0';
+}
+
+static void clearTray(AmsTray& tray) {
+  memset(&tray, 0, sizeof(tray));
+  tray.remain = -1;
+}
+
+// Merges the fields the report carries; a report may bring only "remain".
+// An empty "tray_type" means the slot was emptied.
+static void parseTray(AmsTray& tray, JsonObject obj) {
+  if (obj.containsKey("tray_type")) {
+    const char* type = obj["tray_type"] | "";
+    if (!type[0]) {
+      clearTray(tray);
+      return;
+    }
+    tray.loaded = true;
+    copyField(tray.type, sizeof(tray.type), type);
+  }
+  const char* color = obj["tray_color"];
+  if (color) {
+    copyField(tray.color_hex, sizeof(tray.color_hex), color); // RRGGBBAA: alpha dropped
+    tray.color = strtoul(tray.color_hex, NULL, 16);
+  }
+  if (obj.containsKey("remain")) tray.remain = constrain(jsonInt(obj["remain"], -1), -1, 100);
+}
+
+bool parseAms(JsonObject ams) {
+  uint32_t start = micros();
+  AmsModel before;
+  memcpy(&before, &model, sizeof(model));
+
+  int seen = 0;
+  for (JsonObject unitObj : ams["ams"].as<JsonArray>()) {
+    if (++seen > MQTT_MAX_ARRAY_NODES) break;
+    int id = jsonInt(unitObj["id"], -1);
+    if (id < 0 || id >= AMS_MAX_UNITS) continue;
+    AmsUnit& unit = model.units[id];
+    if (!unit.present) {
+      unit.humidity = -1;
+      for (AmsTray& tray : unit.trays) clearTray(tray);
+    }
+    unit.present = true;
+    unit.humidity = constrain(jsonInt(unitObj["humidity"], unit.humidity), -1, 5);
+    unit.temp = jsonFloat(unitObj["temp"], unit.temp);
+    int traysSeen = 0;
+    for (JsonObject trayObj : unitObj["tray"].as<JsonArray>()) {
+      if (++traysSeen > MQTT_MAX_ARRAY_NODES) break;
+      int tray = jsonInt(trayObj["id"], -1);
+      if (tray >= 0 && tray < AMS_TRAYS_PER_UNIT) parseTray(unit.trays[tray], trayObj);
+    }
+  }
+
+  // Hex bitmask of connected units; a unit that went away is cleared
+  const char* existBits = ams["ams_exist_bits"];
+  if (existBits) {
+    uint32_t bits = strtoul(existBits, NULL, 16);
+    for (uint8_t i = 0; i < AMS_MAX_UNITS; i++) {
+      if (!(bits & (1u << i))) memset(&model.units[i], 0, sizeof(AmsUnit));
+    }
+  }
+  // Hex bitmask of filled slots, numbered across units. Empty slots are often
+  // listed with their id only, which a partial report cannot be told from.
+  const char* trayBits = ams["tray_exist_bits"];
+  if (trayBits) {
+    uint32_t bits = strtoul(trayBits, NULL, 16);
+    for (uint8_t i = 0; i < AMS_TRAY_COUNT; i++) {
+      if (!(bits & (1u << i))) clearTray(model.units[i / AMS_TRAYS_PER_UNIT].trays[i % AMS_TRAYS_PER_UNIT]);
+    }
+  }
+
+  if (ams.containsKey("tray_now")) {
+    int trayNow = jsonInt(ams["tray_now"], AMS_TRAY_NONE);
+    model.tray_now = (trayNow >= 0 && trayNow < AMS_TRAY_COUNT) || trayNow == AMS_TRAY_EXTERNAL ? trayNow : AMS_TRAY_NONE;
+  }
+  model.version = ams["version"] | model.version;
+
+  parsed_hash = pending_hash;
+  stats.parses++;
+  stats.last_parse_us = micros() - start;
+
+  if (memcmp(&before, &model, sizeof(model)) == 0) return false;
+  LOG_DEBUG("AMS section %u parsed, active tray %u.", (unsigned)model.version, model.tray_now);
+  markStatusDetailsChanged();
+  return true;
+}
+
+// --- Accessors ---
+
+const AmsUnit& amsUnit(uint8_t unit) {
+  return model.units[unit];
+}
+
+const AmsTray& amsTray(uint8_t tray) {
+  return model.units[tray / AMS_TRAYS_PER_UNIT].trays[tray % AMS_TRAYS_PER_UNIT];
+}
+
+uint8_t amsTrayNow() {
+  return model.tray_now;
+}
+
+uint32_t amsVersion() {
+  return model.version;
+}
+
+uint8_t amsLoadedTrays(uint8_t* out) {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < AMS_TRAY_COUNT; i++) {
+    if (!model.units[i / AMS_TRAYS_PER_UNIT].present || !amsTray(i).loaded) continue;
+    if (out) out[count] = i;
+    count++;
+  }
+  return count;
+}
+
+const AmsStats& getAmsStats() {
+  return stats;
+}
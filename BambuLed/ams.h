@@ -0,0 +1,67 @@
+#ifndef AMS_H
+#define AMS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "config.h"
+
+// AMS units and their trays, from the "ams" section of printer reports:
+//
+//   "ams": {"ams": [{"id": "0", "humidity": "4", "temp": "24.5",
+//                    "tray": [{"id": "0", "tray_color": "FF6A13FF", "tray_type": "PLA", "remain": 80}, ...]}],
+//           "ams_exist_bits": "1", "tray_exist_bits": "f", "tray_now": "2", "version": 187, ...}
+//
+// Most reports repeat the section unchanged. mqttCallback() hashes its raw
+// bytes before parsing (amsSectionChanged()). Only when the hash differs from
+// the last parsed section is the section let through the JSON filter and
+// parsed here, so an unchanged section costs one pass over its bytes. The
+// hash covers the "version" counter and the fields it does not count, such
+// as humidity.
+//
+// A report may carry only some units, trays or fields; whatever it leaves out
+// keeps its state. A slot is emptied by an empty "tray_type" or a cleared bit
+// in "tray_exist_bits". Trays are numbered across units: unit * AMS_TRAYS_PER_UNIT + tray.
+
+const uint8_t AMS_TRAY_COUNT = AMS_MAX_UNITS * AMS_TRAYS_PER_UNIT;
+const uint8_t AMS_TRAY_EXTERNAL = 254; // tray_now: spool on the external holder
+const uint8_t AMS_TRAY_NONE = 255;     // tray_now: nothing loaded
+
+struct AmsTray {
+  bool loaded;
+  int8_t remain;   // Percent, -1 when the printer does not know
+  uint32_t color;  // 0xRRGGBB
+  char color_hex[7];
+  char type[AMS_TRAY_TYPE_MAX + 1];
+};
+
+struct AmsUnit {
+  bool present;
+  int8_t humidity; // Printer's 1 (wet) .. 5 (dry) scale, -1 unknown
+  float temp;
+  AmsTray trays[AMS_TRAYS_PER_UNIT];
+};
+
+struct AmsStats {
+  uint32_t scans;         // Reports with an AMS section
+  uint32_t skips;         // ...that were unchanged and not parsed
+  uint32_t parses;
+  uint32_t last_scan_us;  // Hashing the raw section
+  uint32_t last_parse_us;
+};
+
+// Hashes the AMS section of a raw report. True if there is one and it
+// differs from the last section parseAms() accepted.
+bool amsSectionChanged(const uint8_t* payload, unsigned int length);
+// Updates the model from a filtered "ams" object. Returns true, and marks
+// the status details changed, if anything shown changed.
+bool parseAms(JsonObject ams);
+
+const AmsUnit& amsUnit(uint8_t unit);
+const AmsTray& amsTray(uint8_t tray);
+uint8_t amsTrayNow(); // Tray index, AMS_TRAY_EXTERNAL or AMS_TRAY_NONE
+uint32_t amsVersion();
+uint8_t amsLoadedTrays(uint8_t* out); // Indexes of loaded trays, in order; out may be nullptr
+
+const AmsStats& getAmsStats();
+
+#endif
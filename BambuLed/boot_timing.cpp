@@ -0,0 +1,43 @@
+#include "boot_timing.h"
+#include "status_cache.h"
+#include <atomic>
+
+static const char* const PHASE_NAMES[BOOT_PHASE_COUNT] = {
+  "setup_start", "fs_mounted", "config_loaded", "hardware_ready", "web_server_ready",
+  "wifi_connected", "setup_done", "time_synced", "mqtt_connected", "first_report"
+};
+
+static uint32_t marks[BOOT_PHASE_COUNT];
+static std::atomic<uint32_t> pending[BOOT_PHASE_COUNT]; // Set by other tasks
+
+static void record(BootPhase phase, uint32_t ms) {
+  if (phase >= BOOT_PHASE_COUNT || marks[phase]) return;
+  marks[phase] = max(ms, (uint32_t)1);
+  Serial.printf("Boot: %s at %u ms\n", PHASE_NAMES[phase], (unsigned)marks[phase]);
+  markStatusChanged(); // Boot timings are part of the status JSON
+}
+
+void bootMark(BootPhase phase) {
+  record(phase, millis());
+}
+
+void bootMarkFromTask(BootPhase phase) {
+  if (phase >= BOOT_PHASE_COUNT) return;
+  uint32_t expected = 0;
+  pending[phase].compare_exchange_strong(expected, max(millis(), 1UL));
+}
+
+void bootMarkFlush() {
+  for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+    uint32_t ms = pending[i].load(std::memory_order_relaxed);
+    if (ms) record((BootPhase)i, ms);
+  }
+}
+
+uint32_t bootMarkMs(BootPhase phase) {
+  return phase < BOOT_PHASE_COUNT ? marks[phase] : 0;
+}
+
+const char* bootPhaseName(BootPhase phase) {
+  return phase < BOOT_PHASE_COUNT ? PHASE_NAMES[phase] : "";
+}
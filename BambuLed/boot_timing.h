@@ -0,0 +1,36 @@
+#ifndef BOOT_TIMING_H
+#define BOOT_TIMING_H
+
+#include <Arduino.h>
+
+// Milliseconds since power-on at which each startup phase completed. Phases
+// after BOOT_SETUP_DONE happen in the background (loop, SNTP) and may come in
+// any order; a phase that has not been reached yet reads as 0.
+
+enum BootPhase : uint8_t {
+  BOOT_SETUP_START = 0,
+  BOOT_FS_MOUNTED,
+  BOOT_CONFIG_LOADED,
+  BOOT_HARDWARE_READY,   // Light PWM and LED strip
+  BOOT_WEB_SERVER_READY,
+  BOOT_WIFI_CONNECTED,
+  BOOT_SETUP_DONE,
+  BOOT_TIME_SYNCED,
+  BOOT_MQTT_CONNECTED,
+  BOOT_FIRST_REPORT,     // Target: first printer report parsed
+  BOOT_PHASE_COUNT
+};
+
+// How long setup() lets the early Wi-Fi association run before falling back
+// to the WiFiManager portal
+const uint32_t EARLY_WIFI_TIMEOUT_MS = 15000;
+
+void bootMark(BootPhase phase); // Loop task only; only the first call per phase counts
+// For callbacks on other tasks (SNTP runs on the lwIP task): only stores the
+// time. bootMarkFlush(), from the loop task, records it like bootMark().
+void bootMarkFromTask(BootPhase phase);
+void bootMarkFlush();
+uint32_t bootMarkMs(BootPhase phase);
+const char* bootPhaseName(BootPhase phase);
+
+#endif
@@ -0,0 +1,109 @@
+#include "chunked_response.h"
+#include "metrics.h"
+#include "heap_guard.h"
+#include <stdarg.h>
+#include <assert.h>
+
+void ChunkedResponse::begin(int code, const char* contentType) {
+  _len = 0;
+  HEAP_GUARD_EXEMPT(); // Header String and socket write
+  _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  _server.send(code, contentType, "");
+}
+
+void ChunkedResponse::write(const char* data, size_t len) {
+  while (len > 0) {
+    size_t n = sizeof(_buf) - _len;
+    if (n > len) n = len;
+    memcpy(_buf + _len, data, n);
+    _len += n;
+    data += n;
+    len -= n;
+    if (_len == sizeof(_buf)) flush();
+  }
+}
+
+// Formats straight into the chunk buffer: measured first, then written where
+// it fits whole, after a flush if need be. Output that cannot fit even an
+// empty buffer is dropped and counted rather than cut mid-line.
+void ChunkedResponse::printf(const char* format, ...) {
+  va_list args, measure;
+  va_start(args, format);
+  va_copy(measure, args);
+  int n = vsnprintf(NULL, 0, format, measure);
+  va_end(measure);
+  if (n > 0 && (size_t)n >= sizeof(_buf)) {
+    metricsCount(metrics.chunked_printf_overflows);
+#ifdef BAMBULED_HOST
+    assert(!"ChunkedResponse::printf output longer than the chunk buffer");
+#endif
+    n = 0;
+  }
+  if (n > 0) {
+    if ((size_t)n >= sizeof(_buf) - _len) flush();
+    // vsnprintf writes n + 1 bytes; the terminator lands in the free space
+    vsnprintf(_buf + _len, sizeof(_buf) - _len, format, args);
+    _len += n;
+  }
+  va_end(args);
+}
+
+void ChunkedResponse::printJsonString(const char* str) {
+  write("\"", 1);
+  const char* run = str;
+  for (const char* p = str; *p; p++) {
+    unsigned char c = (unsigned char)*p;
+    if (c != '"' && c != '\\' && c >= 0x20) continue;
+
+    // Flush the plain run before the character that needs escaping
+    write(run, p - run);
+    run = p + 1;
+    switch (c) {
+      case '"':  write("\\\"", 2); break;
+      case '\\': write("\\\\", 2); break;
+      case '\n': write("\\n", 2); break;
+      case '\r': write("\\r", 2); break;
+      case '\t': write("\\t", 2); break;
+      default: {
+        char esc[7];
+        snprintf(esc, sizeof(esc), "\\u%04x", c);
+        write(esc, 6);
+        break;
+      }
+    }
+  }
+  write(run, strlen(run));
+  write("\"", 1);
+}
+
+void ChunkedResponse::printHtml(const char* str) {
+  const char* run = str;
+  for (const char* p = str; *p; p++) {
+    const char* entity;
+    switch (*p) {
+      case '<':  entity = "&lt;"; break;
+      case '>':  entity = "&gt;"; break;
+      case '&':  entity = "&amp;"; break;
+      case '\'': entity = "&#39;"; break;
+      case '"':  entity = "&quot;"; break;
+      default: continue;
+    }
+    write(run, p - run);
+    print(entity);
+    run = p + 1;
+  }
+  write(run, strlen(run));
+}
+
+void ChunkedResponse::flush() {
+  if (_len == 0) return;
+  HEAP_GUARD_EXEMPT(); // lwIP queues the segment
+  _server.sendContent(_buf, _len);
+  _len = 0;
+}
+
+void ChunkedResponse::end() {
+  flush();
+  HEAP_GUARD_EXEMPT();
+  _server.sendContent(""); // Terminating zero-length chunk
+}
@@ -0,0 +1,36 @@
+#ifndef CHUNKED_RESPONSE_H
+#define CHUNKED_RESPONSE_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// Streams a chunked HTTP response through a small fixed buffer, so handlers
+// can emit arbitrarily large bodies without building one big String. Only
+// the socket writes allocate, and they are exempt from the heap guard.
+class ChunkedResponse {
+public:
+  explicit ChunkedResponse(WebServer& server) : _server(server) {}
+
+  void begin(int code, const char* contentType);
+  void write(const char* data, size_t len);
+  void print(const char* str) { write(str, strlen(str)); }
+  // Up to sizeof(_buf) - 1 bytes per call; longer output is dropped whole and
+  // counted in bambuled_chunked_printf_overflows_total
+  void printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  void printJsonString(const char* str); // Quoted and escaped
+  void printHtml(const char* str);       // Escaped for HTML text and attribute values
+  void end();
+
+  // ArduinoJson writer interface, for serializeJson(doc, response)
+  size_t write(uint8_t c) { write((const char*)&c, 1); return 1; }
+  size_t write(const uint8_t* data, size_t len) { write((const char*)data, len); return len; }
+
+private:
+  void flush();
+
+  WebServer& _server;
+  char _buf[512];
+  size_t _len = 0;
+};
+
+#endif
@@ -1,5 +1,18 @@
 #include "config.h"
+#include "config_store.h"
 #include <WiFiManager.h>
+#include "mqtt_handler.h"
+#include "light_controller.h"
+#include "led_controller.h"
+#include "status_cache.h"
+#include "boot_timing.h"
+#include "state_store.h"
+#include "rules.h"
+#include "mqtt_bridge.h"
+#include "scheduler.h"
+#include "json_pool.h"
+#include "chunked_response.h"
+#include <esp_sntp.h>
 
 // --- Global Config Instance Definition ---
 Config config;
@@ -73,21 +86,124 @@ bool initFileSystem() {
 
 void performFactoryReset() {
   Serial.println("Factory reset triggered!");
-  Serial.println("Erasing /config.json...");
-  if (LittleFS.remove("/config.json")) {
-    Serial.println("Config file erased.");
-  } else {
-    Serial.println("Config file not found or erase failed.");
-  }
+  Serial.println("Erasing stored config...");
+  eraseConfigBlobs();
+  if (LittleFS.exists(CONFIG_JSON_PATH)) LittleFS.remove(CONFIG_JSON_PATH);
+  eraseStateCheckpoint();
+  Serial.println("Config erased.");
 }
 
-bool loadConfig() {
-  if(!LittleFS.exists("/config.json")) {
-      Serial.println("Config file not found.");
-      return false;
+uint32_t config_load_us = 0;
+uint32_t config_save_us = 0;
+
+// --- JSON interchange (backup/restore and files from older firmware) ---
+
+void configToJson(const Config& c, JsonDocument& doc) {
+  doc["bbl_ip"] = c.bbl_ip;
+  doc["bbl_serial"] = c.bbl_serial;
+  doc["bbl_access_code"] = c.bbl_access_code;
+  doc["invert_output"] = c.invert_output;
+  doc["chamber_light_pin"] = c.chamber_light_pin;
+  doc["chamber_pwm_brightness"] = c.chamber_pwm_brightness;
+  doc["chamber_light_finish_timeout"] = c.chamber_light_finish_timeout;
+
+  doc["num_leds"] = c.num_leds;
+  doc["led_color_order"] = c.led_color_order;
+  doc["led_color_idle"] = c.led_color_idle;
+  doc["led_color_print"] = c.led_color_print;
+  doc["led_color_pause"] = c.led_color_pause;
+  doc["led_color_error"] = c.led_color_error;
+  doc["led_color_finish"] = c.led_color_finish;
+  doc["led_bright_idle"] = c.led_bright_idle;
+  doc["led_bright_print"] = c.led_bright_print;
+  doc["led_bright_pause"] = c.led_bright_pause;
+  doc["led_bright_error"] = c.led_bright_error;
+  doc["led_bright_finish"] = c.led_bright_finish;
+  doc["led_finish_timeout"] = c.led_finish_timeout;
+  
+  doc["ntp_server"] = c.ntp_server;
+  doc["timezone"] = c.timezone;
+  doc["ws_max_rate_hz"] = c.ws_max_rate_hz;
+  doc["rules"] = c.rules;
+
+  doc["bridge_host"] = c.bridge_host;
+  doc["bridge_port"] = c.bridge_port;
+  doc["bridge_user"] = c.bridge_user;
+  doc["bridge_pass"] = c.bridge_pass;
+  doc["bridge_prefix"] = c.bridge_prefix;
+  doc["bridge_discovery"] = c.bridge_discovery;
+  doc["bridge_max_rate_hz"] = c.bridge_max_rate_hz;
+  doc["bridge_temp_deadband"] = c.bridge_temp_deadband;
+  doc["ams_leds"] = c.ams_leds;
+  doc["printer_control"] = c.printer_control;
+}
+
+// Fields missing from the document keep their value in `out`
+void configFromJson(JsonDocument& doc, Config& out) {
+  const Config base = out;
+  strlcpy(out.bbl_ip, doc["bbl_ip"] | base.bbl_ip, sizeof(out.bbl_ip));
+  strlcpy(out.bbl_serial, doc["bbl_serial"] | base.bbl_serial, sizeof(out.bbl_serial));
+  strlcpy(out.bbl_access_code, doc["bbl_access_code"] | base.bbl_access_code, sizeof(out.bbl_access_code));
+  out.invert_output = doc["invert_output"] | base.invert_output;
+  out.chamber_light_pin = doc["chamber_light_pin"] | base.chamber_light_pin;
+  out.chamber_pwm_brightness = doc["chamber_pwm_brightness"] | base.chamber_pwm_brightness;
+  out.chamber_light_finish_timeout = doc["chamber_light_finish_timeout"] | base.chamber_light_finish_timeout;
+
+  out.num_leds = doc["num_leds"] | base.num_leds;
+  strlcpy(out.led_color_order, doc["led_color_order"] | "GRB", sizeof(out.led_color_order));
+  out.led_color_idle = doc["led_color_idle"] | base.led_color_idle;
+  out.led_color_print = doc["led_color_print"] | base.led_color_print;
+  out.led_color_pause = doc["led_color_pause"] | base.led_color_pause;
+  out.led_color_error = doc["led_color_error"] | base.led_color_error;
+  out.led_color_finish = doc["led_color_finish"] | base.led_color_finish;
+  out.led_bright_idle = doc["led_bright_idle"] | base.led_bright_idle;
+  out.led_bright_print = doc["led_bright_print"] | base.led_bright_print;
+  out.led_bright_pause = doc["led_bright_pause"] | base.led_bright_pause;
+  out.led_bright_error = doc["led_bright_error"] | base.led_bright_error;
+  out.led_bright_finish = doc["led_bright_finish"] | base.led_bright_finish;
+  out.led_finish_timeout = doc["led_finish_timeout"] | base.led_finish_timeout;
+
+  strlcpy(out.ntp_server, doc["ntp_server"] | "pool.ntp.org", sizeof(out.ntp_server));
+  strlcpy(out.timezone, doc["timezone"] | "GMT0BST,M3.5.0/1,M10.5.0", sizeof(out.timezone));
+  out.ws_max_rate_hz = constrain(doc["ws_max_rate_hz"] | base.ws_max_rate_hz, 1, MAX_WS_RATE_HZ);
+  strlcpy(out.rules, doc["rules"] | base.rules, sizeof(out.rules));
+
+  strlcpy(out.bridge_host, doc["bridge_host"] | base.bridge_host, sizeof(out.bridge_host));
+  out.bridge_port = doc["bridge_port"] | base.bridge_port;
+  strlcpy(out.bridge_user, doc["bridge_user"] | base.bridge_user, sizeof(out.bridge_user));
+  strlcpy(out.bridge_pass, doc["bridge_pass"] | base.bridge_pass, sizeof(out.bridge_pass));
+  strlcpy(out.bridge_prefix, doc["bridge_prefix"] | base.bridge_prefix, sizeof(out.bridge_prefix));
+  out.bridge_discovery = doc["bridge_discovery"] | base.bridge_discovery;
+  out.bridge_max_rate_hz = constrain(doc["bridge_max_rate_hz"] | (int)base.bridge_max_rate_hz, 1, MAX_BRIDGE_RATE_HZ);
+  out.bridge_temp_deadband = doc["bridge_temp_deadband"] | base.bridge_temp_deadband;
+  out.ams_leds = constrain(doc["ams_leds"] | (int)base.ams_leds, 0, MAX_LEDS);
+  out.printer_control = doc["printer_control"] | base.printer_control;
+}
+
+static void validateConfig(Config& c) {
+  if (!isValidGpioPin(c.chamber_light_pin)) {
+      Serial.printf("WARNING: Loaded invalid chamber light pin (%d). Using default (%d).\n", c.chamber_light_pin, DEFAULT_CHAMBER_LIGHT_PIN);
+      c.chamber_light_pin = DEFAULT_CHAMBER_LIGHT_PIN;
   }
+   if (c.num_leds < 0 || c.num_leds > MAX_LEDS) {
+       Serial.printf("WARNING: Loaded invalid number of LEDs (%d). Using default (%d).\n", c.num_leds, DEFAULT_NUM_LEDS);
+       c.num_leds = DEFAULT_NUM_LEDS;
+   }
+  c.ws_max_rate_hz = constrain(c.ws_max_rate_hz, 1, MAX_WS_RATE_HZ);
+  c.rules[RULES_TEXT_MAX - 1] = '\0';
+  c.bridge_host[sizeof(c.bridge_host) - 1] = '\0';
+  c.bridge_user[sizeof(c.bridge_user) - 1] = '\0';
+  c.bridge_pass[sizeof(c.bridge_pass) - 1] = '\0';
+  c.bridge_prefix[sizeof(c.bridge_prefix) - 1] = '\0';
+  if (!c.bridge_prefix[0]) strcpy(c.bridge_prefix, "bambuled");
+  if (c.bridge_port == 0) c.bridge_port = DEFAULT_BRIDGE_PORT;
+  c.bridge_max_rate_hz = constrain(c.bridge_max_rate_hz, 1, MAX_BRIDGE_RATE_HZ);
+  if (!(c.bridge_temp_deadband >= 0 && c.bridge_temp_deadband <= 50)) c.bridge_temp_deadband = DEFAULT_BRIDGE_DEADBAND;
+  if (c.ams_leds > MAX_LEDS) c.ams_leds = 0;
+}
 
-  File configFile = LittleFS.open("/config.json", "r");
+static bool importConfigJson() {
+  File configFile = LittleFS.open(CONFIG_JSON_PATH, "r");
   if (!configFile) {
     Serial.println("Failed to open config file for reading.");
     return false;
@@ -105,12 +221,8 @@ bool loadConfig() {
     return false;
   }
 
-  // --- FIX 1 ---
-  // Use the larger JSON_DOC_SIZE constant
-  DynamicJsonDocument doc(JSON_DOC_SIZE);
-  // --- END FIX ---
-  
-  DeserializationError error = deserializeJson(doc, configFile);
+  JsonLease doc;
+  DeserializationError error = deserializeJson(*doc, configFile);
   configFile.close();
 
   if (error) {
@@ -120,92 +232,50 @@ bool loadConfig() {
   }
 
   Config tempConfig = config;
+  configFromJson(*doc, tempConfig);
+  validateConfig(tempConfig);
+  config = tempConfig;
+  return true;
+}
 
-  strlcpy(tempConfig.bbl_ip, doc["bbl_ip"] | config.bbl_ip, sizeof(tempConfig.bbl_ip));
-  strlcpy(tempConfig.bbl_serial, doc["bbl_serial"] | config.bbl_serial, sizeof(tempConfig.bbl_serial));
-  strlcpy(tempConfig.bbl_access_code, doc["bbl_access_code"] | config.bbl_access_code, sizeof(tempConfig.bbl_access_code));
-  tempConfig.invert_output = doc["invert_output"] | config.invert_output;
-  tempConfig.chamber_light_pin = doc["chamber_light_pin"] | config.chamber_light_pin;
-  tempConfig.chamber_pwm_brightness = doc["chamber_pwm_brightness"] | config.chamber_pwm_brightness;
-  tempConfig.chamber_light_finish_timeout = doc["chamber_light_finish_timeout"] | config.chamber_light_finish_timeout;
-
-  tempConfig.num_leds = doc["num_leds"] | config.num_leds;
-  strlcpy(tempConfig.led_color_order, doc["led_color_order"] | "GRB", sizeof(tempConfig.led_color_order));
-  tempConfig.led_color_idle = doc["led_color_idle"] | config.led_color_idle;
-  tempConfig.led_color_print = doc["led_color_print"] | config.led_color_print;
-  tempConfig.led_color_pause = doc["led_color_pause"] | config.led_color_pause;
-  tempConfig.led_color_error = doc["led_color_error"] | config.led_color_error;
-  tempConfig.led_color_finish = doc["led_color_finish"] | config.led_color_finish;
-  tempConfig.led_bright_idle = doc["led_bright_idle"] | config.led_bright_idle;
-  tempConfig.led_bright_print = doc["led_bright_print"] | config.led_bright_print;
-  tempConfig.led_bright_pause = doc["led_bright_pause"] | config.led_bright_pause;
-  tempConfig.led_bright_error = doc["led_bright_error"] | config.led_bright_error;
-  tempConfig.led_bright_finish = doc["led_bright_finish"] | config.led_bright_finish;
-  tempConfig.led_finish_timeout = doc["led_finish_timeout"] | config.led_finish_timeout;
-
-  strlcpy(tempConfig.ntp_server, doc["ntp_server"] | "pool.ntp.org", sizeof(tempConfig.ntp_server));
-  strlcpy(tempConfig.timezone, doc["timezone"] | "GMT0BST,M3.5.0/1,M10.5.0", sizeof(tempConfig.timezone));
-
-  if (!isValidGpioPin(tempConfig.chamber_light_pin)) {
-      Serial.printf("WARNING: Loaded invalid chamber light pin (%d). Using default (%d).\n", tempConfig.chamber_light_pin, DEFAULT_CHAMBER_LIGHT_PIN);
-      tempConfig.chamber_light_pin = DEFAULT_CHAMBER_LIGHT_PIN;
+bool loadConfig() {
+  uint32_t start = micros();
+
+  // A config.json is either from firmware before the binary store or was
+  // just uploaded through /restore. Either way it replaces the stored config.
+  if (LittleFS.exists(CONFIG_JSON_PATH)) {
+    if (importConfigJson()) {
+      config_load_us = micros() - start;
+      Serial.printf("Imported %s in %u us.\n", CONFIG_JSON_PATH, (unsigned)config_load_us);
+      if (saveConfig()) {
+        LittleFS.remove(CONFIG_JSON_PATH);
+      }
+      return true;
+    }
+    Serial.println("Ignoring unreadable config.json.");
   }
-   if (tempConfig.num_leds < 0 || tempConfig.num_leds > MAX_LEDS) {
-       Serial.printf("WARNING: Loaded invalid number of LEDs (%d). Using default (%d).\n", tempConfig.num_leds, DEFAULT_NUM_LEDS);
-       tempConfig.num_leds = DEFAULT_NUM_LEDS;
-   }
 
-   config = tempConfig;
-   Serial.println("Configuration loaded successfully.");
-   return true;
+  Config tempConfig = config;
+  if (!loadConfigBlob(tempConfig)) {
+      Serial.println("Config file not found.");
+      return false;
+  }
+  validateConfig(tempConfig);
+  config = tempConfig;
+
+  config_load_us = micros() - start;
+  Serial.printf("Configuration loaded successfully (%u us).\n", (unsigned)config_load_us);
+  return true;
 }
 
 bool saveConfig() {
   Serial.println("Saving configuration to LittleFS...");
-  
-  // --- FIX 2 ---
-  // Use the larger JSON_DOC_SIZE constant
-  DynamicJsonDocument doc(JSON_DOC_SIZE);
-  // --- END FIX ---
-
-  doc["bbl_ip"] = config.bbl_ip;
-  doc["bbl_serial"] = config.bbl_serial;
-  doc["bbl_access_code"] = config.bbl_access_code;
-  doc["invert_output"] = config.invert_output;
-  doc["chamber_light_pin"] = config.chamber_light_pin;
-  doc["chamber_pwm_brightness"] = config.chamber_pwm_brightness;
-  doc["chamber_light_finish_timeout"] = config.chamber_light_finish_timeout;
-
-  doc["num_leds"] = config.num_leds;
-  doc["led_color_order"] = config.led_color_order;
-  doc["led_color_idle"] = config.led_color_idle;
-  doc["led_color_print"] = config.led_color_print;
-  doc["led_color_pause"] = config.led_color_pause;
-  doc["led_color_error"] = config.led_color_error;
-  doc["led_color_finish"] = config.led_color_finish;
-  doc["led_bright_idle"] = config.led_bright_idle;
-  doc["led_bright_print"] = config.led_bright_print;
-  doc["led_bright_pause"] = config.led_bright_pause;
-  doc["led_bright_error"] = config.led_bright_error;
-  doc["led_bright_finish"] = config.led_bright_finish;
-  doc["led_finish_timeout"] = config.led_finish_timeout;
-  
-  doc["ntp_server"] = config.ntp_server;
-  doc["timezone"] = config.timezone;
-
-  File configFile = LittleFS.open("/config.json", "w");
-  if (!configFile) {
-    Serial.println("Failed to open config file for writing");
+  uint32_t start = micros();
+  if (!saveConfigBlob(config)) {
     return false;
   }
-
-  if (serializeJson(doc, configFile) == 0) {
-      Serial.println("Failed to write to file");
-      configFile.close();
-      return false;
-  }
-  configFile.close();
-  Serial.println("Configuration saved successfully.");
+  config_save_us = micros() - start;
+  Serial.printf("Configuration saved successfully (%u us).\n", (unsigned)config_save_us);
   return true;
 }
 
@@ -353,95 +423,158 @@ bool isValidGpioPin(int pin) {
     return true;
 }
 
+// Runs on the lwIP task: the mark is recorded later, from the history timer
+static void onTimeSynced(struct timeval* tv) {
+  bootMarkFromTask(BOOT_TIME_SYNCED);
+}
+
+// Non-blocking: SNTP syncs in the background once Wi-Fi is up
 void configureTime() {
   Serial.println("Configuring time...");
+  sntp_set_time_sync_notification_cb(onTimeSynced);
   configTime(0, 0, config.ntp_server);
   setenv("TZ", config.timezone, 1);
   tzset();
   Serial.printf("Timezone set to: %s\n", config.timezone);
 }
 
-String getTimestamp() {
+// "[YYYY-MM-DD HH:MM:SS]" into buf; returns its length
+size_t formatTimestamp(char* buf, size_t size) {
   struct tm timeinfo;
-  if(!getLocalTime(&timeinfo)){
-    return "[--:--:--]";
+  // Zero wait: before the first SNTP sync this must not stall the caller
+  if(!getLocalTime(&timeinfo, 0)){
+    return strlcpy(buf, "[--:--:--]", size);
   }
+  return strftime(buf, size, "[%Y-%m-%d %H:%M:%S]", &timeinfo);
+}
+
+String getTimestamp() {
   char buffer[30];
-  strftime(buffer, sizeof(buffer), "[%Y-%m-%d %H:%M:%S]", &timeinfo);
+  formatTimestamp(buffer, sizeof(buffer));
   return String(buffer);
 }
 
-String getTimezoneDropdown(String selectedTz) {
-  String html = "<select id='timezone' name='timezone'>";
-  
-  auto addOption = [&](const char* tz, const char* name) {
-    html += "<option value='";
-    html += tz;
-    html += "'";
-    if (selectedTz == tz) {
-      html += " selected";
-    }
-    html += ">";
-    html += name;
-    html += "</option>";
-  };
+// <option> for the dropdowns below; returns true if it is the selected one
+static bool printOption(ChunkedResponse& out, const char* value, const char* name, const char* selected) {
+  bool isSelected = strcmp(value, selected) == 0;
+  out.print("<option value='");
+  out.printHtml(value);
+  out.print(isSelected ? "' selected>" : "'>");
+  out.print(name);
+  out.print("</option>");
+  return isSelected;
+}
 
-  addOption("GMT0BST,M3.5.0/1,M10.5.0", "(GMT/BST) London, Dublin");
-  addOption("CET-1CEST,M3.5.0,M10.5.0/3", "(CET/CEST) Berlin, Paris, Rome");
-  addOption("EET-2EEST,M3.5.0/3,M10.5.0/4", "(EET/EEST) Athens, Helsinki, Kyiv");
-  html += "<option disabled>--- Americas ---</option>";
-  addOption("EST5EDT,M3.2.0,M11.1.0", "(EST/EDT) New York, Toronto");
-  addOption("CST6CDT,M3.2.0,M11.1.0", "(CST/CDT) Chicago, Mexico City");
-  addOption("MST7MDT,M3.2.0,M11.1.0", "(MST/MDT) Denver");
-  addOption("PST8PDT,M3.2.0,M11.1.0", "(PST/PDT) Los Angeles, Vancouver");
-  addOption("AST4ADT,M3.2.0,M11.1.0", "(AST/ADT) Halifax (Atlantic)");
-  addOption("AKST9AKDT,M3.2.0,M11.1.0", "(AKST/AKDT) Alaska");
-  addOption("HST10", "(HST) Hawaii (No DST)");
-  html += "<option disabled>--- Asia/Pacific ---</option>";
-  addOption("JST-9", "(JST) Tokyo, Seoul (No DST)");
-  addOption("CST-8", "(CST) Beijing, Perth, Singapore (No DST)");
-  addOption("AEST-10AEDT,M10.1.0,M4.1.0/3", "(AEST/AEDT) Sydney, Melbourne");
-  addOption("ACST-9:30ACDT,M10.1.0,M4.1.0/3", "(ACST/ACDT) Adelaide");
-  addOption("AWST-8", "(AWST) Perth (No DST)");
-  addOption("NZST-12NZDT,M9.5.0,M4.1.0/3", "(NZST/NZDT) New Zealand");
-  addOption("IST-5:30", "(IST) India (No DST)");
-  html += "<option disabled>--- Other ---</option>";
-  addOption("UTC0", "(UTC) Coordinated Universal Time");
-  
-  if (html.indexOf("selected") == -1) {
-     addOption(selectedTz.c_str(), "(Custom)");
+void printTimezoneDropdown(ChunkedResponse& out, const char* selectedTz) {
+  static const char* const OPTIONS[][2] = {
+    {"GMT0BST,M3.5.0/1,M10.5.0", "(GMT/BST) London, Dublin"},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", "(CET/CEST) Berlin, Paris, Rome"},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", "(EET/EEST) Athens, Helsinki, Kyiv"},
+    {nullptr, "--- Americas ---"},
+    {"EST5EDT,M3.2.0,M11.1.0", "(EST/EDT) New York, Toronto"},
+    {"CST6CDT,M3.2.0,M11.1.0", "(CST/CDT) Chicago, Mexico City"},
+    {"MST7MDT,M3.2.0,M11.1.0", "(MST/MDT) Denver"},
+    {"PST8PDT,M3.2.0,M11.1.0", "(PST/PDT) Los Angeles, Vancouver"},
+    {"AST4ADT,M3.2.0,M11.1.0", "(AST/ADT) Halifax (Atlantic)"},
+    {"AKST9AKDT,M3.2.0,M11.1.0", "(AKST/AKDT) Alaska"},
+    {"HST10", "(HST) Hawaii (No DST)"},
+    {nullptr, "--- Asia/Pacific ---"},
+    {"JST-9", "(JST) Tokyo, Seoul (No DST)"},
+    {"CST-8", "(CST) Beijing, Perth, Singapore (No DST)"},
+    {"AEST-10AEDT,M10.1.0,M4.1.0/3", "(AEST/AEDT) Sydney, Melbourne"},
+    {"ACST-9:30ACDT,M10.1.0,M4.1.0/3", "(ACST/ACDT) Adelaide"},
+    {"AWST-8", "(AWST) Perth (No DST)"},
+    {"NZST-12NZDT,M9.5.0,M4.1.0/3", "(NZST/NZDT) New Zealand"},
+    {"IST-5:30", "(IST) India (No DST)"},
+    {nullptr, "--- Other ---"},
+    {"UTC0", "(UTC) Coordinated Universal Time"},
+  };
+  bool found = false;
+  out.print("<select id='timezone' name='timezone'>");
+  for (const auto& option : OPTIONS) {
+    if (option[0]) {
+      found |= printOption(out, option[0], option[1], selectedTz);
+    } else {
+      out.printf("<option disabled>%s</option>", option[1]);
+    }
   }
+  if (!found) printOption(out, selectedTz, "(Custom)", selectedTz);
+  out.print("</select>");
+}
 
-  html += "</select>";
-  return html;
+void printLedOrderDropdown(ChunkedResponse& out, const char* selectedOrder) {
+  static const char* const OPTIONS[][2] = {
+    {"GRB", "GRB (Most Common WS2812B)"}, {"RGB", "RGB"}, {"BRG", "BRG"},
+    {"GBR", "GBR"}, {"RBG", "RBG"}, {"BGR", "BGR"},
+  };
+  bool found = false;
+  out.print("<select id='led_color_order' name='led_color_order'>");
+  for (const auto& option : OPTIONS) found |= printOption(out, option[0], option[1], selectedOrder);
+  if (!found) printOption(out, selectedOrder, "(Custom)", selectedOrder);
+  out.print("</select>");
 }
 
-String getLedOrderDropdown(String selectedOrder) {
-  String html = "<select id='led_color_order' name='led_color_order'>";
-  
-  auto addOption = [&](const char* order, const char* name) {
-    html += "<option value='";
-    html += order;
-    html += "'";
-    if (selectedOrder == order) {
-      html += " selected";
-    }
-    html += ">";
-    html += name;
-    html += "</option>";
+// --- Live apply ---
+// Brings the running device in line with `config` after it changed from
+// `previous`, without a reboot. Colors, brightness, timeouts and the live
+// update rate are read on every use and need nothing beyond a redraw.
+// Writes a short list of what had to be re-initialized to `applied`.
+void applyConfigChanges(const Config& previous, char* applied, size_t size) {
+  applied[0] = '\0';
+  auto note = [applied, size](const char* what) {
+    if (applied[0]) strlcat(applied, ", ", size);
+    strlcat(applied, what, size);
   };
 
-  addOption("GRB", "GRB (Most Common WS2812B)");
-  addOption("RGB", "RGB");
-  addOption("BRG", "BRG");
-  addOption("GBR", "GBR");
-  addOption("RBG", "RBG");
-  addOption("BGR", "BGR");
+  if (strcmp(previous.bbl_ip, config.bbl_ip) != 0 ||
+      strcmp(previous.bbl_serial, config.bbl_serial) != 0 ||
+      strcmp(previous.bbl_access_code, config.bbl_access_code) != 0) {
+    Serial.println("Printer settings changed, reconnecting MQTT.");
+    client.disconnect();
+    setupMQTTParams();
+    timerStop(TIMER_MQTT_RECONNECT); // handleMQTTConnection() reconnects on the next loop
+    note("printer connection");
+  }
+
+  if (strcmp(previous.bridge_host, config.bridge_host) != 0 ||
+      strcmp(previous.bridge_user, config.bridge_user) != 0 ||
+      strcmp(previous.bridge_pass, config.bridge_pass) != 0 ||
+      strcmp(previous.bridge_prefix, config.bridge_prefix) != 0 ||
+      strcmp(previous.bbl_serial, config.bbl_serial) != 0 ||
+      previous.bridge_port != config.bridge_port ||
+      previous.bridge_discovery != config.bridge_discovery) {
+    reconfigureMqttBridge(); // Rate and deadband apply on the next pass as they are
+    note("home-automation MQTT");
+  }
 
-  if (html.indexOf("selected") == -1) {
-     addOption(selectedOrder.c_str(), "(Custom)");
+  if (strcmp(previous.ntp_server, config.ntp_server) != 0 ||
+      strcmp(previous.timezone, config.timezone) != 0) {
+    configureTime();
+    note("time settings");
   }
 
-  html += "</select>";
-  return html;
-}
\ No newline at end of file
+  if (strcmp(previous.rules, config.rules) != 0) {
+    loadRules();
+    note("rules");
+  }
+
+  if (previous.chamber_light_pin != config.chamber_light_pin ||
+      previous.invert_output != config.invert_output) {
+    reconfigureChamberLight(previous.chamber_light_pin);
+    note("light output");
+  } else if (previous.chamber_pwm_brightness != config.chamber_pwm_brightness && external_light_is_on) {
+    setChamberLightState(true);
+  }
+  // Rules or brightness may change what automatic mode wants
+  updateAutomaticLight();
+
+  if (previous.num_leds != config.num_leds ||
+      strcmp(previous.led_color_order, config.led_color_order) != 0) {
+    reconfigureLEDStrip();
+    note("LED strip");
+  } else {
+    refreshLEDs();
+  }
+
+  markStatusChanged();
+}
@@ -15,6 +15,68 @@ const int DEFAULT_CHAMBER_LIGHT_PIN = 14;
 #define MAX_LEDS 60  // Changed from const int to #define
 
 const int DEFAULT_NUM_LEDS = 10;
+const int DEFAULT_WS_MAX_RATE_HZ = 4;
+#define MAX_WS_RATE_HZ 20
+#define RULES_TEXT_MAX 512 // Source of the user rules (rules.h), terminator included
+const int DEFAULT_BRIDGE_PORT = 1883;
+const int DEFAULT_BRIDGE_RATE_HZ = 1;
+#define MAX_BRIDGE_RATE_HZ 10
+const float DEFAULT_BRIDGE_DEADBAND = 0.5f;
+const uint32_t BRIDGE_RECONNECT_MIN_MS = 5000;  // Doubles per failed attempt...
+const uint32_t BRIDGE_RECONNECT_MAX_MS = 60000; // ...up to this
+const int32_t BRIDGE_CONNECT_TIMEOUT_MS = 300;   // TCP connect; loop() waits for it
+const uint16_t BRIDGE_SOCKET_TIMEOUT_S = 1;      // PubSubClient reads, e.g. CONNACK (default 15)
+
+// WebSocket server on port 81. Set to 0 to leave it out of the build; the
+// status page then only uses the /events stream on port 80.
+#ifndef ENABLE_WEBSOCKET
+#define ENABLE_WEBSOCKET 1
+#endif
+
+// Per-stage loop() timing shown on /profile. Set to 0 to compile it out.
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER 1
+#endif
+
+// Longest loop() sleeps when no timer (scheduler.h) is due. HTTP, WebSocket
+// and MQTT sockets are only polled between sleeps, so this bounds their added
+// latency. 0 keeps the old busy loop.
+#ifndef LOOP_MAX_SLEEP_MS
+#define LOOP_MAX_SLEEP_MS 10
+#endif
+
+// No heap allocations from loop() once setup() is done: see heap_guard.h for
+// what is covered and how it is checked. HEAP_GUARD_ABORT turns a counted
+// allocation into an abort() with a backtrace at the call site.
+#ifndef ZERO_HEAP_AFTER_BOOT
+#define ZERO_HEAP_AFTER_BOOT 0
+#endif
+#ifndef HEAP_GUARD_ABORT
+#define HEAP_GUARD_ABORT 0
+#endif
+
+// JSON document capacities below are in ESP32 terms. ArduinoJson slots hold
+// pointers, so a 64-bit host build needs twice the room for the same document.
+#define JSON_SLOT_SCALE (sizeof(void*) / 4)
+
+// Budgets for one printer report in mqttCallback(), so a malformed or hostile
+// message costs bounded time and memory. Larger payloads are dropped by the
+// MQTT client (its buffer is sized from MQTT_MAX_PAYLOAD_BYTES), deeper JSON
+// fails to parse, and only the fields the parsers read are kept.
+#ifndef MQTT_MAX_PAYLOAD_BYTES
+#define MQTT_MAX_PAYLOAD_BYTES 16384
+#endif
+#define MQTT_BUFFER_SIZE (MQTT_MAX_PAYLOAD_BYTES + 128) // + fixed header and topic
+#define MQTT_JSON_MAX_NESTING 12
+#define MQTT_JSON_DOC_CAPACITY (4096 * JSON_SLOT_SCALE) // Filtered document, see mqtt_handler.cpp
+#define MQTT_MAX_ARRAY_NODES 64     // lights_report / delta entries looked at
+#define MQTT_LOG_MAX_BYTES 1024     // Payload bytes kept in the MQTT history
+
+// Most verbose log call compiled in (logger.h): 1 error, 2 warn, 3 info,
+// 4 debug. The runtime level on /log.json can only lower it.
+#ifndef LOG_LEVEL_MAX
+#define LOG_LEVEL_MAX 3
+#endif
 
 // Configuration structure
 struct Config {
@@ -43,6 +105,22 @@ struct Config {
   char ntp_server[60];
   char timezone[50];
   char led_color_order[4];
+
+  int ws_max_rate_hz = DEFAULT_WS_MAX_RATE_HZ; // Max status frames/s per live-update client
+  char rules[RULES_TEXT_MAX] = "";              // See rules.h
+
+  // Home-automation MQTT broker (mqtt_bridge.h); an empty host turns it off
+  char bridge_host[64] = "";
+  char bridge_user[32] = "";
+  char bridge_pass[40] = "";
+  char bridge_prefix[24] = "bambuled";          // Topics are <prefix>/<serial>/<field>
+  uint16_t bridge_port = DEFAULT_BRIDGE_PORT;
+  bool bridge_discovery = true;                 // Home Assistant discovery documents
+  uint8_t bridge_max_rate_hz = DEFAULT_BRIDGE_RATE_HZ; // Max publish passes/s
+  float bridge_temp_deadband = DEFAULT_BRIDGE_DEADBAND; // Min temperature change published, deg C
+
+  uint8_t ams_leds = 0; // Last LEDs of the strip show the AMS trays (ams.h); 0 is off
+  bool printer_control = false; // Allows pause, resume and stop over HTTP / WebSocket (printer_commands.h)
 };
 
 extern Config config;
@@ -50,6 +128,48 @@ extern Config config;
 // Add JSON document size constant
 const size_t JSON_DOC_SIZE = 4096;
 
+// Shared JSON documents (json_pool.h): how many, and their capacity. Memory
+// blocks from JSON_PSRAM_MIN_BYTES up go to PSRAM when the board has it.
+#define JSON_POOL_DOCS 3
+const size_t JSON_POOL_DOC_CAPACITY = 4096 * JSON_SLOT_SCALE;
+const size_t JSON_PSRAM_MIN_BYTES = 1024;
+
+// Printer commands (printer_commands.h): history kept, reply timeout, sends
+// per command, and how long a command may wait for MQTT before it is dropped
+#define PRINTER_CMD_SLOTS 8
+const uint32_t PRINTER_CMD_TIMEOUT_MS = 5000;
+const uint8_t PRINTER_CMD_MAX_ATTEMPTS = 3;
+const uint32_t PRINTER_CMD_MAX_AGE_MS = 30000;
+const uint32_t PRINTER_CMD_POLL_MS = 250; // Timer period while a command is pending
+
+// Printer health codes (hms.h) kept and shown, most severe first
+#define HMS_MAX_ENTRIES 6
+
+// AMS model (ams.h): units x trays, and how bright the trays other than the
+// active one are drawn on the strip segment (out of 255)
+#define AMS_MAX_UNITS 4
+#define AMS_TRAYS_PER_UNIT 4
+#define AMS_TRAY_TYPE_MAX 15
+const uint8_t AMS_INACTIVE_SCALE = 48;
+
+// Log ring (logger.h): lines waiting to drain, their length, and the drain
+// task. The file sink rotates LOG_FILE_PATH to LOG_FILE_OLD_PATH when full.
+#define LOG_RING_SLOTS 32 // Power of two
+#define LOG_LINE_MAX 120
+const uint32_t LOG_DRAIN_INTERVAL_MS = 20;
+#define LOG_TASK_PRIORITY 0 // Below loop()
+#define LOG_TASK_STACK 4096
+#define LOG_FILE_PATH "/log.txt"
+#define LOG_FILE_OLD_PATH "/log.old.txt"
+const size_t LOG_FILE_MAX_BYTES = 32768;
+
+// Imported (then removed) at boot; the live copy is in config_store
+#define CONFIG_JSON_PATH "/config.json"
+
+// Duration of the last loadConfig() / saveConfig()
+extern uint32_t config_load_us;
+extern uint32_t config_save_us;
+
 // WiFiManager parameter declarations (needed across files)
 extern WiFiManagerParameter custom_bbl_ip;
 // ... (keep all the WiFiManager parameter declarations the same)
@@ -59,6 +179,8 @@ bool initFileSystem();
 void performFactoryReset();
 bool loadConfig();
 bool saveConfig();
+void configToJson(const Config& c, JsonDocument& doc);
+void configFromJson(JsonDocument& doc, Config& out);
 void setupDefaultConfig();
 void applyConfigFixes();
 void printConfig();
@@ -67,7 +189,10 @@ void saveConfigCallback();
 bool isValidGpioPin(int pin);
 void configureTime();
 String getTimestamp();
-String getTimezoneDropdown(String selectedTz);
-String getLedOrderDropdown(String selectedOrder);
+size_t formatTimestamp(char* buf, size_t size);
+class ChunkedResponse;
+void printTimezoneDropdown(ChunkedResponse& out, const char* selectedTz);
+void printLedOrderDropdown(ChunkedResponse& out, const char* selectedOrder);
+void applyConfigChanges(const Config& previous, char* applied, size_t size);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "config_store.h"
+#include <LittleFS.h>
+
+static const char* const SLOT_PATHS[2] = {"/config_a.bin", "/config_b.bin"};
+
+static_assert(sizeof(Config) <= CONFIG_BLOB_MAX_LENGTH, "Config no longer fits a config slot");
+
+static uint32_t current_seq = 0;
+static int current_slot = -1;
+
+// CRC-32 (IEEE), four bits per step. A load checks both ~1 KB slots, where
+// the bitwise loop cost as much as parsing the JSON it replaced; a 64-byte
+// table is a quarter of the steps.
+static const uint32_t CRC32_NIBBLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+uint32_t configCrc32(const uint8_t* data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ CRC32_NIBBLE[crc & 0x0F];
+    crc = (crc >> 4) ^ CRC32_NIBBLE[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+// Reads and checks one slot. On success the payload is in `data`.
+static bool readSlot(int slot, ConfigBlobHeader& header, uint8_t* data) {
+  File f = LittleFS.open(SLOT_PATHS[slot], "r");
+  if (!f) return false;
+
+  bool ok = f.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == CONFIG_BLOB_MAGIC &&
+            header.version == CONFIG_BLOB_VERSION &&
+            header.header_size == sizeof(ConfigBlobHeader) &&
+            header.length > 0 && header.length <= CONFIG_BLOB_MAX_LENGTH &&
+            f.read(data, header.length) == header.length &&
+            configCrc32(data, header.length) == header.crc;
+  f.close();
+  if (!ok) Serial.printf("Config slot %s is missing or invalid.\n", SLOT_PATHS[slot]);
+  return ok;
+}
+
+bool loadConfigBlob(Config& out) {
+  uint8_t data[2][CONFIG_BLOB_MAX_LENGTH];
+  ConfigBlobHeader headers[2];
+  bool valid[2];
+  for (int slot = 0; slot < 2; slot++) {
+    valid[slot] = LittleFS.exists(SLOT_PATHS[slot]) && readSlot(slot, headers[slot], data[slot]);
+  }
+
+  int best = -1;
+  if (valid[0] && valid[1]) {
+    best = (int32_t)(headers[1].seq - headers[0].seq) > 0 ? 1 : 0;
+  } else if (valid[0]) {
+    best = 0;
+  } else if (valid[1]) {
+    best = 1;
+  }
+  if (best < 0) return false;
+
+  // Older, shorter images leave the appended fields at their defaults
+  memcpy(&out, data[best], min((size_t)headers[best].length, sizeof(Config)));
+  current_seq = headers[best].seq;
+  current_slot = best;
+  return true;
+}
+
+bool saveConfigBlob(const Config& in) {
+  // Never overwrite the slot holding the current copy
+  int slot = current_slot == 0 ? 1 : 0;
+
+  ConfigBlobHeader header;
+  header.magic = CONFIG_BLOB_MAGIC;
+  header.version = CONFIG_BLOB_VERSION;
+  header.header_size = sizeof(ConfigBlobHeader);
+  header.seq = current_seq + 1;
+  header.length = sizeof(Config);
+  header.crc = configCrc32((const uint8_t*)&in, sizeof(Config));
+
+  File f = LittleFS.open(SLOT_PATHS[slot], "w");
+  if (!f) {
+    Serial.printf("Failed to open %s for writing\n", SLOT_PATHS[slot]);
+    return false;
+  }
+  bool ok = f.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+            f.write((const uint8_t*)&in, sizeof(Config)) == sizeof(Config);
+  f.close();
+  if (!ok) {
+    Serial.printf("Failed to write %s\n", SLOT_PATHS[slot]);
+    return false;
+  }
+
+  current_seq = header.seq;
+  current_slot = slot;
+  return true;
+}
+
+void eraseConfigBlobs() {
+  for (int slot = 0; slot < 2; slot++) {
+    if (LittleFS.exists(SLOT_PATHS[slot])) LittleFS.remove(SLOT_PATHS[slot]);
+  }
+  current_seq = 0;
+  current_slot = -1;
+}
@@ -0,0 +1,35 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Binary image of Config on LittleFS, written alternately to two slots so a
+// power cut mid-write always leaves the previous copy intact. Each slot holds
+// a header followed by the raw struct; the newest slot with a valid CRC wins.
+//
+// Config may only grow by appending fields at the end. A shorter image from
+// older firmware is copied over the defaults, so new fields keep their default
+// value. Bump CONFIG_BLOB_VERSION only for changes that break that rule; images
+// of another version are ignored.
+
+#define CONFIG_BLOB_MAGIC 0x46434C42 // "BLCF"
+#define CONFIG_BLOB_VERSION 1
+#define CONFIG_BLOB_MAX_LENGTH 1024
+
+struct ConfigBlobHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_size;
+  uint32_t seq;      // Higher (wrap-safe) is newer
+  uint32_t length;   // Bytes of Config that follow
+  uint32_t crc;      // CRC-32 of those bytes
+};
+
+bool loadConfigBlob(Config& out); // Leaves `out` untouched if no valid slot exists
+bool saveConfigBlob(const Config& in);
+void eraseConfigBlobs();
+
+uint32_t configCrc32(const uint8_t* data, size_t length);
+
+#endif
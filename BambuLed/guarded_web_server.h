@@ -0,0 +1,68 @@
+#ifndef GUARDED_WEB_SERVER_H
+#define GUARDED_WEB_SERVER_H
+
+#include <WebServer.h>
+#include <utility>
+#include "heap_guard.h"
+
+// WebServer for ZERO_HEAP_AFTER_BOOT builds. server.handleClient() is exempt
+// from the heap guard as a whole, since request parsing allocates, but the
+// route handlers it calls run with the guard enforced: their own code must
+// not allocate. The WebServer calls a handler makes (arguments and headers,
+// which are returned as Strings, and responses) allocate by design and are
+// exempt one by one. Anything that bypasses these wrappers, e.g. a
+// ChunkedResponse holding a plain WebServer&, exempts its own calls.
+//
+// Without ZERO_HEAP_AFTER_BOOT the wrappers only forward.
+
+class GuardedWebServer : public WebServer {
+public:
+  explicit GuardedWebServer(int port = 80) : WebServer(port) {}
+
+  // Routes: handlers are wrapped once, at registration
+  template <typename U> void on(const U& uri, THandlerFunction fn) {
+    WebServer::on(uri, enforced(fn));
+  }
+  template <typename U> void on(const U& uri, HTTPMethod method, THandlerFunction fn) {
+    WebServer::on(uri, method, enforced(fn));
+  }
+  template <typename U> void on(const U& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn) {
+    WebServer::on(uri, method, enforced(fn), ufn); // Upload callbacks are part of request parsing
+  }
+  void onNotFound(THandlerFunction fn) { WebServer::onNotFound(enforced(fn)); }
+
+#define GUARDED_WEB_SERVER_CALL(name)                                                          \
+  template <typename... Args>                                                                  \
+  auto name(Args&&... args) -> decltype(std::declval<WebServer&>().name(std::forward<Args>(args)...)) { \
+    HEAP_GUARD_EXEMPT();                                                                       \
+    return WebServer::name(std::forward<Args>(args)...);                                       \
+  }
+
+  GUARDED_WEB_SERVER_CALL(uri)
+  GUARDED_WEB_SERVER_CALL(arg)
+  GUARDED_WEB_SERVER_CALL(argName)
+  GUARDED_WEB_SERVER_CALL(hasArg)
+  GUARDED_WEB_SERVER_CALL(header)
+  GUARDED_WEB_SERVER_CALL(hasHeader)
+  GUARDED_WEB_SERVER_CALL(send)
+  GUARDED_WEB_SERVER_CALL(send_P)
+  GUARDED_WEB_SERVER_CALL(sendHeader)
+  GUARDED_WEB_SERVER_CALL(sendContent)
+  GUARDED_WEB_SERVER_CALL(sendContent_P)
+
+#undef GUARDED_WEB_SERVER_CALL
+
+private:
+  static THandlerFunction enforced(THandlerFunction fn) {
+#if ZERO_HEAP_AFTER_BOOT
+    return [fn]() {
+      HEAP_GUARD_ENFORCE();
+      fn();
+    };
+#else
+    return fn;
+#endif
+  }
+};
+
+#endif
@@ -0,0 +1,95 @@
+#include "heap_guard.h"
+
+#if ZERO_HEAP_AFTER_BOOT
+
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+static TaskHandle_t guarded_task = nullptr; // Loop task, once armed
+static uint8_t exempt_depth = 0;            // Only changed by the loop task
+
+static std::atomic<uint32_t> guard_allocs(0);
+static std::atomic<uint32_t> guard_bytes(0);
+static std::atomic<uint32_t> guard_last_size(0);
+static std::atomic<uint32_t> exempt_allocs(0);
+
+void heapGuardArm() {
+  guarded_task = xTaskGetCurrentTaskHandle();
+  if (heapGuardAvailable()) {
+    Serial.printf("Heap guard armed%s.\n", HEAP_GUARD_ABORT ? ", aborting on allocation" : "");
+  } else {
+    Serial.println("Heap guard unavailable: needs CONFIG_HEAP_USE_HOOKS.");
+  }
+}
+
+HeapGuardExempt::HeapGuardExempt() {
+  exempt_depth++;
+}
+
+HeapGuardExempt::~HeapGuardExempt() {
+  exempt_depth--;
+}
+
+HeapGuardEnforce::HeapGuardEnforce() : _saved_depth(exempt_depth) {
+  exempt_depth = 0;
+}
+
+HeapGuardEnforce::~HeapGuardEnforce() {
+  exempt_depth = _saved_depth;
+}
+
+uint32_t heapGuardAllocs() {
+  return guard_allocs.load(std::memory_order_relaxed);
+}
+
+uint32_t heapGuardAllocBytes() {
+  return guard_bytes.load(std::memory_order_relaxed);
+}
+
+uint32_t heapGuardLastAllocSize() {
+  return guard_last_size.load(std::memory_order_relaxed);
+}
+
+uint32_t heapGuardExemptAllocs() {
+  return exempt_allocs.load(std::memory_order_relaxed);
+}
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+
+bool heapGuardAvailable() {
+  return true;
+}
+
+// Called by the heap after every successful allocation, on the allocating
+// task. Must not allocate or print.
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+  (void)ptr;
+  (void)caps;
+  if (!guarded_task || xTaskGetCurrentTaskHandle() != guarded_task) return;
+  if (exempt_depth) {
+    exempt_allocs.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  guard_allocs.fetch_add(1, std::memory_order_relaxed);
+  guard_bytes.fetch_add(size, std::memory_order_relaxed);
+  guard_last_size.store(size, std::memory_order_relaxed);
+#if HEAP_GUARD_ABORT
+  abort();
+#endif
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) {
+  (void)ptr;
+}
+
+#else
+
+bool heapGuardAvailable() {
+  return false;
+}
+
+#endif // CONFIG_HEAP_USE_HOOKS
+
+#endif // ZERO_HEAP_AFTER_BOOT
@@ -0,0 +1,63 @@
+#ifndef HEAP_GUARD_H
+#define HEAP_GUARD_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Allocation guard for ZERO_HEAP_AFTER_BOOT builds.
+// Once armed at the end of setup(), every heap allocation made on the loop
+// task is counted (or aborts, with HEAP_GUARD_ABORT). Library calls that
+// allocate per request or connection by design (HTTP request parsing and
+// responses, WebSocket serving, OTA, the TLS handshake, socket writes) run
+// inside HEAP_GUARD_EXEMPT() and are counted separately. Everything else:
+// report parsing, LEDs, light, rules, status encoding, the periodic timers
+// and the web handlers, must not allocate.
+//
+// Our code called back from inside an exempt library call, such as a route
+// handler run by server.handleClient(), runs inside HEAP_GUARD_ENFORCE():
+// allocations count again until it ends (guarded_web_server.h).
+//
+// Counting needs the ESP-IDF heap hooks (CONFIG_HEAP_USE_HOOKS); the host
+// build always has them. Without the hooks the guard reports itself as
+// unavailable. With ZERO_HEAP_AFTER_BOOT set to 0 the macros below expand to
+// nothing.
+
+#if ZERO_HEAP_AFTER_BOOT
+
+void heapGuardArm();
+bool heapGuardAvailable();
+uint32_t heapGuardAllocs();       // Outside any exempt scope
+uint32_t heapGuardAllocBytes();
+uint32_t heapGuardLastAllocSize();
+uint32_t heapGuardExemptAllocs();
+
+class HeapGuardExempt {
+public:
+  HeapGuardExempt();
+  ~HeapGuardExempt();
+};
+
+class HeapGuardEnforce {
+public:
+  HeapGuardEnforce();
+  ~HeapGuardEnforce();
+
+private:
+  uint8_t _saved_depth;
+};
+
+#define HEAP_GUARD_CONCAT_(a, b) a##b
+#define HEAP_GUARD_CONCAT(a, b) HEAP_GUARD_CONCAT_(a, b)
+#define HEAP_GUARD_EXEMPT() HeapGuardExempt HEAP_GUARD_CONCAT(_heap_guard_exempt_, __LINE__)
+#define HEAP_GUARD_ENFORCE() HeapGuardEnforce HEAP_GUARD_CONCAT(_heap_guard_enforce_, __LINE__)
+#define HEAP_GUARD_ARM() heapGuardArm()
+
+#else
+
+#define HEAP_GUARD_EXEMPT()
+#define HEAP_GUARD_ENFORCE()
+#define HEAP_GUARD_ARM()
+
+#endif // ZERO_HEAP_AFTER_BOOT
+
+#endif
@@ -0,0 +1,193 @@
+#include "history_store.h"
+#include <PubSubClient.h>
+#include <esp_heap_caps.h>
+
+extern PubSubClient client;
+extern float current_bed_temp;
+extern float current_bed_target_temp;
+extern float current_nozzle_temp;
+extern float current_nozzle_target_temp;
+extern int current_print_percentage;
+extern int current_layer;
+
+const HistoryTierSpec HISTORY_TIERS[HISTORY_TIER_COUNT] = {
+  { 1, HISTORY_TIER0_SLOTS, 0 },
+  { 10, HISTORY_TIER1_SLOTS, 10 },
+  { HISTORY_TIER2_STEP_S, HISTORY_TIER2_SLOTS, HISTORY_TIER2_STEP_S / 10 },
+};
+
+const char* const HISTORY_CHANNEL_NAMES[HIST_CHANNEL_COUNT] = {
+  "bed", "bed_target", "nozzle", "nozzle_target", "percent", "layer"
+};
+
+const uint8_t HISTORY_CHANNEL_SCALE[HIST_CHANNEL_COUNT] = { 10, 10, 10, 10, 1, 1 };
+
+// Running aggregate of the previous tier's slots, folded into one slot
+struct HistoryAccumulator {
+  int32_t sum;
+  int16_t min;
+  int16_t max;
+  uint16_t samples;  // Slots with data
+  uint16_t slots;    // Slots seen, with or without data
+};
+
+struct HistoryTier {
+  HistorySample* data;  // slots * HIST_CHANNEL_COUNT, one row per slot
+  uint16_t head;        // Next slot to write
+  uint16_t count;
+  HistoryAccumulator acc[HIST_CHANNEL_COUNT];
+};
+
+static HistoryTier tiers[HISTORY_TIER_COUNT];
+static void* history_block = nullptr;
+static size_t history_bytes = 0;
+static uint32_t history_seconds = 0;
+static uint32_t last_tick_ms = 0;
+
+static void resetAccumulator(HistoryAccumulator& a) {
+  a.sum = 0;
+  a.min = INT16_MAX;
+  a.max = INT16_MIN;
+  a.samples = 0;
+  a.slots = 0;
+}
+
+void setupHistory() {
+  size_t slots = 0;
+  for (uint8_t t = 0; t < HISTORY_TIER_COUNT; t++) slots += HISTORY_TIERS[t].slots;
+  history_bytes = slots * HIST_CHANNEL_COUNT * sizeof(HistorySample);
+
+#ifdef BOARD_HAS_PSRAM
+  history_block = heap_caps_malloc(history_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  history_block = malloc(history_bytes);
+#endif
+  if (!history_block) {
+    Serial.printf("History: could not allocate %u bytes, history disabled.\n", (unsigned)history_bytes);
+    history_bytes = 0;
+    return;
+  }
+
+  HistorySample* p = (HistorySample*)history_block;
+  for (uint8_t t = 0; t < HISTORY_TIER_COUNT; t++) {
+    tiers[t].data = p;
+    tiers[t].head = 0;
+    tiers[t].count = 0;
+    for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) resetAccumulator(tiers[t].acc[ch]);
+    p += (size_t)HISTORY_TIERS[t].slots * HIST_CHANNEL_COUNT;
+  }
+  last_tick_ms = millis();
+  Serial.printf("History: %u bytes for %u slots.\n", (unsigned)history_bytes, (unsigned)slots);
+}
+
+static int16_t scaled(float value, uint8_t scale) {
+  return constrain(lroundf(value * scale), INT16_MIN + 1, INT16_MAX);
+}
+
+static void appendSlot(uint8_t t, const HistorySample* row);
+
+// Adds one slot of tier t-1 to tier t's accumulator and closes the slot when full
+static void accumulate(uint8_t t, const HistorySample* row) {
+  HistoryTier& tier = tiers[t];
+  bool full = false;
+  for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) {
+    HistoryAccumulator& a = tier.acc[ch];
+    const HistorySample& s = row[ch];
+    if (s.avg != HISTORY_NO_DATA) {
+      a.sum += s.avg;
+      if (s.min < a.min) a.min = s.min;
+      if (s.max > a.max) a.max = s.max;
+      a.samples++;
+    }
+    a.slots++;
+    full = a.slots >= HISTORY_TIERS[t].per_parent;
+  }
+  if (!full) return;
+
+  HistorySample out[HIST_CHANNEL_COUNT];
+  for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) {
+    HistoryAccumulator& a = tier.acc[ch];
+    if (a.samples == 0) {
+      out[ch].min = out[ch].max = out[ch].avg = HISTORY_NO_DATA;
+    } else {
+      out[ch].min = a.min;
+      out[ch].max = a.max;
+      out[ch].avg = a.sum / a.samples;
+    }
+    resetAccumulator(a);
+  }
+  appendSlot(t, out);
+}
+
+static void appendSlot(uint8_t t, const HistorySample* row) {
+  HistoryTier& tier = tiers[t];
+  memcpy(&tier.data[(size_t)tier.head * HIST_CHANNEL_COUNT], row, sizeof(HistorySample) * HIST_CHANNEL_COUNT);
+  tier.head = (tier.head + 1) % HISTORY_TIERS[t].slots;
+  if (tier.count < HISTORY_TIERS[t].slots) tier.count++;
+  if (t + 1 < HISTORY_TIER_COUNT) accumulate(t + 1, row);
+}
+
+static void appendCurrentValues() {
+  HistorySample row[HIST_CHANNEL_COUNT];
+  int16_t v[HIST_CHANNEL_COUNT];
+  if (client.connected()) {
+    v[HIST_BED] = scaled(current_bed_temp, HISTORY_CHANNEL_SCALE[HIST_BED]);
+    v[HIST_BED_TARGET] = scaled(current_bed_target_temp, HISTORY_CHANNEL_SCALE[HIST_BED_TARGET]);
+    v[HIST_NOZZLE] = scaled(current_nozzle_temp, HISTORY_CHANNEL_SCALE[HIST_NOZZLE]);
+    v[HIST_NOZZLE_TARGET] = scaled(current_nozzle_target_temp, HISTORY_CHANNEL_SCALE[HIST_NOZZLE_TARGET]);
+    v[HIST_PERCENT] = current_print_percentage;
+    v[HIST_LAYER] = constrain(current_layer, 0, INT16_MAX);
+  } else {
+    for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) v[ch] = HISTORY_NO_DATA;
+  }
+  for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) {
+    row[ch].min = row[ch].max = row[ch].avg = v[ch];
+  }
+  appendSlot(0, row);
+  history_seconds++;
+}
+
+void historyTick() {
+  if (!history_block) return;
+  uint32_t now = millis();
+  // Catch up after a long loop iteration, but don't replay minutes of stale values
+  uint8_t catchUp = 0;
+  while (now - last_tick_ms >= 1000 && catchUp < 5) {
+    last_tick_ms += 1000;
+    appendCurrentValues();
+    catchUp++;
+  }
+  if (now - last_tick_ms >= 1000) last_tick_ms = now;
+}
+
+bool historyAvailable() {
+  return history_block != nullptr;
+}
+
+uint32_t historyUptime() {
+  return history_seconds;
+}
+
+uint32_t historyTierEnd(uint8_t tier) {
+  // Seconds still sitting in the accumulators haven't reached this tier yet
+  uint32_t pending = 0;
+  for (uint8_t t = 1; t <= tier && t < HISTORY_TIER_COUNT; t++) {
+    pending += (uint32_t)tiers[t].acc[0].slots * HISTORY_TIERS[t - 1].step_s;
+  }
+  return history_seconds - pending;
+}
+
+uint16_t historyCount(uint8_t tier) {
+  return tier < HISTORY_TIER_COUNT ? tiers[tier].count : 0;
+}
+
+const HistorySample* historySlot(uint8_t tier, uint16_t index) {
+  const HistoryTier& t = tiers[tier];
+  uint16_t slots = HISTORY_TIERS[tier].slots;
+  uint16_t pos = (t.head + slots - t.count + index) % slots;
+  return &t.data[(size_t)pos * HIST_CHANNEL_COUNT];
+}
+
+size_t historyMemoryBytes() {
+  return history_bytes;
+}
@@ -0,0 +1,67 @@
+#ifndef HISTORY_STORE_H
+#define HISTORY_STORE_H
+
+#include <Arduino.h>
+
+// Round-robin time series of printer temperatures and progress.
+// Every second the current values are appended to the finest tier; coarser
+// tiers are fed from running min/max/sum accumulators, so an append never
+// rescans older samples. All tiers live in one block allocated at boot whose
+// size is fixed by the constants below.
+
+enum HistoryChannel : uint8_t {
+  HIST_BED = 0,
+  HIST_BED_TARGET,
+  HIST_NOZZLE,
+  HIST_NOZZLE_TARGET,
+  HIST_PERCENT,
+  HIST_LAYER,
+  HIST_CHANNEL_COUNT
+};
+
+// Marks a slot with no data (e.g. printer offline)
+const int16_t HISTORY_NO_DATA = INT16_MIN;
+
+struct HistorySample {
+  int16_t min;
+  int16_t max;
+  int16_t avg;
+};
+
+struct HistoryTierSpec {
+  uint16_t step_s;       // Seconds per slot
+  uint16_t slots;
+  uint16_t per_parent;   // Slots of the previous tier folded into one slot (0 for tier 0)
+};
+
+// Tier sizes: 1 s for 10 min, 10 s for 6 h, 1 min for 7 days (~440 KB, PSRAM).
+// Boards without PSRAM keep 5 min / 1 h / 24 h (~34 KB of internal RAM).
+#ifdef BOARD_HAS_PSRAM
+#define HISTORY_TIER0_SLOTS 600
+#define HISTORY_TIER1_SLOTS 2160
+#define HISTORY_TIER2_STEP_S 60
+#define HISTORY_TIER2_SLOTS 10080
+#else
+#define HISTORY_TIER0_SLOTS 300
+#define HISTORY_TIER1_SLOTS 360
+#define HISTORY_TIER2_STEP_S 300
+#define HISTORY_TIER2_SLOTS 288
+#endif
+#define HISTORY_TIER_COUNT 3
+
+extern const HistoryTierSpec HISTORY_TIERS[HISTORY_TIER_COUNT];
+extern const char* const HISTORY_CHANNEL_NAMES[HIST_CHANNEL_COUNT];
+extern const uint8_t HISTORY_CHANNEL_SCALE[HIST_CHANNEL_COUNT]; // Stored value = real value * scale
+
+void setupHistory();
+void historyTick();  // Called from TIMER_HISTORY; appends once per elapsed second
+
+bool historyAvailable();
+uint32_t historyUptime();              // Seconds appended since boot
+uint32_t historyTierEnd(uint8_t tier); // historyUptime() at the end of the tier's newest slot
+uint16_t historyCount(uint8_t tier);
+// index 0 is the oldest stored slot of the tier
+const HistorySample* historySlot(uint8_t tier, uint16_t index);
+size_t historyMemoryBytes();
+
+#endif
@@ -0,0 +1,169 @@
+#include "hms.h"
+#include "status_cache.h"
+#include "mqtt_history.h"
+#include "logger.h"
+
+// --- Code table ---
+// Sorted by attr, then code (checked at compile time). Descriptions are short
+// forms of the Bambu Lab wiki's; codes missing here are shown by module and
+// severity, with the code to look up.
+
+struct HmsCodeInfo {
+  uint32_t attr;
+  uint32_t code;
+  const char* description;
+};
+
+static constexpr HmsCodeInfo HMS_CODES[] PROGMEM = {
+  { 0x03000100, 0x00010001, "The heatbed heater may be short-circuited." },
+  { 0x03000200, 0x00010001, "The nozzle heater may be short-circuited." },
+  { 0x03000300, 0x00010001, "The hotend cooling fan is too slow or stopped." },
+  { 0x03000600, 0x00010001, "Motor A has an open circuit; a connection may be loose." },
+  { 0x03000700, 0x00010001, "Motor B has an open circuit; a connection may be loose." },
+  { 0x03000800, 0x00010001, "Motor Z has an open circuit; a connection may be loose." },
+  { 0x03001200, 0x00020001, "The front cover of the toolhead fell off." },
+  { 0x07002000, 0x00020001, "AMS A slot 1 filament has run out." },
+  { 0x07002100, 0x00020001, "AMS A slot 2 filament has run out." },
+  { 0x07002200, 0x00020001, "AMS A slot 3 filament has run out." },
+  { 0x07002300, 0x00020001, "AMS A slot 4 filament has run out." },
+  { 0x0C000100, 0x00010001, "The Micro Lidar camera is offline." },
+  { 0x0C000300, 0x00030008, "Possible spaghetti defects were detected." },
+};
+static constexpr size_t HMS_CODE_COUNT = sizeof(HMS_CODES) / sizeof(HMS_CODES[0]);
+
+static constexpr bool hmsCodesSorted(size_t i) {
+  return i + 1 >= HMS_CODE_COUNT ||
+         ((HMS_CODES[i].attr < HMS_CODES[i + 1].attr ||
+           (HMS_CODES[i].attr == HMS_CODES[i + 1].attr && HMS_CODES[i].code < HMS_CODES[i + 1].code)) &&
+          hmsCodesSorted(i + 1));
+}
+static_assert(hmsCodesSorted(0), "HMS_CODES must be sorted for the binary search");
+
+static const struct {
+  uint8_t id;
+  const char* name;
+} HMS_MODULES[] = {
+  { 0x03, "Motion controller" }, { 0x05, "Mainboard" }, { 0x07, "AMS" },
+  { 0x08, "Toolhead" }, { 0x0C, "Camera" }, { 0x12, "AMS" },
+};
+
+static const char* const HMS_SEVERITY_NAMES[HMS_SEVERITY_COUNT] = { "none", "fatal", "serious", "common", "info" };
+
+const char* hmsDescription(uint32_t attr, uint32_t code) {
+  size_t lo = 0, hi = HMS_CODE_COUNT;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    const HmsCodeInfo& info = HMS_CODES[mid];
+    if (info.attr < attr || (info.attr == attr && info.code < code)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < HMS_CODE_COUNT && HMS_CODES[lo].attr == attr && HMS_CODES[lo].code == code) {
+    return HMS_CODES[lo].description;
+  }
+  return nullptr;
+}
+
+uint8_t hmsSeverity(uint32_t code) {
+  uint16_t level = code >> 16;
+  // Levels the printer may add later are treated as warnings
+  return (level >= HMS_SEVERITY_FATAL && level <= HMS_SEVERITY_INFO) ? level : HMS_SEVERITY_COMMON;
+}
+
+const char* hmsSeverityName(uint8_t severity) {
+  return severity < HMS_SEVERITY_COUNT ? HMS_SEVERITY_NAMES[severity] : "?";
+}
+
+const char* hmsModuleName(uint32_t attr) {
+  uint8_t id = attr >> 24;
+  for (const auto& module : HMS_MODULES) {
+    if (module.id == id) return module.name;
+  }
+  return "Printer";
+}
+
+void formatHmsCode(const HmsEntry& entry, char* buf, size_t size) {
+  snprintf(buf, size, "%04X_%04X_%04X_%04X", (unsigned)(entry.attr >> 16), (unsigned)(entry.attr & 0xFFFF),
+           (unsigned)(entry.code >> 16), (unsigned)(entry.code & 0xFFFF));
+}
+
+// --- Active entries ---
+
+static HmsEntry entries[HMS_MAX_ENTRIES];
+static uint8_t entry_count = 0;
+static uint8_t reported_count = 0;
+
+static bool contains(const HmsEntry* list, uint8_t count, const HmsEntry& e) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (list[i].attr == e.attr && list[i].code == e.code) return true;
+  }
+  return false;
+}
+
+static void logNewEntry(const HmsEntry& e) {
+  char code[20];
+  formatHmsCode(e, code, sizeof(code));
+  uint8_t severity = hmsSeverity(e.code);
+  const char* text = e.description ? e.description : hmsModuleName(e.attr);
+  LOG_WARN("HMS %s (%s): %s", code, hmsSeverityName(severity), text);
+  mqttHistoryPrintf(severity <= HMS_SEVERITY_SERIOUS, "HMS %s (%s): %s", code, hmsSeverityName(severity), text);
+}
+
+bool parseHms(JsonArray arr) {
+  HmsEntry next[HMS_MAX_ENTRIES];
+  uint8_t count = 0;
+  uint8_t reported = 0;
+  int seen = 0;
+  for (JsonObject item : arr) {
+    if (++seen > MQTT_MAX_ARRAY_NODES) break;
+    if (item.isNull()) continue;
+    HmsEntry e = { item["attr"].as<uint32_t>(), item["code"].as<uint32_t>(), nullptr };
+    if (contains(next, count, e)) continue;
+    if (reported < UINT8_MAX) reported++;
+
+    // Insert by severity, most severe first; past capacity the least severe go
+    uint8_t severity = hmsSeverity(e.code);
+    uint8_t pos = count;
+    while (pos > 0 && hmsSeverity(next[pos - 1].code) > severity) pos--;
+    if (pos >= HMS_MAX_ENTRIES) continue;
+    if (count < HMS_MAX_ENTRIES) count++;
+    memmove(&next[pos + 1], &next[pos], (count - 1 - pos) * sizeof(HmsEntry));
+    e.description = hmsDescription(e.attr, e.code);
+    next[pos] = e;
+  }
+
+  bool changed = (count != entry_count || reported != reported_count);
+  for (uint8_t i = 0; i < count && !changed; i++) {
+    changed = (next[i].attr != entries[i].attr || next[i].code != entries[i].code);
+  }
+  if (!changed) return false;
+
+  for (uint8_t i = 0; i < count; i++) {
+    if (!contains(entries, entry_count, next[i])) logNewEntry(next[i]);
+  }
+  if (count == 0) LOG_INFO("HMS entries cleared.");
+
+  memcpy(entries, next, count * sizeof(HmsEntry));
+  entry_count = count;
+  reported_count = reported;
+  markStatusDetailsChanged();
+  return true;
+}
+
+uint8_t hmsCount() {
+  return entry_count;
+}
+
+const HmsEntry& hmsAt(uint8_t i) {
+  return entries[i];
+}
+
+uint8_t hmsReported() {
+  return reported_count;
+}
+
+uint8_t hmsWorstSeverity() {
+  return entry_count ? hmsSeverity(entries[0].code) : HMS_SEVERITY_NONE;
+}
@@ -0,0 +1,51 @@
+#ifndef HMS_H
+#define HMS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "config.h"
+
+// Printer health (HMS) codes from the "hms" array of reports. Each entry is a
+// pair of 32-bit numbers, shown by Bambu as four 16-bit groups:
+//
+//   {"attr": 50336256, "code": 131073}  ->  0300_1200_0002_0001
+//
+// The top byte of attr is the module (0x03 motion controller, 0x07 AMS, ...)
+// and the high half of code the severity (1 fatal ... 4 info).
+// Descriptions come from a sorted table in flash, searched by binary search;
+// codes not in it are shown by module and severity.
+//
+// The printer sends the whole list while any entry is active and an empty
+// list once they clear. Up to HMS_MAX_ENTRIES are kept, most severe first.
+
+enum HmsSeverity : uint8_t {
+  HMS_SEVERITY_NONE = 0, // No entries
+  HMS_SEVERITY_FATAL,    // Printing stopped
+  HMS_SEVERITY_SERIOUS,  // Needs attention, e.g. filament ran out
+  HMS_SEVERITY_COMMON,   // Warning
+  HMS_SEVERITY_INFO,
+  HMS_SEVERITY_COUNT
+};
+
+struct HmsEntry {
+  uint32_t attr;
+  uint32_t code;
+  const char* description; // In flash; nullptr when the code is not in the table
+};
+
+// Updates the active entries from a report's "hms" array. Returns true if
+// they changed, in which case the status has been marked changed.
+bool parseHms(JsonArray arr);
+
+uint8_t hmsCount();
+const HmsEntry& hmsAt(uint8_t i);
+uint8_t hmsReported();       // Entries in the last report, kept or not
+uint8_t hmsWorstSeverity();  // HmsSeverity, HMS_SEVERITY_NONE without entries
+
+uint8_t hmsSeverity(uint32_t code);
+const char* hmsSeverityName(uint8_t severity);
+const char* hmsModuleName(uint32_t attr);
+const char* hmsDescription(uint32_t attr, uint32_t code); // nullptr if unknown
+void formatHmsCode(const HmsEntry& entry, char* buf, size_t size); // "0300_1200_0002_0001"
+
+#endif
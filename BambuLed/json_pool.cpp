@@ -0,0 +1,101 @@
+#include "json_pool.h"
+#include <esp_heap_caps.h>
+#if __has_include(<esp_memory_utils.h>)
+#include <esp_memory_utils.h> // esp_ptr_external_ram(), IDF 5
+#else
+#include <soc/soc_memory_layout.h>
+#endif
+
+static PooledJsonDocument* pool_docs[JSON_POOL_DOCS];
+static uint8_t pool_count = 0;
+static uint8_t pool_busy = 0; // Bit per document
+static_assert(JSON_POOL_DOCS <= 8, "pool_busy has one bit per document");
+
+static JsonPoolStats stats;
+static bool last_block_psram = false; // Where the last allocate() landed
+
+// --- Allocator ---
+
+static uint32_t heapCaps(size_t size) {
+#ifdef BOARD_HAS_PSRAM
+  if (size >= JSON_PSRAM_MIN_BYTES) return MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+#endif
+  return MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+}
+
+static void countCall(uint32_t start) {
+  stats.alloc_calls++;
+  stats.alloc_us += micros() - start;
+}
+
+void* JsonPoolAllocator::allocate(size_t size) {
+  uint32_t start = micros();
+  void* ptr = heap_caps_malloc(size, heapCaps(size));
+  // Fall back to any memory rather than fail the document
+  if (!ptr) ptr = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+  last_block_psram = ptr && esp_ptr_external_ram(ptr);
+  countCall(start);
+  return ptr;
+}
+
+void JsonPoolAllocator::deallocate(void* ptr) {
+  uint32_t start = micros();
+  heap_caps_free(ptr);
+  countCall(start);
+}
+
+void* JsonPoolAllocator::reallocate(void* ptr, size_t new_size) {
+  uint32_t start = micros();
+  void* moved = heap_caps_realloc(ptr, new_size, heapCaps(new_size));
+  countCall(start);
+  return moved;
+}
+
+// --- Pool ---
+
+void setupJsonPool() {
+  if (pool_count) return;
+  for (uint8_t i = 0; i < JSON_POOL_DOCS; i++) {
+    PooledJsonDocument* doc = new PooledJsonDocument(JSON_POOL_DOC_CAPACITY);
+    if (doc->capacity() == 0) {
+      delete doc;
+      break;
+    }
+    // Counted where the block landed: PSRAM may be full or missing
+    if (last_block_psram) stats.psram_bytes += JSON_POOL_DOC_CAPACITY;
+    pool_docs[pool_count++] = doc;
+  }
+  Serial.printf("JSON pool: %u x %u bytes, %u in PSRAM.\n", pool_count, (unsigned)JSON_POOL_DOC_CAPACITY,
+                (unsigned)stats.psram_bytes);
+}
+
+const JsonPoolStats& getJsonPoolStats() {
+  return stats;
+}
+
+JsonLease::JsonLease() : _doc(nullptr), _slot(-1) {
+  if (!pool_count) setupJsonPool(); // Borrowed before setup() got to it
+  stats.borrows++;
+  for (uint8_t i = 0; i < pool_count; i++) {
+    if (pool_busy & (1 << i)) continue;
+    pool_busy |= 1 << i;
+    _doc = pool_docs[i];
+    _slot = i;
+    break;
+  }
+  if (!_doc) {
+    stats.misses++;
+    _doc = new PooledJsonDocument(JSON_POOL_DOC_CAPACITY);
+  }
+  if (++stats.in_use > stats.max_in_use) stats.max_in_use = stats.in_use;
+}
+
+JsonLease::~JsonLease() {
+  stats.in_use--;
+  if (_slot < 0) {
+    delete _doc;
+    return;
+  }
+  _doc->clear();
+  pool_busy &= ~(1 << _slot);
+}
@@ -0,0 +1,58 @@
+#ifndef JSON_POOL_H
+#define JSON_POOL_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "config.h"
+
+// Long-lived JSON documents, borrowed for one message or request instead of
+// each caller building and freeing its own. setupJsonPool() allocates
+// JSON_POOL_DOCS documents once, in PSRAM when present, so report parsing
+// and status encoding no longer touch malloc/free or the internal heap.
+//
+//   JsonLease doc;
+//   deserializeJson(*doc, payload, length);
+//
+// The document is cleared and handed back when the lease goes out of scope.
+// If every document is out, the lease gets a temporary one from the heap and
+// the miss is counted. Loop task only.
+
+// Blocks of JSON_PSRAM_MIN_BYTES or more go to PSRAM, the rest to internal
+// RAM. Every call is counted and timed for /metrics.
+struct JsonPoolAllocator {
+  void* allocate(size_t size);
+  void deallocate(void* ptr);
+  void* reallocate(void* ptr, size_t new_size);
+};
+
+typedef BasicJsonDocument<JsonPoolAllocator> PooledJsonDocument;
+
+struct JsonPoolStats {
+  uint32_t borrows;
+  uint32_t misses;      // Pool empty, a temporary document was allocated
+  uint8_t in_use;
+  uint8_t max_in_use;
+  uint32_t alloc_calls; // allocate / reallocate / deallocate
+  uint64_t alloc_us;    // Time spent in them
+  uint32_t psram_bytes; // Pool memory placed in PSRAM
+};
+
+void setupJsonPool();
+const JsonPoolStats& getJsonPoolStats();
+
+class JsonLease {
+public:
+  JsonLease();
+  ~JsonLease();
+  JsonLease(const JsonLease&) = delete;
+  JsonLease& operator=(const JsonLease&) = delete;
+
+  JsonDocument& operator*() const { return *_doc; }
+  JsonDocument* operator->() const { return _doc; }
+
+private:
+  PooledJsonDocument* _doc;
+  int8_t _slot; // -1 for a temporary document
+};
+
+#endif
@@ -1,11 +1,58 @@
 #include "led_controller.h"
 #include "config.h"
 #include "light_controller.h" 
+#include "status_cache.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "led_plan.h"
+#include "ams.h"
+#include "rules.h"
+#include "scheduler.h"
+#include "logger.h"
 #include <math.h> // Include for sinf() and PI
 
 // LED array definition
 CRGB leds[MAX_LEDS];
 
+// FastLED can't remove a controller, so one is created per color order on
+// first use. Switching order parks the previous one with zero LEDs.
+static const char* const LED_ORDERS[] = {"GRB", "RGB", "BRG", "GBR", "RBG", "BGR"};
+const int LED_ORDER_COUNT = sizeof(LED_ORDERS) / sizeof(LED_ORDERS[0]);
+static CLEDController* led_controllers[LED_ORDER_COUNT] = {};
+static int active_led_order = -1;
+
+static int ledOrderIndex(const char* order) {
+  for (int i = 0; i < LED_ORDER_COUNT; i++) {
+    if (strcmp(order, LED_ORDERS[i]) == 0) return i;
+  }
+  LOG_WARN("Unknown LED color order %s, defaulting to GRB.", order);
+  return 0;
+}
+
+static CLEDController& addLedController(int order) {
+  switch (order) {
+    case 1:  return FastLED.addLeds<WS2812B, LED_DATA_PIN, RGB>(leds, config.num_leds);
+    case 2:  return FastLED.addLeds<WS2812B, LED_DATA_PIN, BRG>(leds, config.num_leds);
+    case 3:  return FastLED.addLeds<WS2812B, LED_DATA_PIN, GBR>(leds, config.num_leds);
+    case 4:  return FastLED.addLeds<WS2812B, LED_DATA_PIN, RBG>(leds, config.num_leds);
+    case 5:  return FastLED.addLeds<WS2812B, LED_DATA_PIN, BGR>(leds, config.num_leds);
+    default: return FastLED.addLeds<WS2812B, LED_DATA_PIN, GRB>(leds, config.num_leds);
+  }
+}
+
+static void attachLedStrip() {
+  int order = ledOrderIndex(config.led_color_order);
+  if (active_led_order >= 0 && active_led_order != order) {
+    led_controllers[active_led_order]->setLeds(leds, 0);
+  }
+  if (!led_controllers[order]) {
+    led_controllers[order] = &addLedController(order).setCorrection(TypicalLEDStrip);
+  } else {
+    led_controllers[order]->setLeds(leds, config.num_leds);
+  }
+  active_led_order = order;
+}
+
 void initLEDStrip() {
   // --- FIX ---
   // Removed the "isValidGpioPin(LED_DATA_PIN)" check.
@@ -15,162 +62,179 @@ void initLEDStrip() {
   if (config.num_leds > 0 && config.num_leds <= MAX_LEDS) {
   // --- END FIX ---
   
-      Serial.print("Initializing LED strip on Pin ");
-      Serial.print(LED_DATA_PIN);
-      Serial.print(" with ");
-      Serial.print(config.num_leds);
-      Serial.println(" LEDs.");
+      LOG_INFO("Initializing LED strip on Pin %d with %d LEDs.", LED_DATA_PIN, config.num_leds);
       
       yield();
 
-      Serial.print("Setting LED Color Order to: ");
-      Serial.println(config.led_color_order);
-      if (strcmp(config.led_color_order, "RGB") == 0) {
-          FastLED.addLeds<WS2812B, LED_DATA_PIN, RGB>(leds, config.num_leds).setCorrection(TypicalLEDStrip);
-      } else if (strcmp(config.led_color_order, "BRG") == 0) {
-          FastLED.addLeds<WS2812B, LED_DATA_PIN, BRG>(leds, config.num_leds).setCorrection(TypicalLEDStrip);
-      } else if (strcmp(config.led_color_order, "GBR") == 0) {
-          FastLED.addLeds<WS2812B, LED_DATA_PIN, GBR>(leds, config.num_leds).setCorrection(TypicalLEDStrip);
-      } else if (strcmp(config.led_color_order, "RBG") == 0) {
-          FastLED.addLeds<WS2812B, LED_DATA_PIN, RBG>(leds, config.num_leds).setCorrection(TypicalLEDStrip);
-      } else if (strcmp(config.led_color_order, "BGR") == 0) {
-          FastLED.addLeds<WS2812B, LED_DATA_PIN, BGR>(leds, config.num_leds).setCorrection(TypicalLEDStrip);
-      } else {
-          if (strcmp(config.led_color_order, "GRB") != 0) {
-              Serial.println("Unknown order, defaulting to GRB.");
-          }
-          FastLED.addLeds<WS2812B, LED_DATA_PIN, GRB>(leds, config.num_leds).setCorrection(TypicalLEDStrip);
-      }
+      LOG_INFO("Setting LED Color Order to: %s", config.led_color_order);
+      attachLedStrip();
 
       FastLED.clear();
       FastLED.show();
-      Serial.println("FastLED OK.");
+      LOG_INFO("FastLED OK.");
   } else {
-      Serial.println("WARNING: LED setup skipped due to 0 or too many LEDs.");
+      LOG_WARN("LED setup skipped due to 0 or too many LEDs.");
       config.num_leds = 0; // This is now correct, it only runs if num_leds is 0 or > MAX_LEDS
+      if (active_led_order >= 0) {
+        led_controllers[active_led_order]->setLeds(leds, 0);
+        active_led_order = -1;
+      }
   }
 }
 
-void updateLEDs() {
-  if (config.num_leds <= 0 || config.num_leds > MAX_LEDS) {
+void reconfigureLEDStrip() {
+  // Blank the strip at its old length, so LEDs past a shorter count go dark
+  if (active_led_order >= 0) {
+    FastLED.clear();
+    FastLED.show();
+  }
+  initLEDStrip();
+  refreshLEDs();
+}
+
+void refreshLEDs() {
+  // Colors/brightness or the state behind them changed: recompute the plan
+  markStatusChanged();
+  updateLEDs();
+}
+
+static bool isAnimated(const LedPlan& plan) {
+  return plan.effect == LED_EFFECT_BREATHE || plan.effect == LED_EFFECT_BLINK ||
+         plan.effect == LED_EFFECT_STROBE || plan.effect == LED_EFFECT_DOUBLE_FLASH;
+}
+
+// AMS segment: the loaded trays spread over plan.ams_leds LEDs, the active
+// one at full color and the others dimmed. Shares the strip's brightness.
+static void drawAmsSegment(const LedPlan& plan) {
+  uint8_t trays[AMS_TRAY_COUNT];
+  uint8_t count = amsLoadedTrays(trays);
+  CRGB* segment = leds + plan.main_leds;
+  if (count == 0) {
+    fill_solid(segment, plan.ams_leds, CRGB::Black);
+    return;
+  }
+  uint8_t active = amsTrayNow();
+  for (uint8_t i = 0; i < plan.ams_leds; i++) {
+    uint8_t tray = trays[i * count / plan.ams_leds];
+    segment[i] = CRGB(amsTray(tray).color);
+    if (tray != active) segment[i].nscale8(AMS_INACTIVE_SCALE);
+  }
+}
+
+// Draws the current plan. Runs from updateLEDs() and, while the plan is
+// animated, from the LED_FRAME_MS frame timer.
+static void drawLEDs() {
+  const LedPlan& plan = getLedPlan();
+  if (!isAnimated(plan)) timerStop(TIMER_LED_FRAME);
+
+  if (plan.effect == LED_EFFECT_OFF) {
      if(FastLED.getBrightness() != 0 || leds[0] != CRGB::Black) {
         FastLED.clear();
         FastLED.show();
+        metricsCount(metrics.led_frames_shown);
      }
     return;
   }
-  
-  // Only update animations every 16ms (around 60fps)
-  if (millis() - lastAnimationUpdate < 16) {
-    return;
-  }
-  lastAnimationUpdate = millis();
-
-
-  // --- Animation Logic from Suggestion 1 ---
-
-  if (current_gcode_state == "PAUSED") {
-    
-    // Calculate brightness using a sine wave for a "breathing" effect
-    // millis() / 2000.0f -> One full cycle every 2000ms (2 seconds)
-    // sinf() -> returns a value between -1.0 and 1.0
-    // (sinf(...) + 1.0) / 2.0 -> maps it to 0.0 - 1.0
-    float breath = (sinf(millis() / 2000.0f * 2.0f * PI) + 1.0f) / 2.0f;
-    
-    // We want it to pulse from a minimum brightness (e.g., 20% of max) up to full
-    // So we scale the 0.0-1.0 value to be 0.2-1.0
-    float pulse_scale = 0.2f + (breath * 0.8f); 
-    
-    int new_brightness = (int)(config.led_bright_pause * pulse_scale);
-    
-    FastLED.setBrightness(new_brightness);
-    fill_solid(leds, config.num_leds, CRGB(config.led_color_pause));
-  }
-  else if (current_error_state) {
-    // --- Example: Blinking Error ---
-    // % 1000 > 500 means "on for 500ms, off for 500ms"
-    bool is_on = (millis() % 1000) > 500; 
-    if (is_on) {
-      FastLED.setBrightness(config.led_bright_error);
-      fill_solid(leds, config.num_leds, CRGB(config.led_color_error));
-    } else {
-      FastLED.setBrightness(0);
-      fill_solid(leds, config.num_leds, CRGB::Black);
-    }
-  }
-  // --- End Animation Logic ---
 
-  else if (current_gcode_state == "FINISH") {
-    bool show_finish_light = false;
-    if (config.led_finish_timeout) {
-      if (finishTime > 0 && (millis() - finishTime < FINISH_LIGHT_TIMEOUT)) {
-        show_finish_light = true;
-      }
-    } else {
-      show_finish_light = true;
+  metricsCount(metrics.led_frames_rendered);
+  PROFILE_SCOPE(PROF_LED_UPDATE);
+
+  // Static effects only need writing when the plan changes
+  static uint32_t drawnVersion = 0;
+  bool planChanged = (plan.status_version != drawnVersion);
+  drawnVersion = plan.status_version;
+
+  switch (plan.effect) {
+    case LED_EFFECT_BREATHE: {
+      // Calculate brightness using a sine wave for a "breathing" effect
+      // millis() / 2000.0f -> One full cycle every 2000ms (2 seconds)
+      // sinf() -> returns a value between -1.0 and 1.0
+      // (sinf(...) + 1.0) / 2.0 -> maps it to 0.0 - 1.0
+      float breath = (sinf(millis() / 2000.0f * 2.0f * PI) + 1.0f) / 2.0f;
+      
+      // We want it to pulse from a minimum brightness (e.g., 20% of max) up to full
+      // So we scale the 0.0-1.0 value to be 0.2-1.0
+      float pulse_scale = 0.2f + (breath * 0.8f); 
+      
+      FastLED.setBrightness((int)(plan.bright * pulse_scale));
+      fill_solid(leds, plan.main_leds, CRGB(plan.color));
+      break;
     }
-
-    if (show_finish_light) {
-      FastLED.setBrightness(config.led_bright_finish);
-      fill_solid(leds, config.num_leds, CRGB(config.led_color_finish));
-    } else {
-      FastLED.setBrightness(config.led_bright_idle);
-      fill_solid(leds, config.num_leds, CRGB(config.led_color_idle));
+    case LED_EFFECT_BLINK: {
+      // % 1000 > 500 means "on for 500ms, off for 500ms"
+      bool is_on = (millis() % 1000) > 500; 
+      if (is_on) {
+        FastLED.setBrightness(plan.bright);
+        fill_solid(leds, plan.main_leds, CRGB(plan.color));
+      } else {
+        FastLED.setBrightness(0);
+        fill_solid(leds, plan.main_leds, CRGB::Black);
+      }
+      break;
     }
-  }
-  else if (current_print_percentage > 0 && current_gcode_state != "IDLE") {
-    FastLED.setBrightness(config.led_bright_print);
-    int leds_to_light = map(current_print_percentage, 1, 100, 1, config.num_leds);
-    leds_to_light = constrain(leds_to_light, 0, config.num_leds);
-
-    CRGB targetColor = CRGB(config.led_color_print);
-    // This check prevents re-writing the same data, which can be slow
-    if (leds_to_light > 0 && leds[leds_to_light - 1] != targetColor) {
-        fill_solid(leds, leds_to_light, targetColor);
-        fill_solid(leds + leds_to_light, config.num_leds - leds_to_light, CRGB::Black);
-    } else if (leds_to_light == 0 && leds[0] != CRGB::Black) {
-        fill_solid(leds, config.num_leds, CRGB::Black);
+    case LED_EFFECT_STROBE:
+    case LED_EFFECT_DOUBLE_FLASH: {
+      // Strobe: 4 flashes a second. Double flash: two 150 ms flashes every 2 s.
+      uint32_t t = millis();
+      bool is_on = (plan.effect == LED_EFFECT_STROBE) ? (t % 250) < 125 : (t % 2000) < 450 && (t % 300) < 150;
+      FastLED.setBrightness(is_on ? plan.bright : 0);
+      fill_solid(leds, plan.main_leds, is_on ? CRGB(plan.color) : CRGB::Black);
+      break;
     }
+    case LED_EFFECT_PROGRESS:
+      FastLED.setBrightness(plan.bright);
+      if (planChanged) {
+        fill_solid(leds, plan.progress_leds, CRGB(plan.color));
+        fill_solid(leds + plan.progress_leds, plan.main_leds - plan.progress_leds, CRGB::Black);
+      }
+      break;
+    default:
+      if (planChanged || FastLED.getBrightness() != plan.bright) {
+        FastLED.setBrightness(plan.bright);
+        fill_solid(leds, plan.main_leds, CRGB(plan.color));
+      }
+      break;
   }
-  else {
-    CRGB targetIdleColor = CRGB(config.led_color_idle);
-    // This check prevents re-writing the same data, which can be slow
-     if (FastLED.getBrightness() != config.led_bright_idle || leds[0] != targetIdleColor ) {
-        FastLED.setBrightness(config.led_bright_idle);
-        fill_solid(leds, config.num_leds, targetIdleColor);
-     }
-  }
+  // Effects only write the first plan.main_leds LEDs
+  if (planChanged && plan.ams_leds > 0) drawAmsSegment(plan);
 
   FastLED.show();
+  metricsCount(metrics.led_frames_shown);
 }
 
-void handleFinishTimers() {
-  if (config.chamber_light_finish_timeout && finishTime > 0 &&
-      (millis() - finishTime > FINISH_LIGHT_TIMEOUT)) {
-      
-      if (external_light_is_on) {
-          if (!manual_light_control) {
-              Serial.println("External Light: Finish timeout reached. Turning OFF via loop timer.");
-              setChamberLightState(false);
-          }
-          finishTime = 0; // Reset timer only after action
-      } else {
-          finishTime = 0; // Timer expired, just reset it
-      }
+void updateLEDs() {
+  if (isAnimated(getLedPlan())) {
+    // The frame timer draws from here on, until the plan stops animating
+    if (!timerActive(TIMER_LED_FRAME)) timerStart(TIMER_LED_FRAME, 0, drawLEDs, LED_FRAME_MS);
+    return;
   }
+  drawLEDs();
+}
 
-  if (config.led_finish_timeout && current_gcode_state == "FINISH" &&
-      finishTime > 0 && (millis() - finishTime > FINISH_LIGHT_TIMEOUT)) {
+static void handleFinishTimeout() {
+  if (config.chamber_light_finish_timeout && finishTime > 0) {
+      // A matching rule that sets the light takes precedence over the timeout
+      if (external_light_is_on && !manual_light_control && !getRuleOutcome().light_set) {
+          LOG_INFO("External Light: Finish timeout reached. Turning OFF via timer.");
+          setChamberLightState(false);
+      }
+      finishTime = 0;
+  }
 
-      // Check if LEDs are *already* idle
-      bool already_idle = (FastLED.getBrightness() == config.led_bright_idle &&
-                           leds[0].r == (config.led_color_idle >> 16 & 0xFF) &&
-                           leds[0].g == (config.led_color_idle >> 8 & 0xFF) &&
-                           leds[0].b == (config.led_color_idle & 0xFF) );
+  // The LED plan changes on its own when the finish timeout passes; a new
+  // status version recomputes it for the strip and the status JSON alike
+  markStatusChanged();
+  updateLEDs();
+}
 
-      if (!already_idle) {
-          // Force an update to set LEDs to idle state
-          updateLEDs(); 
-      }
+void scheduleFinishTimeout() {
+  if (finishTime == 0) {
+    timerStop(TIMER_FINISH_TIMEOUT);
+    return;
   }
-}
\ No newline at end of file
+  // Fires the first millisecond the elapsed time exceeds the timeout, which
+  // is when the LED plan and updateAutomaticLight() stop counting it as active
+  unsigned long elapsed = millis() - finishTime;
+  uint32_t remaining = elapsed < FINISH_LIGHT_TIMEOUT ? FINISH_LIGHT_TIMEOUT - elapsed + 1 : 0;
+  timerStart(TIMER_FINISH_TIMEOUT, remaining, handleFinishTimeout);
+}
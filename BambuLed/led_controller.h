@@ -17,9 +17,8 @@ extern int current_print_percentage;
 extern bool current_error_state;
 extern unsigned long finishTime;
 extern const unsigned long FINISH_LIGHT_TIMEOUT;
-extern unsigned long lastAnimationUpdate;
 
-// Add external declarations needed for handleFinishTimers
+// Add external declarations needed for the finish timeout
 extern bool external_light_is_on;
 extern bool manual_light_control;
 
@@ -28,7 +27,12 @@ extern CRGB leds[MAX_LEDS];
 
 // Function declarations
 void initLEDStrip();
+void reconfigureLEDStrip(); // After num_leds / led_color_order changed
+void refreshLEDs();         // Redraw now, e.g. after colors changed
 void updateLEDs();
-void handleFinishTimers();
+void scheduleFinishTimeout(); // After finishTime was set or cleared
+
+// Animated effects are redrawn at this interval (around 60fps)
+const uint32_t LED_FRAME_MS = 16;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "led_plan.h"
+#include "config.h"
+#include "led_controller.h"
+#include "rules.h"
+#include "hms.h"
+#include "ams.h"
+
+// Indexed by LedStatusCode; web/status.js carries the same tables for
+// binary clients.
+static const char* const LED_STATUS_LABELS[] = {
+  "Disabled",
+  "Error (Blinking Red)",
+  "Paused (Pulsing Orange)",
+  "Print Finished (Green)",
+  "Print Finished (Green) (Timing out...)",
+  "Idle (Finish Timeout)",
+  "Printing Progress",
+  "Idle/Off",
+  "HMS Fatal Error (Strobing Red)",
+  "HMS Error (Blinking Red)",
+  "HMS Warning (Double Flash Orange)"
+};
+
+static const char* const LED_STATUS_CLASSES[] = {
+  "disconnected", "error", "warning", "connected", "connected", "light-on", "warning", "light-on",
+  "error", "error", "warning"
+};
+
+static LedPlan plan;
+static bool plan_valid = false;
+
+static void setPlan(LedEffect effect, uint8_t status, uint32_t color, int bright) {
+  plan.effect = effect;
+  plan.status = status;
+  plan.color = color;
+  plan.bright = constrain(bright, 0, 255);
+}
+
+static void computeLedPlan() {
+  memset(&plan, 0, sizeof(plan));
+  plan.status_version = getStatusVersion();
+  // Info-level HMS entries leave the strip alone
+  uint8_t hms = hmsWorstSeverity();
+
+  // The last config.ams_leds LEDs show the loaded filaments, the effect the rest
+  bool stripValid = (config.num_leds > 0 && config.num_leds <= MAX_LEDS);
+  plan.main_leds = stripValid ? config.num_leds : 0;
+  if (stripValid && config.ams_leds > 0 && amsLoadedTrays(nullptr) > 0) {
+    plan.ams_leds = min((int)config.ams_leds, (int)config.num_leds - 1);
+    plan.main_leds -= plan.ams_leds;
+  }
+
+  if (!stripValid) {
+    setPlan(LED_EFFECT_OFF, LED_STATUS_DISABLED, 0, 0);
+  } else if (hms == HMS_SEVERITY_FATAL) {
+    setPlan(LED_EFFECT_STROBE, LED_STATUS_HMS_FATAL, config.led_color_error, config.led_bright_error);
+  } else if (current_error_state) {
+    setPlan(LED_EFFECT_BLINK, LED_STATUS_ERROR, config.led_color_error, config.led_bright_error);
+  } else if (hms == HMS_SEVERITY_SERIOUS) {
+    setPlan(LED_EFFECT_BLINK, LED_STATUS_HMS_SERIOUS, config.led_color_error, config.led_bright_error);
+  } else if (hms == HMS_SEVERITY_COMMON) {
+    setPlan(LED_EFFECT_DOUBLE_FLASH, LED_STATUS_HMS_WARNING, config.led_color_pause, config.led_bright_pause);
+  } else if (current_gcode_state == "PAUSED") {
+    setPlan(LED_EFFECT_BREATHE, LED_STATUS_PAUSED, config.led_color_pause, config.led_bright_pause);
+  } else if (current_gcode_state == "FINISH") {
+    bool timer_active = (finishTime > 0 && (millis() - finishTime < FINISH_LIGHT_TIMEOUT));
+    if (!config.led_finish_timeout) {
+      setPlan(LED_EFFECT_SOLID, LED_STATUS_FINISH, config.led_color_finish, config.led_bright_finish);
+    } else if (timer_active) {
+      setPlan(LED_EFFECT_SOLID, LED_STATUS_FINISH_TIMING_OUT, config.led_color_finish, config.led_bright_finish);
+    } else {
+      // Timeout done, back to the idle color
+      setPlan(LED_EFFECT_SOLID, LED_STATUS_FINISH_TIMEOUT_IDLE, config.led_color_idle, config.led_bright_idle);
+    }
+  } else if (current_print_percentage > 0 && current_gcode_state != "IDLE") {
+    setPlan(LED_EFFECT_PROGRESS, LED_STATUS_PRINTING, config.led_color_print, config.led_bright_print);
+    plan.progress_leds = constrain(map(current_print_percentage, 1, 100, 1, plan.main_leds), 0, plan.main_leds);
+  } else {
+    setPlan(LED_EFFECT_SOLID, LED_STATUS_IDLE, config.led_color_idle, config.led_bright_idle);
+  }
+
+  // User rules recolor or dim whatever effect was picked
+  if (plan.effect != LED_EFFECT_OFF) {
+    const RuleOutcome& rules = getRuleOutcome();
+    if (rules.led_color_set) plan.color = rules.led_color;
+    if (rules.led_bright_set) plan.bright = rules.led_bright;
+  }
+
+  plan.label = LED_STATUS_LABELS[plan.status];
+  plan.css_class = LED_STATUS_CLASSES[plan.status];
+}
+
+const LedPlan& getLedPlan() {
+  if (!plan_valid || plan.status_version != getStatusVersion()) {
+    computeLedPlan();
+    plan_valid = true;
+  }
+  return plan;
+}
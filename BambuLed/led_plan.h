@@ -0,0 +1,38 @@
+#ifndef LED_PLAN_H
+#define LED_PLAN_H
+
+#include <Arduino.h>
+#include "status_cache.h"
+
+// What the LED strip should show for the current printer state. Computed once
+// per status version and shared by the renderer (updateLEDs) and the status
+// JSON / binary frame, so the strip and the UI cannot disagree. User rules (rules.h) can override color and brightness. Any input
+// change (printer state, finishTime, LED config) must be followed by
+// markStatusChanged().
+
+enum LedEffect : uint8_t {
+  LED_EFFECT_OFF = 0,  // Strip disabled
+  LED_EFFECT_SOLID,
+  LED_EFFECT_BREATHE,  // Paused
+  LED_EFFECT_BLINK,    // Error
+  LED_EFFECT_PROGRESS, // First progress_leds LEDs lit
+  LED_EFFECT_STROBE,   // Fatal HMS error
+  LED_EFFECT_DOUBLE_FLASH // HMS warning
+};
+
+struct LedPlan {
+  LedEffect effect;
+  uint8_t status;          // LedStatusCode
+  uint32_t color;          // 0xRRGGBB
+  uint8_t bright;
+  uint16_t progress_leds;  // LED_EFFECT_PROGRESS only
+  uint16_t main_leds;      // LEDs the effect is drawn on
+  uint8_t ams_leds;        // LEDs after them showing AMS filament colors, 0 for none
+  const char* label;
+  const char* css_class;
+  uint32_t status_version; // Version the plan was computed for
+};
+
+const LedPlan& getLedPlan();
+
+#endif
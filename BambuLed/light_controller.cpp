@@ -1,9 +1,17 @@
 #include "light_controller.h"
 #include "config.h"
+#include "status_cache.h"
+#include "rules.h"
 
 // External declarations (from main)
 extern bool external_light_is_on;
 extern bool manual_light_control;
+extern String current_light_mode;
+extern unsigned long finishTime;
+extern const unsigned long FINISH_LIGHT_TIMEOUT;
+
+// Brightness currently output, in percent (0 while off)
+static int light_level = 0;
 
 // External declarations (from config)
 extern WiFiManagerParameter custom_bbl_pin;
@@ -29,15 +37,53 @@ void reinitHardwareIfNeeded() {
   }
 }
 
-void setChamberLightState(bool lightShouldBeOn) {
+void reconfigureChamberLight(int oldPin) {
+  bool wasOn = external_light_is_on;
+  Serial.printf("Re-initializing light PWM (GPIO %d -> %d).\n", oldPin, config.chamber_light_pin);
+  ledcDetach(oldPin);
+  setupChamberLightPWM(config.chamber_light_pin);
+  setChamberLightState(wasOn);
+}
+
+static void writeChamberLight(bool lightShouldBeOn, int percent) {
   int pwm_value = 0;
   if (lightShouldBeOn) {
-    pwm_value = map(config.chamber_pwm_brightness, 0, 100, 0, 255);
+    pwm_value = map(constrain(percent, 0, 100), 0, 100, 0, 255);
   }
   int output_pwm = (config.invert_output) ? (255 - pwm_value) : pwm_value;
   output_pwm = constrain(output_pwm, 0, 255);
   ledcWrite(config.chamber_light_pin, output_pwm);
   external_light_is_on = lightShouldBeOn;
+  light_level = lightShouldBeOn ? constrain(percent, 0, 100) : 0;
+  markStatusChanged();
+}
+
+void setChamberLightState(bool lightShouldBeOn) {
+  writeChamberLight(lightShouldBeOn, config.chamber_pwm_brightness);
+}
+
+int getChamberLightLevel() {
+  return light_level;
+}
+
+void updateAutomaticLight() {
+  if (manual_light_control) return;
+
+  bool lightShouldBeOn = (current_light_mode == "on" || current_light_mode == "flashing");
+  if (config.chamber_light_finish_timeout && finishTime > 0) {
+      lightShouldBeOn = (millis() - finishTime < FINISH_LIGHT_TIMEOUT);
+  }
+  int level = config.chamber_pwm_brightness;
+
+  const RuleOutcome& rules = getRuleOutcome();
+  if (rules.light_set) {
+      level = rules.light_percent;
+      lightShouldBeOn = level > 0;
+  }
+
+  if (lightShouldBeOn != external_light_is_on || (lightShouldBeOn && level != light_level)) {
+      writeChamberLight(lightShouldBeOn, level);
+  }
 }
 
 void setupChamberLightPWM(int pin) {
@@ -46,5 +92,7 @@ void setupChamberLightPWM(int pin) {
     int off_value = config.invert_output ? 255 : 0;
     ledcWrite(pin, off_value);
     external_light_is_on = false;
+    light_level = 0;
+    markStatusChanged();
     Serial.printf("PWM enabled on GPIO %d. OFF value: %d\n", pin, off_value);
 }
\ No newline at end of file
@@ -15,7 +15,10 @@ extern WiFiManagerParameter custom_bbl_pin;
 // Function declarations
 void initChamberLight();
 void reinitHardwareIfNeeded();
-void setChamberLightState(bool lightShouldBeOn);
+void setChamberLightState(bool lightShouldBeOn); // At the configured brightness
+void updateAutomaticLight(); // Printer light mode, finish timeout and rules; no-op in manual mode
+int getChamberLightLevel();  // Percent currently output, 0 while off
 void setupChamberLightPWM(int pin);
+void reconfigureChamberLight(int oldPin); // After pin / invert changed
 
 #endif
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include "logger.h"
+#include "mqtt_history.h"
+#include "web_handlers.h"
+#include "chunked_response.h"
+#include <LittleFS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#include <stdarg.h>
+
+static_assert((LOG_RING_SLOTS & (LOG_RING_SLOTS - 1)) == 0, "LOG_RING_SLOTS must be a power of two");
+static_assert(LOG_LINE_MAX <= 255, "LogCell::length is a uint8_t");
+
+uint8_t log_level = LOG_LEVEL_INFO;
+uint8_t log_level_file = LOG_LEVEL_NONE;
+uint8_t log_level_history = LOG_LEVEL_NONE;
+
+static const char* const LEVEL_NAMES[LOG_LEVEL_COUNT] = { "none", "error", "warn", "info", "debug" };
+static const char* const LEVEL_PREFIXES[LOG_LEVEL_COUNT] = { "", "ERROR: ", "WARN: ", "", "DEBUG: " };
+
+// --- Ring ---
+// Bounded multi-producer queue (one consumer at a time). Write position p
+// maps to cell p % LOG_RING_SLOTS on lap p / LOG_RING_SLOTS. A cell's turn is
+// 2 * lap while it is free for that lap's writer and 2 * lap + 1 once the
+// line is ready to drain. Turns count modulo TURN_MASK + 1, so they keep
+// working when the 32-bit position wraps.
+
+struct LogCell {
+  std::atomic<uint32_t> turn;
+  uint32_t ms;
+  uint8_t level;
+  uint8_t length;
+  char text[LOG_LINE_MAX];
+};
+
+static const uint32_t TURN_MASK = (0xFFFFFFFFu / LOG_RING_SLOTS) * 2 + 1;
+
+static LogCell ring[LOG_RING_SLOTS];
+static std::atomic<uint32_t> write_pos(0);
+static std::atomic<uint32_t> read_pos(0);
+static std::atomic_flag draining = ATOMIC_FLAG_INIT; // Held by the one consumer
+
+static std::atomic<uint32_t> stat_written(0);
+static std::atomic<uint32_t> stat_dropped(0);
+static std::atomic<uint32_t> stat_truncated(0);
+static std::atomic<uint32_t> stat_max_depth(0);
+static uint32_t stat_drained = 0;    // Consumer only
+static uint32_t stat_file_bytes = 0; // Consumer only
+
+static TaskHandle_t loop_task = nullptr; // The history sink is not thread-safe
+
+static inline uint32_t turnOf(uint32_t pos) {
+  return (2 * (pos / LOG_RING_SLOTS)) & TURN_MASK;
+}
+
+void logWrite(uint8_t level, const char* format, ...) {
+  uint32_t pos = write_pos.load(std::memory_order_relaxed);
+  LogCell* cell;
+  for (;;) {
+    cell = &ring[pos % LOG_RING_SLOTS];
+    uint32_t want = turnOf(pos);
+    uint32_t ahead = (cell->turn.load(std::memory_order_acquire) - want) & TURN_MASK;
+    if (ahead == 0) {
+      if (write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (ahead > TURN_MASK / 2) {
+      // Still holds last lap's line: full, and logging never waits
+      stat_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      pos = write_pos.load(std::memory_order_relaxed); // Another task took this position
+    }
+  }
+
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(cell->text, sizeof(cell->text), format, args);
+  va_end(args);
+  if (n < 0) n = 0;
+  if (n >= (int)sizeof(cell->text)) {
+    n = sizeof(cell->text) - 1;
+    stat_truncated.fetch_add(1, std::memory_order_relaxed);
+  }
+  while (n > 0 && cell->text[n - 1] == '\n') n--; // Sinks end the line themselves
+  cell->text[n] = '\0';
+  cell->length = n;
+  cell->level = level;
+  cell->ms = millis();
+
+  if (level <= log_level_history && xTaskGetCurrentTaskHandle() == loop_task) {
+    mqttHistoryPrintf(level <= LOG_LEVEL_WARN, "%s", cell->text);
+  }
+
+  cell->turn.store(turnOf(pos) + 1, std::memory_order_release);
+  stat_written.fetch_add(1, std::memory_order_relaxed);
+  uint32_t depth = pos + 1 - read_pos.load(std::memory_order_relaxed);
+  uint32_t max_depth = stat_max_depth.load(std::memory_order_relaxed);
+  while (depth > max_depth && !stat_max_depth.compare_exchange_weak(max_depth, depth, std::memory_order_relaxed)) {
+  }
+}
+
+// --- Sinks (consumer side) ---
+
+static File log_file;
+
+static void appendFile(const LogCell& cell, const char* line, size_t length) {
+  if (!log_file) {
+    log_file = LittleFS.open(LOG_FILE_PATH, "a");
+    if (!log_file) return;
+  }
+  if (log_file.size() >= LOG_FILE_MAX_BYTES) {
+    log_file.close();
+    LittleFS.remove(LOG_FILE_OLD_PATH);
+    LittleFS.rename(LOG_FILE_PATH, LOG_FILE_OLD_PATH);
+    log_file = LittleFS.open(LOG_FILE_PATH, "a");
+    if (!log_file) return;
+  }
+  char stamp[16];
+  int n = snprintf(stamp, sizeof(stamp), "%10u ", (unsigned)cell.ms);
+  stat_file_bytes += log_file.write((const uint8_t*)stamp, n);
+  stat_file_bytes += log_file.write((const uint8_t*)line, length);
+}
+
+static void drainRing() {
+  static char line[LOG_LINE_MAX + 16];
+  uint32_t pos = read_pos.load(std::memory_order_relaxed);
+  for (;;) {
+    LogCell& cell = ring[pos % LOG_RING_SLOTS];
+    uint32_t ready = turnOf(pos) + 1;
+    if (cell.turn.load(std::memory_order_acquire) != ready) break;
+
+    uint8_t level = cell.level < LOG_LEVEL_COUNT ? cell.level : LOG_LEVEL_DEBUG;
+    int n = snprintf(line, sizeof(line), "%s%s\n", LEVEL_PREFIXES[level], cell.text);
+    size_t length = min((size_t)max(n, 0), sizeof(line) - 1);
+    Serial.write((const uint8_t*)line, length);
+    if (level <= log_level_file) appendFile(cell, line, length);
+
+    cell.turn.store((ready + 1) & TURN_MASK, std::memory_order_release);
+    read_pos.store(++pos, std::memory_order_relaxed);
+    stat_drained++;
+  }
+  if (log_file) log_file.close(); // Lets the web server read or delete it
+}
+
+static void logTask(void*) {
+  for (;;) {
+    if (!draining.test_and_set(std::memory_order_acquire)) {
+      drainRing();
+      draining.clear(std::memory_order_release);
+    }
+    vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL_MS));
+  }
+}
+
+void setupLog() {
+  loop_task = xTaskGetCurrentTaskHandle();
+  // Below loop(), so draining only uses time loop() leaves idle
+  if (xTaskCreate(logTask, "log", LOG_TASK_STACK, nullptr, LOG_TASK_PRIORITY, nullptr) != pdPASS) {
+    Serial.println("Log task not started, logging drains from logFlush() only.");
+  }
+}
+
+void logFlush() {
+  while (draining.test_and_set(std::memory_order_acquire)) vTaskDelay(1);
+  drainRing();
+  draining.clear(std::memory_order_release);
+}
+
+LogStats getLogStats() {
+  LogStats s;
+  s.written = stat_written.load(std::memory_order_relaxed);
+  s.dropped = stat_dropped.load(std::memory_order_relaxed);
+  s.truncated = stat_truncated.load(std::memory_order_relaxed);
+  s.drained = stat_drained;
+  s.max_depth = stat_max_depth.load(std::memory_order_relaxed);
+  s.file_bytes = stat_file_bytes;
+  return s;
+}
+
+uint8_t logDepth() {
+  return write_pos.load(std::memory_order_relaxed) - read_pos.load(std::memory_order_relaxed);
+}
+
+const char* logLevelName(uint8_t level) {
+  return level < LOG_LEVEL_COUNT ? LEVEL_NAMES[level] : "?";
+}
+
+bool logLevelFromName(const char* name, uint8_t* out) {
+  for (uint8_t i = 0; i < LOG_LEVEL_COUNT; i++) {
+    if (strcmp(name, LEVEL_NAMES[i]) == 0) {
+      *out = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// --- HTTP ---
+
+void handleLogJson() {
+  static const char* const args[] = { "serial", "file", "history" };
+  uint8_t* levels[] = { &log_level, &log_level_file, &log_level_history };
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!server.hasArg(args[i])) continue;
+    if (!logLevelFromName(server.arg(args[i]).c_str(), levels[i])) {
+      server.send(400, "text/plain", "Levels are none, error, warn, info or debug.");
+      return;
+    }
+  }
+
+  // ?bench=N: cost of N log calls, filtered and queued, against Serial.printf
+  long iterations = server.hasArg("bench") ? constrain(server.arg("bench").toInt(), 1L, 10000L) : 0;
+  uint32_t filtered_us = 0, queued_us = 0, serial_us = 0;
+  const long SERIAL_LINES = 4;
+  if (iterations) {
+    uint8_t saved = log_level;
+    log_level = LOG_LEVEL_ERROR;
+    uint32_t start = micros();
+    for (long i = 0; i < iterations; i++) LOG_AT(LOG_LEVEL_INFO, "log bench %ld: %s %.1f %u", i, "RUNNING", 215.5f, (unsigned)millis());
+    filtered_us = micros() - start;
+    log_level = saved;
+
+    // In batches that fit the ring, so nothing is dropped
+    for (long done = 0; done < iterations;) {
+      logFlush();
+      long batch = min(iterations - done, (long)LOG_RING_SLOTS);
+      start = micros();
+      for (long i = 0; i < batch; i++) logWrite(LOG_LEVEL_INFO, "log bench %ld: %s %.1f %u", done + i, "RUNNING", 215.5f, (unsigned)millis());
+      queued_us += micros() - start;
+      done += batch;
+    }
+    logFlush();
+
+    Serial.flush();
+    start = micros();
+    for (long i = 0; i < SERIAL_LINES; i++) Serial.printf("log bench %ld: %s %.1f %u\n", i, "RUNNING", 215.5f, (unsigned)millis());
+    Serial.flush(); // Until the last byte is on the wire
+    serial_us = micros() - start;
+  }
+
+  LogStats s = getLogStats();
+  ChunkedResponse out(server);
+  out.begin(200, "application/json");
+  out.printf("{\"level\":{\"compiled\":\"%s\",\"serial\":\"%s\",\"file\":\"%s\",\"history\":\"%s\"},",
+             logLevelName(LOG_LEVEL_MAX), logLevelName(log_level), logLevelName(log_level_file),
+             logLevelName(log_level_history));
+  out.printf("\"ring_slots\":%u,\"line_max\":%u,\"depth\":%u,\"max_depth\":%u,", (unsigned)LOG_RING_SLOTS,
+             (unsigned)LOG_LINE_MAX, logDepth(), (unsigned)s.max_depth);
+  out.printf("\"written\":%u,\"dropped\":%u,\"truncated\":%u,\"drained\":%u,\"file_bytes\":%u",
+             (unsigned)s.written, (unsigned)s.dropped, (unsigned)s.truncated, (unsigned)s.drained,
+             (unsigned)s.file_bytes);
+  if (iterations) {
+    out.printf(",\"bench\":{\"iterations\":%ld,\"filtered_ns\":%.1f,\"queued_us\":%.2f,\"serial_printf_us\":%.1f}",
+               iterations, filtered_us * 1000.0 / iterations, (double)queued_us / iterations,
+               (double)serial_us / SERIAL_LINES);
+  }
+  out.print("}");
+  out.end();
+}
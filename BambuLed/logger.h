@@ -0,0 +1,78 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Leveled logging that keeps Serial out of the hot paths. A log call formats
+// its line into a lock-free ring (any task may log) and returns; a
+// low-priority task drains the ring to Serial and, optionally, a LittleFS
+// file. At 115200 baud a 60-character line takes ~5 ms to send, which
+// loop() no longer waits for.
+//
+//   LOG_INFO("MQTT connected to %s", config.bbl_ip);
+//
+// Calls above LOG_LEVEL_MAX (config.h) compile out entirely. The rest are
+// checked against the runtime level first, so a filtered call costs one
+// compare and its arguments are not evaluated. When the ring is full the
+// line is dropped and counted, never waited for. /log.json shows the
+// counters, sets the runtime levels and benchmarks a call (?bench=N).
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+#define LOG_LEVEL_COUNT 5
+
+// Runtime levels. log_level also bounds the other sinks: only captured lines
+// can reach them.
+extern uint8_t log_level;         // Captured and sent to Serial
+extern uint8_t log_level_file;    // Also appended to LOG_FILE_PATH (default none)
+extern uint8_t log_level_history; // Also added to the /mqtt history (default none)
+
+struct LogStats {
+  uint32_t written;
+  uint32_t dropped;   // Ring full
+  uint32_t truncated; // Longer than LOG_LINE_MAX
+  uint32_t drained;
+  uint32_t max_depth; // Most lines waiting at once
+  uint32_t file_bytes;
+};
+
+void logWrite(uint8_t level, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+#define LOG_AT(level, ...) do { if ((level) <= log_level) logWrite((level), __VA_ARGS__); } while (0)
+
+#if LOG_LEVEL_MAX >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+#if LOG_LEVEL_MAX >= LOG_LEVEL_WARN
+#define LOG_WARN(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+#if LOG_LEVEL_MAX >= LOG_LEVEL_INFO
+#define LOG_INFO(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+#if LOG_LEVEL_MAX >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+void setupLog();  // Starts the drain task; lines logged before are kept
+void logFlush();  // Drains the ring from the calling task, e.g. before a restart
+LogStats getLogStats();
+uint8_t logDepth(); // Lines waiting in the ring
+
+const char* logLevelName(uint8_t level);
+bool logLevelFromName(const char* name, uint8_t* out);
+
+void handleLogJson(); // GET /log.json[?serial=|file=|history=<level>][&bench=N]
+
+#endif
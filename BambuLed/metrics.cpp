@@ -0,0 +1,279 @@
+#include "metrics.h"
+#include "web_handlers.h"
+#include "chunked_response.h"
+#include "ws_broadcaster.h"
+#include "sse_broadcaster.h"
+#include "boot_timing.h"
+#include "rules.h"
+#include "heap_guard.h"
+#include "json_pool.h"
+#include "mqtt_handler.h"
+#include "printer_commands.h"
+#include "mqtt_bridge.h"
+#include "logger.h"
+#include "hms.h"
+#include "ams.h"
+
+static const uint32_t PARSE_BOUNDS_US[] = { 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000 };
+static const uint32_t CONNECT_BOUNDS_US[] = { 100000, 250000, 500000, 1000000, 2000000, 5000000, 10000000 };
+static const uint32_t COMMAND_BOUNDS_US[] = { 50000, 100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000 };
+static const uint32_t WEB_ASSET_BOUNDS_US[] = { 250, 500, 1000, 2500, 5000, 10000, 25000, 50000 };
+static const uint32_t LOOP_BOUNDS_US[] = { 100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000 };
+
+#define COUNT_OF(a) (sizeof(a) / sizeof((a)[0]))
+
+Metrics metrics;
+MetricHistogram mqtt_parse_histogram(PARSE_BOUNDS_US, COUNT_OF(PARSE_BOUNDS_US));
+MetricHistogram mqtt_connect_histogram(CONNECT_BOUNDS_US, COUNT_OF(CONNECT_BOUNDS_US));
+MetricHistogram loop_histogram(LOOP_BOUNDS_US, COUNT_OF(LOOP_BOUNDS_US));
+MetricHistogram printer_command_histogram(COMMAND_BOUNDS_US, COUNT_OF(COMMAND_BOUNDS_US));
+MetricHistogram web_asset_histogram(WEB_ASSET_BOUNDS_US, COUNT_OF(WEB_ASSET_BOUNDS_US));
+
+// Message rate over the last complete window
+const uint32_t MQTT_RATE_WINDOW_MS = 10000;
+static float mqtt_messages_per_second = 0;
+static float loop_wakeups_per_second = 0;
+
+MetricHistogram::MetricHistogram(const uint32_t* bounds_us, uint8_t count)
+    : _bounds(bounds_us), _count(min(count, (uint8_t)METRICS_MAX_BUCKETS)), _total(0), _sum_us(0) {
+  for (auto& b : _buckets) b.store(0, std::memory_order_relaxed);
+}
+
+void MetricHistogram::observe(uint32_t us) {
+  uint8_t i = 0;
+  while (i < _count && us > _bounds[i]) i++;
+  _buckets[i].fetch_add(1, std::memory_order_relaxed);
+  _total.fetch_add(1, std::memory_order_relaxed);
+  _sum_us += us;
+}
+
+void metricsLoopTick() {
+  static uint32_t last_loop_us = 0;
+  static uint32_t window_start_ms = 0;
+  static uint32_t window_start_count = 0;
+  static uint32_t window_start_loops = 0;
+
+  uint32_t now_us = micros();
+  if (last_loop_us != 0) loop_histogram.observe(now_us - last_loop_us);
+  last_loop_us = now_us;
+  metricsCount(metrics.loop_iterations);
+
+  uint32_t now_ms = millis();
+  if (now_ms - window_start_ms >= MQTT_RATE_WINDOW_MS) {
+    uint32_t count = metrics.mqtt_messages.load(std::memory_order_relaxed);
+    uint32_t loops = metrics.loop_iterations.load(std::memory_order_relaxed);
+    mqtt_messages_per_second = (count - window_start_count) * 1000.0f / (now_ms - window_start_ms);
+    loop_wakeups_per_second = (loops - window_start_loops) * 1000.0f / (now_ms - window_start_ms);
+    window_start_count = count;
+    window_start_loops = loops;
+    window_start_ms = now_ms;
+  }
+}
+
+// --- Rendering ---
+
+// Written piecewise: help texts are free-length
+static void printHeader(ChunkedResponse& out, const char* name, const char* type, const char* help) {
+  out.print("# HELP ");
+  out.print(name);
+  out.print(" ");
+  out.print(help);
+  out.print("\n# TYPE ");
+  out.print(name);
+  out.print(" ");
+  out.print(type);
+  out.print("\n");
+}
+
+static void printValue(ChunkedResponse& out, const char* name, const char* type, const char* help, uint32_t value) {
+  printHeader(out, name, type, help);
+  out.printf("%s %u\n", name, (unsigned)value);
+}
+
+static void printHistogram(ChunkedResponse& out, const char* name, const char* help, const MetricHistogram& h) {
+  printHeader(out, name, "histogram", help);
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i < h.boundCount(); i++) {
+    cumulative += h.bucket(i);
+    out.printf("%s_bucket{le=\"%g\"} %u\n", name, h.bounds()[i] / 1e6, (unsigned)cumulative);
+  }
+  cumulative += h.bucket(h.boundCount());
+  out.printf("%s_bucket{le=\"+Inf\"} %u\n", name, (unsigned)cumulative);
+  out.printf("%s_sum %.6f\n", name, h.sumUs() / 1e6);
+  out.printf("%s_count %u\n", name, (unsigned)h.count());
+}
+
+void handleMetrics() {
+  ChunkedResponse out(server);
+  out.begin(200, "text/plain; version=0.0.4");
+
+  printValue(out, "bambuled_uptime_seconds", "gauge", "Seconds since boot.", millis() / 1000);
+  printValue(out, "bambuled_heap_free_bytes", "gauge", "Free internal heap.", ESP.getFreeHeap());
+  printValue(out, "bambuled_heap_min_free_bytes", "gauge", "Lowest free heap since boot.", ESP.getMinFreeHeap());
+  printValue(out, "bambuled_heap_max_alloc_bytes", "gauge", "Largest allocatable heap block.", ESP.getMaxAllocHeap());
+  printValue(out, "bambuled_psram_size_bytes", "gauge", "Total PSRAM (0 if none).", ESP.getPsramSize());
+  printValue(out, "bambuled_psram_free_bytes", "gauge", "Free PSRAM.", ESP.getFreePsram());
+  if (mqtt_internal_heap_min_free != UINT32_MAX) {
+    printValue(out, "bambuled_mqtt_internal_heap_min_free_bytes", "gauge",
+               "Lowest free internal heap seen right after handling a report.", mqtt_internal_heap_min_free);
+  }
+
+  const JsonPoolStats& pool = getJsonPoolStats();
+  printValue(out, "bambuled_json_pool_psram_bytes", "gauge", "Pooled JSON document memory placed in PSRAM.",
+             pool.psram_bytes);
+  printValue(out, "bambuled_json_pool_borrows_total", "counter", "JSON documents borrowed from the pool.", pool.borrows);
+  printValue(out, "bambuled_json_pool_misses_total", "counter",
+             "Borrows that found the pool empty and allocated a temporary document.", pool.misses);
+  printValue(out, "bambuled_json_pool_max_in_use", "gauge", "Most JSON documents borrowed at once.", pool.max_in_use);
+  printValue(out, "bambuled_json_alloc_calls_total", "counter", "JSON document malloc/realloc/free calls.",
+             pool.alloc_calls);
+  printHeader(out, "bambuled_json_alloc_seconds_total", "counter", "Time spent in those calls.");
+  out.printf("bambuled_json_alloc_seconds_total %.6f\n", pool.alloc_us / 1e6);
+#if ZERO_HEAP_AFTER_BOOT
+  printValue(out, "bambuled_heap_guard_available", "gauge", "1 if post-boot allocations are being counted.",
+             heapGuardAvailable() ? 1 : 0);
+  printHeader(out, "bambuled_heap_guard_allocations_total", "counter",
+              "Heap allocations on the loop task since setup(); scope=\"loop\" should stay 0.");
+  out.printf("bambuled_heap_guard_allocations_total{scope=\"loop\"} %u\n", (unsigned)heapGuardAllocs());
+  out.printf("bambuled_heap_guard_allocations_total{scope=\"exempt\"} %u\n", (unsigned)heapGuardExemptAllocs());
+  printValue(out, "bambuled_heap_guard_last_alloc_bytes", "gauge", "Size of the last counted loop allocation.",
+             heapGuardLastAllocSize());
+#endif
+
+  printHeader(out, "bambuled_config_load_seconds", "gauge", "Duration of the boot-time config load.");
+  out.printf("bambuled_config_load_seconds %.6f\n", config_load_us / 1e6);
+  printHeader(out, "bambuled_config_save_seconds", "gauge", "Duration of the last config save.");
+  out.printf("bambuled_config_save_seconds %.6f\n", config_save_us / 1e6);
+  printHeader(out, "bambuled_boot_phase_seconds", "gauge", "Time since power-on at which each startup phase completed.");
+  for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+    uint32_t ms = bootMarkMs((BootPhase)i);
+    if (ms) out.printf("bambuled_boot_phase_seconds{phase=\"%s\"} %.3f\n", bootPhaseName((BootPhase)i), ms / 1e3);
+  }
+
+  printValue(out, "bambuled_mqtt_messages_total", "counter", "MQTT messages received.",
+             metrics.mqtt_messages.load(std::memory_order_relaxed));
+  printHeader(out, "bambuled_mqtt_messages_per_second", "gauge", "MQTT message rate over the last 10 s.");
+  out.printf("bambuled_mqtt_messages_per_second %.2f\n", mqtt_messages_per_second);
+  printValue(out, "bambuled_mqtt_parse_errors_total", "counter", "MQTT messages that failed to parse.",
+             metrics.mqtt_parse_errors.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_mqtt_budget_rejects_total", "counter",
+             "MQTT messages dropped for exceeding the size, nesting or element budget.",
+             metrics.mqtt_budget_rejects.load(std::memory_order_relaxed));
+  printHistogram(out, "bambuled_mqtt_parse_seconds", "Time to parse and apply one MQTT message.", mqtt_parse_histogram);
+  printValue(out, "bambuled_mqtt_connect_attempts_total", "counter", "MQTT (re)connect attempts.",
+             metrics.mqtt_connect_attempts.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_mqtt_connects_total", "counter", "Successful MQTT connects.",
+             metrics.mqtt_connects.load(std::memory_order_relaxed));
+  printHistogram(out, "bambuled_mqtt_connect_seconds", "TLS handshake plus MQTT CONNECT time of successful connects.",
+                 mqtt_connect_histogram);
+  printValue(out, "bambuled_mqtt_connected", "gauge", "1 while connected to the printer.", client.connected() ? 1 : 0);
+
+  const PrinterCommandStats& cmds = getPrinterCommandStats();
+  printHeader(out, "bambuled_printer_commands_total", "counter", "Printer commands by outcome.");
+  out.printf("bambuled_printer_commands_total{outcome=\"done\"} %u\n", (unsigned)cmds.done);
+  out.printf("bambuled_printer_commands_total{outcome=\"failed\"} %u\n", (unsigned)cmds.failed);
+  out.printf("bambuled_printer_commands_total{outcome=\"timed_out\"} %u\n", (unsigned)cmds.timed_out);
+  out.printf("bambuled_printer_commands_total{outcome=\"dropped\"} %u\n", (unsigned)cmds.dropped);
+  out.printf("bambuled_printer_commands_total{outcome=\"rejected\"} %u\n", (unsigned)cmds.rejected);
+  printValue(out, "bambuled_printer_command_publishes_total", "counter", "Printer command publishes, retries included.",
+             cmds.sent);
+  printValue(out, "bambuled_printer_command_retries_total", "counter", "Printer commands sent again after no reply.",
+             cmds.retries);
+  printValue(out, "bambuled_printer_commands_pending", "gauge", "Printer commands queued or awaiting a reply.",
+             printerCommandsPending());
+  printHistogram(out, "bambuled_printer_command_seconds", "Printer command round trip, last publish to reply.",
+                 printer_command_histogram);
+  printValue(out, "bambuled_hms_entries", "gauge", "Printer health (HMS) codes currently reported.", hmsReported());
+  printValue(out, "bambuled_hms_worst_severity", "gauge", "Most severe active HMS code: 1 fatal ... 4 info, 0 none.",
+             hmsWorstSeverity());
+  const AmsStats& ams = getAmsStats();
+  printValue(out, "bambuled_ams_scans_total", "counter", "Reports whose raw AMS section was hashed.", ams.scans);
+  printValue(out, "bambuled_ams_skips_total", "counter", "AMS sections unchanged since the last parse, not parsed.",
+             ams.skips);
+  printValue(out, "bambuled_ams_parses_total", "counter", "AMS sections parsed into the tray model.", ams.parses);
+  printValue(out, "bambuled_ams_scan_microseconds", "gauge", "Time to hash the last AMS section.", ams.last_scan_us);
+  printValue(out, "bambuled_ams_parse_microseconds", "gauge", "Time to parse the last changed AMS section.",
+             ams.last_parse_us);
+  printValue(out, "bambuled_ams_loaded_trays", "gauge", "AMS trays with filament loaded.", amsLoadedTrays(nullptr));
+
+  if (mqttBridgeEnabled()) {
+    const MqttBridgeStats& bridge = getMqttBridgeStats();
+    printValue(out, "bambuled_bridge_connected", "gauge", "1 while connected to the home-automation broker.",
+               mqttBridgeConnected() ? 1 : 0);
+    printValue(out, "bambuled_bridge_connects_total", "counter", "Successful home-automation broker connects.",
+               bridge.connects);
+    printValue(out, "bambuled_bridge_connect_failures_total", "counter", "Failed home-automation broker connects.",
+               bridge.connect_failures);
+    printValue(out, "bambuled_bridge_passes_total", "counter", "Bridge publish passes over changed fields.",
+               bridge.passes);
+    printValue(out, "bambuled_bridge_publishes_total", "counter", "Field values published to the broker.",
+               bridge.publishes);
+    printValue(out, "bambuled_bridge_publish_failures_total", "counter", "Bridge publishes that failed.",
+               bridge.publish_failures);
+    printValue(out, "bambuled_bridge_deadband_skips_total", "counter",
+               "Temperature changes not published for being under the deadband.", bridge.deadband_skips);
+    printValue(out, "bambuled_bridge_bytes_total", "counter", "Payload bytes published to the broker.", bridge.bytes);
+  }
+
+  LogStats log = getLogStats();
+  printValue(out, "bambuled_log_lines_total", "counter", "Log lines queued.", log.written);
+  printValue(out, "bambuled_log_dropped_total", "counter", "Log lines dropped because the ring was full.", log.dropped);
+  printValue(out, "bambuled_log_drained_total", "counter", "Log lines written out by the drain task.", log.drained);
+  printValue(out, "bambuled_log_depth", "gauge", "Log lines waiting to be drained.", logDepth());
+  printValue(out, "bambuled_log_max_depth", "gauge", "Most log lines waiting at once since boot.", log.max_depth);
+
+#if ENABLE_WEBSOCKET
+  uint32_t ws_clients = 0;
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    if (getWsClientStats(num).connected) ws_clients++;
+  }
+  printValue(out, "bambuled_websocket_clients", "gauge", "Connected WebSocket clients.", ws_clients);
+  printValue(out, "bambuled_websocket_frames_sent_total", "counter", "Status frames sent to WebSocket clients.",
+             metrics.ws_frames_sent.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_websocket_bytes_sent_total", "counter", "Status bytes sent to WebSocket clients.",
+             metrics.ws_bytes_sent.load(std::memory_order_relaxed));
+#endif
+  printValue(out, "bambuled_sse_clients", "gauge", "Connected /events streams.", getSseClientCount());
+  printValue(out, "bambuled_sse_events_sent_total", "counter", "Status events sent on /events streams.",
+             metrics.sse_events_sent.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_sse_bytes_sent_total", "counter", "Bytes sent on /events streams, heartbeats included.",
+             metrics.sse_bytes_sent.load(std::memory_order_relaxed));
+  printHeader(out, "bambuled_web_asset_responses_total", "counter", "Static asset (page shell, CSS, JS) responses by status.");
+  out.printf("bambuled_web_asset_responses_total{code=\"200\"} %u\n",
+             (unsigned)metrics.web_asset_sent.load(std::memory_order_relaxed));
+  out.printf("bambuled_web_asset_responses_total{code=\"304\"} %u\n",
+             (unsigned)metrics.web_asset_not_modified.load(std::memory_order_relaxed));
+  out.printf("bambuled_web_asset_responses_total{code=\"406\"} %u\n",
+             (unsigned)metrics.web_asset_not_acceptable.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_web_asset_bytes_sent_total", "counter", "Gzipped static asset bytes sent.",
+             metrics.web_asset_bytes_sent.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_web_asset_uncompressed_bytes_total", "counter",
+             "Bytes the same static asset responses would have been uncompressed.",
+             metrics.web_asset_bytes_uncompressed.load(std::memory_order_relaxed));
+  printHistogram(out, "bambuled_web_asset_seconds", "Static asset handler time, 304s and 406s included.",
+                 web_asset_histogram);
+  printValue(out, "bambuled_status_version", "counter", "Status changes since boot.", getStatusVersion());
+
+  printValue(out, "bambuled_led_frames_rendered_total", "counter", "LED frames computed.",
+             metrics.led_frames_rendered.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_led_frames_shown_total", "counter", "LED frames pushed to the strip.",
+             metrics.led_frames_shown.load(std::memory_order_relaxed));
+
+  printValue(out, "bambuled_rules_evaluations_total", "counter", "Rule table evaluations (one per status change).",
+             rules_eval_count);
+  printHeader(out, "bambuled_rules_eval_seconds", "gauge", "Duration of the last rule table evaluation.");
+  out.printf("bambuled_rules_eval_seconds %.6f\n", rules_eval_us / 1e6);
+
+  printValue(out, "bambuled_loop_iterations_total", "counter", "loop() iterations.",
+             metrics.loop_iterations.load(std::memory_order_relaxed));
+  printHeader(out, "bambuled_loop_wakeups_per_second", "gauge", "loop() iterations per second over the last 10 s.");
+  out.printf("bambuled_loop_wakeups_per_second %.2f\n", loop_wakeups_per_second);
+  printHistogram(out, "bambuled_loop_seconds", "Time between consecutive loop() iterations.", loop_histogram);
+  printValue(out, "bambuled_timers_fired_total", "counter", "Scheduler deadlines that expired.",
+             metrics.timers_fired.load(std::memory_order_relaxed));
+  printValue(out, "bambuled_chunked_printf_overflows_total", "counter",
+             "Formatted response pieces dropped for not fitting the chunk buffer.",
+             metrics.chunked_printf_overflows.load(std::memory_order_relaxed));
+
+  out.end();
+}
@@ -0,0 +1,70 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Runtime performance counters, rendered in Prometheus text format by
+// handleMetrics(). Recording is a relaxed atomic add (plus a bucket lookup for
+// histograms), so the counters stay enabled in normal builds.
+
+#define METRICS_MAX_BUCKETS 10
+
+class MetricHistogram {
+public:
+  // bounds_us: ascending upper bucket bounds in microseconds (+Inf is implicit)
+  MetricHistogram(const uint32_t* bounds_us, uint8_t count);
+
+  void observe(uint32_t us);
+
+  const uint32_t* bounds() const { return _bounds; }
+  uint8_t boundCount() const { return _count; }
+  uint32_t bucket(uint8_t i) const { return _buckets[i].load(std::memory_order_relaxed); }
+  uint32_t count() const { return _total.load(std::memory_order_relaxed); }
+  uint64_t sumUs() const { return _sum_us; }
+
+private:
+  const uint32_t* _bounds;
+  uint8_t _count;
+  std::atomic<uint32_t> _buckets[METRICS_MAX_BUCKETS + 1]; // Non-cumulative; last is +Inf
+  std::atomic<uint32_t> _total;
+  uint64_t _sum_us; // Written from the loop task only
+};
+
+struct Metrics {
+  std::atomic<uint32_t> mqtt_messages;
+  std::atomic<uint32_t> mqtt_parse_errors;
+  std::atomic<uint32_t> mqtt_budget_rejects; // Over a config.h MQTT_* budget
+  std::atomic<uint32_t> mqtt_connect_attempts;
+  std::atomic<uint32_t> mqtt_connects;
+  std::atomic<uint32_t> ws_frames_sent;
+  std::atomic<uint32_t> ws_bytes_sent;
+  std::atomic<uint32_t> sse_events_sent;
+  std::atomic<uint32_t> sse_bytes_sent;
+  std::atomic<uint32_t> led_frames_rendered;
+  std::atomic<uint32_t> led_frames_shown;
+  std::atomic<uint32_t> loop_iterations;
+  std::atomic<uint32_t> timers_fired;
+  std::atomic<uint32_t> chunked_printf_overflows; // ChunkedResponse::printf output dropped
+  std::atomic<uint32_t> web_asset_sent;           // Static assets sent gzipped
+  std::atomic<uint32_t> web_asset_not_modified;   // ...answered 304
+  std::atomic<uint32_t> web_asset_not_acceptable; // ...answered 406 (no gzip)
+  std::atomic<uint32_t> web_asset_bytes_sent;
+  std::atomic<uint32_t> web_asset_bytes_uncompressed; // What the same responses would have cost uncompressed
+};
+
+extern Metrics metrics;
+extern MetricHistogram mqtt_parse_histogram;
+extern MetricHistogram mqtt_connect_histogram; // TLS handshake + MQTT CONNECT
+extern MetricHistogram loop_histogram;
+extern MetricHistogram printer_command_histogram; // Command publish to printer reply
+extern MetricHistogram web_asset_histogram;       // Static asset handler time
+
+inline void metricsCount(std::atomic<uint32_t>& counter, uint32_t n = 1) {
+  counter.fetch_add(n, std::memory_order_relaxed);
+}
+
+void metricsLoopTick(); // Called once per loop() iteration
+void handleMetrics();   // GET /metrics
+
+#endif
@@ -0,0 +1,286 @@
+#include "mqtt_bridge.h"
+#include "mqtt_handler.h"
+#include "led_plan.h"
+#include "status_cache.h"
+#include "scheduler.h"
+#include "heap_guard.h"
+#include "logger.h"
+#include <WiFi.h>
+#include <PubSubClient.h>
+#include <math.h>
+
+static WiFiClient bridge_net;
+static PubSubClient bridge(bridge_net);
+
+// config.bridge_host, looked up once per configuration: a DNS query can hold
+// up loop() for seconds, and a broker on the LAN rarely changes address
+static IPAddress bridge_ip;
+static bool bridge_resolved = false;
+
+// Discovery documents are the largest publish
+#define BRIDGE_BUFFER_SIZE 768
+#define BRIDGE_VALUE_MAX 24
+
+// --- Fields ---
+
+enum BridgeKind : uint8_t { BRIDGE_TEXT, BRIDGE_NUMBER, BRIDGE_TEMP, BRIDGE_ON_OFF };
+
+struct BridgeField {
+  const char* key;          // Topic level and discovery object id
+  const char* name;         // Discovery display name
+  BridgeKind kind;
+  const char* unit;         // Discovery unit, or nullptr
+  const char* device_class; // Discovery device class, or nullptr
+};
+
+enum BridgeFieldId : uint8_t {
+  BF_GCODE_STATE = 0, BF_PERCENT, BF_LAYER, BF_REMAINING, BF_STAGE,
+  BF_NOZZLE, BF_NOZZLE_TARGET, BF_BED, BF_BED_TARGET, BF_WIFI_SIGNAL,
+  BF_LIGHT, BF_LED_STATUS, BF_PRINTER_CONNECTED, BF_COUNT
+};
+
+static const BridgeField FIELDS[BF_COUNT] = {
+  { "gcode_state",        "Print state",          BRIDGE_TEXT,   nullptr, nullptr },
+  { "print_percentage",   "Print progress",       BRIDGE_NUMBER, "%",     nullptr },
+  { "layer_num",          "Layer",                BRIDGE_NUMBER, nullptr, nullptr },
+  { "time_remaining",     "Time remaining",       BRIDGE_NUMBER, "min",   "duration" },
+  { "stage",              "Print stage",          BRIDGE_NUMBER, nullptr, nullptr },
+  { "nozzle_temp",        "Nozzle temperature",   BRIDGE_TEMP,   "°C",    "temperature" },
+  { "nozzle_target_temp", "Nozzle target",        BRIDGE_NUMBER, "°C",    "temperature" },
+  { "bed_temp",           "Bed temperature",      BRIDGE_TEMP,   "°C",    "temperature" },
+  { "bed_target_temp",    "Bed target",           BRIDGE_NUMBER, "°C",    "temperature" },
+  { "wifi_signal",        "Printer Wi-Fi signal", BRIDGE_TEXT,   nullptr, nullptr },
+  { "light",              "Chamber light",        BRIDGE_ON_OFF, nullptr, "light" },
+  { "led_status",         "LED status",           BRIDGE_TEXT,   nullptr, nullptr },
+  { "printer_connected",  "Printer connected",    BRIDGE_ON_OFF, nullptr, "connectivity" },
+};
+
+// Last value sent per field, since the current connection
+static char sent_value[BF_COUNT][BRIDGE_VALUE_MAX];
+static float sent_temp[BF_COUNT];
+static bool sent[BF_COUNT];
+
+static uint32_t published_version = 0;
+static bool was_connected = false;
+static uint32_t reconnect_delay_ms = BRIDGE_RECONNECT_MIN_MS;
+static MqttBridgeStats stats;
+
+static char base_topic[sizeof(config.bridge_prefix) + sizeof(config.bbl_serial) + 1];
+static char topic[sizeof(base_topic) + 96];
+static char client_id[sizeof(config.bbl_serial) + 10];
+static char discovery[BRIDGE_BUFFER_SIZE - 128];
+
+static void formatField(uint8_t id, char* buf, size_t size, float* temp) {
+  *temp = 0;
+  switch (id) {
+    case BF_GCODE_STATE: strlcpy(buf, current_gcode_state.c_str(), size); break;
+    case BF_PERCENT: snprintf(buf, size, "%d", current_print_percentage); break;
+    case BF_LAYER: snprintf(buf, size, "%d", current_layer); break;
+    case BF_REMAINING: snprintf(buf, size, "%d", current_time_remaining); break;
+    case BF_STAGE: snprintf(buf, size, "%d", current_stage); break;
+    case BF_NOZZLE: *temp = current_nozzle_temp; break;
+    case BF_NOZZLE_TARGET: snprintf(buf, size, "%.0f", current_nozzle_target_temp); break;
+    case BF_BED: *temp = current_bed_temp; break;
+    case BF_BED_TARGET: snprintf(buf, size, "%.0f", current_bed_target_temp); break;
+    case BF_WIFI_SIGNAL: strlcpy(buf, current_wifi_signal.c_str(), size); break;
+    case BF_LIGHT: strlcpy(buf, external_light_is_on ? "ON" : "OFF", size); break;
+    case BF_LED_STATUS: strlcpy(buf, getLedPlan().label, size); break;
+    case BF_PRINTER_CONNECTED: strlcpy(buf, client.connected() ? "ON" : "OFF", size); break;
+  }
+  if (FIELDS[id].kind == BRIDGE_TEMP) snprintf(buf, size, "%.1f", *temp);
+}
+
+// --- Publishing ---
+
+static bool publish(const char* payload, bool retained) {
+  size_t length = strlen(payload);
+  bool ok;
+  {
+    // Socket write; see heap_guard.h
+    HEAP_GUARD_EXEMPT();
+    ok = bridge.publish(topic, (const uint8_t*)payload, length, retained);
+  }
+  if (ok) stats.bytes += length;
+  return ok;
+}
+
+static void setTopic(const char* key) {
+  snprintf(topic, sizeof(topic), "%s/%s", base_topic, key);
+}
+
+static void publishDiscovery() {
+  for (uint8_t i = 0; i < BF_COUNT; i++) {
+    const BridgeField& f = FIELDS[i];
+    const char* component = f.kind == BRIDGE_ON_OFF ? "binary_sensor" : "sensor";
+    size_t n = snprintf(discovery, sizeof(discovery),
+                        "{\"name\":\"%s\",\"unique_id\":\"%s_%s\",\"state_topic\":\"%s/%s\","
+                        "\"availability_topic\":\"%s/availability\"",
+                        f.name, client_id, f.key, base_topic, f.key, base_topic);
+    if (f.unit) n += snprintf(discovery + n, sizeof(discovery) - n, ",\"unit_of_measurement\":\"%s\"", f.unit);
+    if (f.device_class) n += snprintf(discovery + n, sizeof(discovery) - n, ",\"device_class\":\"%s\"", f.device_class);
+    if (f.kind == BRIDGE_TEMP) n += snprintf(discovery + n, sizeof(discovery) - n, ",\"state_class\":\"measurement\"");
+    n += snprintf(discovery + n, sizeof(discovery) - n,
+                  ",\"device\":{\"identifiers\":[\"%s\"],\"name\":\"BambuLED %s\",\"manufacturer\":\"BambuLED\"}}",
+                  client_id, config.bbl_serial);
+    if (n >= sizeof(discovery)) {
+      LOG_WARN("MQTT bridge: discovery for %s truncated, skipped.", f.key);
+      continue;
+    }
+    snprintf(topic, sizeof(topic), "homeassistant/%s/%s/%s/config", component, client_id, f.key);
+    if (!publish(discovery, true)) stats.publish_failures++;
+  }
+}
+
+// Sends every field that changed since it was last sent
+static void publishChanges() {
+  char value[BRIDGE_VALUE_MAX];
+  float temp;
+  stats.passes++;
+  for (uint8_t i = 0; i < BF_COUNT; i++) {
+    formatField(i, value, sizeof(value), &temp);
+    if (sent[i]) {
+      if (FIELDS[i].kind == BRIDGE_TEMP) {
+        if (fabsf(temp - sent_temp[i]) < config.bridge_temp_deadband) {
+          if (strcmp(value, sent_value[i]) != 0) stats.deadband_skips++;
+          continue;
+        }
+      }
+      if (strcmp(value, sent_value[i]) == 0) continue;
+    }
+    setTopic(FIELDS[i].key);
+    if (!publish(value, true)) {
+      stats.publish_failures++;
+      published_version--; // Try again on the next pass
+      continue;
+    }
+    stats.publishes++;
+    strlcpy(sent_value[i], value, sizeof(sent_value[i]));
+    sent_temp[i] = temp;
+    sent[i] = true;
+  }
+}
+
+// --- Connection ---
+
+static bool resolveBridgeHost() {
+  if (!bridge_resolved) {
+    bridge_resolved = bridge_ip.fromString(config.bridge_host) || WiFi.hostByName(config.bridge_host, bridge_ip) == 1;
+    if (bridge_resolved) LOG_INFO("MQTT bridge: %s is %s.", config.bridge_host, bridge_ip.toString().c_str());
+  }
+  return bridge_resolved;
+}
+
+static bool connectBridge() {
+  // DNS, TCP connect and CONNECT; rare, and backed off on failure
+  HEAP_GUARD_EXEMPT();
+  setTopic("availability");
+  const char* user = config.bridge_user[0] ? config.bridge_user : nullptr;
+  const char* pass = config.bridge_user[0] ? config.bridge_pass : nullptr;
+  // Opening the TCP connection here bounds the wait for an unreachable
+  // broker; PubSubClient reuses a connected client instead of connecting
+  const char* failure = nullptr;
+  if (!resolveBridgeHost()) {
+    failure = "host not found";
+  } else if (!bridge_net.connect(bridge_ip, config.bridge_port, BRIDGE_CONNECT_TIMEOUT_MS)) {
+    failure = "no TCP connection";
+  } else {
+    bridge.setServer(bridge_ip, config.bridge_port);
+    if (!bridge.connect(client_id, user, pass, topic, 0, true, "offline")) failure = "CONNECT refused";
+  }
+  if (failure) {
+    stats.connect_failures++;
+    LOG_WARN("MQTT bridge: connect to %s:%u failed (%s, state %d), retry in %u s.", config.bridge_host,
+             config.bridge_port, failure, bridge.state(), (unsigned)(reconnect_delay_ms / 1000));
+    timerStart(TIMER_MQTT_BRIDGE, reconnect_delay_ms, nullptr);
+    reconnect_delay_ms = min(reconnect_delay_ms * 2, BRIDGE_RECONNECT_MAX_MS);
+    return false;
+  }
+  stats.connects++;
+  reconnect_delay_ms = BRIDGE_RECONNECT_MIN_MS;
+  LOG_INFO("MQTT bridge: connected to %s:%u, publishing to %s/.", config.bridge_host, config.bridge_port,
+           base_topic);
+  publish("online", true);
+  if (config.bridge_discovery) publishDiscovery();
+  // The broker may have lost our retained values; send everything once
+  memset(sent, 0, sizeof(sent));
+  return true;
+}
+
+static void disconnectBridge() {
+  if (bridge.connected()) {
+    setTopic("availability");
+    publish("offline", true); // A clean disconnect does not fire the last will
+    HEAP_GUARD_EXEMPT();
+    bridge.disconnect();
+  }
+  was_connected = false;
+}
+
+void setupMqttBridge() {
+  // Wildcards, quotes and spaces in the prefix would break the topics or the
+  // discovery JSON; '/' may split it into several levels
+  size_t n = strlcpy(base_topic, config.bridge_prefix, sizeof(base_topic));
+  for (char* p = base_topic; *p; p++) {
+    if (*p == '+' || *p == '#' || *p == '"' || *p == '\\' || (uint8_t)*p <= ' ') *p = '_';
+  }
+  snprintf(base_topic + n, sizeof(base_topic) - n, "/%s", config.bbl_serial);
+  snprintf(client_id, sizeof(client_id), "bambuled_%s", config.bbl_serial);
+
+  if (bridge.getBufferSize() != BRIDGE_BUFFER_SIZE && !bridge.setBufferSize(BRIDGE_BUFFER_SIZE)) {
+    Serial.println("MQTT bridge: buffer allocation failed, discovery will be dropped.");
+  }
+  bridge.setSocketTimeout(BRIDGE_SOCKET_TIMEOUT_S);
+  bridge_resolved = false; // The host may have changed
+  reconnect_delay_ms = BRIDGE_RECONNECT_MIN_MS;
+  timerStop(TIMER_MQTT_BRIDGE);
+  if (mqttBridgeEnabled()) {
+    Serial.printf("MQTT bridge: %s:%u, topics %s/<field>.\n", config.bridge_host, config.bridge_port, base_topic);
+  }
+}
+
+void reconfigureMqttBridge() {
+  disconnectBridge();
+  setupMqttBridge(); // serviceMqttBridge() connects with the new settings
+}
+
+void serviceMqttBridge() {
+  if (!mqttBridgeEnabled()) return;
+
+  if (!bridge.connected()) {
+    if (was_connected) {
+      was_connected = false;
+      LOG_WARN("MQTT bridge: connection lost (state %d).", bridge.state());
+    }
+    if (timerActive(TIMER_MQTT_BRIDGE) || WiFi.status() != WL_CONNECTED) return;
+    if (!connectBridge()) return;
+    was_connected = true;
+    published_version = getStatusVersion() - 1; // Publish all fields now
+  }
+
+  {
+    // Keepalive; the bridge subscribes to nothing
+    HEAP_GUARD_EXEMPT();
+    bridge.loop();
+  }
+
+  // Between passes the slot holds the earliest time for the next one
+  if (timerActive(TIMER_MQTT_BRIDGE) || published_version == getStatusVersion()) return;
+  published_version = getStatusVersion();
+  uint32_t before = stats.publishes + stats.publish_failures;
+  publishChanges();
+  if (stats.publishes + stats.publish_failures != before) {
+    timerStart(TIMER_MQTT_BRIDGE, 1000 / config.bridge_max_rate_hz, nullptr);
+  }
+}
+
+bool mqttBridgeEnabled() {
+  return config.bridge_host[0] != '\0';
+}
+
+bool mqttBridgeConnected() {
+  return bridge.connected();
+}
+
+const MqttBridgeStats& getMqttBridgeStats() {
+  return stats;
+}
@@ -0,0 +1,40 @@
+#ifndef MQTT_BRIDGE_H
+#define MQTT_BRIDGE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Pushes printer state to a home-automation MQTT broker (e.g. Mosquitto),
+// so the controller does not have to be polled over HTTP. A second, plain
+// MQTT connection to config.bridge_host publishes one retained topic per
+// field:
+//
+//   <prefix>/<serial>/availability   online / offline (last will)
+//   <prefix>/<serial>/nozzle_temp    e.g. 219.5
+//   ...
+//
+// A field is only published when it changes. Temperatures must move by at
+// least config.bridge_temp_deadband, and changes arriving faster than
+// config.bridge_max_rate_hz are merged, so the broker gets the latest value
+// at a bounded rate. With config.bridge_discovery, Home Assistant discovery
+// documents are published (retained) on every connect.
+
+struct MqttBridgeStats {
+  uint32_t connects;
+  uint32_t connect_failures;
+  uint32_t passes;          // Publish passes (at most bridge_max_rate_hz per second)
+  uint32_t publishes;       // Field values sent
+  uint32_t publish_failures;
+  uint32_t deadband_skips;  // Temperature changes below the deadband
+  uint32_t bytes;           // Payload bytes, discovery included
+};
+
+void setupMqttBridge();
+void reconfigureMqttBridge(); // After a bridge_* or serial change
+void serviceMqttBridge();     // From loop(): connect, keepalive, publish changes
+
+bool mqttBridgeEnabled();
+bool mqttBridgeConnected();
+const MqttBridgeStats& getMqttBridgeStats();
+
+#endif
@@ -3,12 +3,22 @@
 #include "light_controller.h"
 #include "led_controller.h"
 #include "web_handlers.h" // <-- Include for broadcastWebSocketStatus
+#include "status_cache.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "boot_timing.h"
+#include "state_store.h"
+#include "scheduler.h"
+#include "heap_guard.h"
+#include "json_pool.h"
+#include "printer_commands.h"
+#include "logger.h"
+#include "hms.h"
+#include "ams.h"
+#include <esp_heap_caps.h>
 #include <WiFi.h> 
-
-// --- FIX for Highlighted Log ---
-// MQTT History definition (now uses the struct)
-std::deque<MqttLogEntry> mqtt_history;
-// --- END FIX ---
+#include <ctype.h>
+#include <stdarg.h>
 
 // --- Helper function for logging MQTT errors (Suggestion 7) ---
 void logMqttDisconnectReason(int8_t rc) {
@@ -45,41 +55,45 @@ void logMqttDisconnectReason(int8_t rc) {
       reason = "Unknown error";
       break;
   }
-  Serial.print("failed (rc=");
-  Serial.print(rc);
-  Serial.print(") - ");
-  Serial.println(reason);
+  LOG_WARN("MQTT connection failed (rc=%d) - %s", rc, reason.c_str());
 
   // --- FIX for Highlighted Log ---
   // Add this error to the log as a highlighted entry
-  String log_entry = getTimestamp() + " MQTT Error: " + reason;
-  mqtt_history.push_back({log_entry, true}); // highlight = true
-  if(mqtt_history.size() > MAX_HISTORY_SIZE) {
-    mqtt_history.pop_front();
-  }
+  mqttHistoryPrintf(true, "MQTT Error: %s", reason.c_str()); // highlight = true
   // --- END FIX ---
 }
 
 
+uint32_t mqtt_internal_heap_min_free = UINT32_MAX;
+static_assert(JSON_POOL_DOC_CAPACITY >= MQTT_JSON_DOC_CAPACITY, "reports are parsed into pooled documents");
+
 void setupMQTT() {
   Serial.println("Setting up MQTT...");
   setupMQTTParams();
   client.setCallback(mqttCallback);
+  // Reports only ever copy into these, so they never reallocate
+  current_gcode_state.reserve(PRINTER_STRING_MAX);
+  current_light_mode.reserve(PRINTER_STRING_MAX);
+  current_wifi_signal.reserve(PRINTER_STRING_MAX);
+  if (!client.setBufferSize(MQTT_BUFFER_SIZE)) {
+    Serial.println("MQTT buffer allocation failed, large reports will be dropped.");
+  }
   Serial.println("MQTT OK.");
 }
 
 void setupMQTTParams() {
   client.setServer(config.bbl_ip, 8883);
   mqtt_topic_status = "device/" + String(config.bbl_serial) + "/report";
+  mqtt_topic_request = "device/" + String(config.bbl_serial) + "/request";
   Serial.print("MQTT Server: "); Serial.println(config.bbl_ip);
   Serial.print("Subscription Topic: "); Serial.println(mqtt_topic_status);
 }
 
 bool reconnectMQTT() {
-  Serial.print("Attempting MQTT connection...");
-
+  // The TLS handshake allocates its session state; reconnects are rare
+  HEAP_GUARD_EXEMPT();
   if(WiFi.status() != WL_CONNECTED){
-      Serial.println("WiFi disconnected, cannot connect MQTT.");
+      LOG_WARN("WiFi disconnected, cannot connect MQTT.");
       return false;
   }
 
@@ -89,30 +103,25 @@ bool reconnectMQTT() {
   macAddress.replace(":", "");
   String clientId = "BambuLight-" + macAddress;
 
-  Serial.print(" (Client ID: ");
-  Serial.print(clientId);
-  Serial.print(")...");
+  LOG_INFO("Attempting MQTT connection (Client ID: %s)...", clientId.c_str());
 
+  metricsCount(metrics.mqtt_connect_attempts);
+  uint32_t connectStart = micros();
   if (client.connect(clientId.c_str(), "bblp", config.bbl_access_code)) {
-    Serial.println("connected");
+    LOG_INFO("MQTT connected");
+    mqtt_connect_histogram.observe(micros() - connectStart);
+    metricsCount(metrics.mqtt_connects);
+    bootMark(BOOT_MQTT_CONNECTED);
     
     // --- FIX for Highlighted Log ---
-    String log_entry = getTimestamp() + " MQTT Connected. Subscribing to topic...";
-    mqtt_history.push_back({log_entry, true}); // highlight = true
-    if(mqtt_history.size() > MAX_HISTORY_SIZE) {
-      mqtt_history.pop_front();
-    }
+    mqttHistoryPrintf(true, "MQTT Connected. Subscribing to topic..."); // highlight = true
     // --- END FIX ---
 
     if(client.subscribe(mqtt_topic_status.c_str())){
-         Serial.print("Resubscribed to: ");
-         Serial.println(mqtt_topic_status);
+         LOG_INFO("Resubscribed to: %s", mqtt_topic_status.c_str());
     } else {
-         Serial.println("Resubscribe failed!");
-         mqtt_history.push_back({getTimestamp() + " MQTT Subscribe FAILED!", true});
-         if(mqtt_history.size() > MAX_HISTORY_SIZE) {
-            mqtt_history.pop_front();
-         }
+         LOG_ERROR("Resubscribe failed!");
+         mqttHistoryPrintf(true, "MQTT Subscribe FAILED!");
     }
     return true;
   } else {
@@ -122,51 +131,172 @@ bool reconnectMQTT() {
   }
 }
 
+// --- Report filters ---
+// Only the fields parseFullReport() / parseDeltaUpdate() read are copied into
+// the document; everything else (xcam, ...) is skipped while parsing, so the
+// document size no longer grows with the report. Command replies keep what
+// handlePrinterCommandReply() matches on. The AMS section is only let through
+// when its raw bytes changed (amsSectionChanged()).
+static void addCommandFilter(JsonObject obj) {
+  static const char* const fields[] = { "command", "sequence_id", "result", "reason", "msg" };
+  for (const char* field : fields) obj[field] = true;
+}
+
+static void addAmsFilter(JsonObject ams) {
+  JsonObject unit = ams["ams"].createNestedObject();
+  unit["id"] = true;
+  unit["humidity"] = true;
+  unit["temp"] = true;
+  JsonObject tray = unit["tray"].createNestedObject();
+  static const char* const trayFields[] = { "id", "tray_color", "tray_type", "remain" };
+  for (const char* field : trayFields) tray[field] = true;
+  static const char* const fields[] = { "tray_now", "version", "ams_exist_bits", "tray_exist_bits" };
+  for (const char* field : fields) ams[field] = true;
+}
+
+static void addPrintFilter(JsonObject print, bool withAms) {
+  JsonObject light = print["lights_report"].createNestedObject();
+  light["node"] = true;
+  light["mode"] = true;
+  JsonObject hms = print["hms"].createNestedObject();
+  hms["attr"] = true;
+  hms["code"] = true;
+  static const char* const fields[] = {
+    "gcode_state", "print_percentage", "mc_percent", "bed_temper", "nozzle_temper",
+    "bed_target_temper", "nozzle_target_temper", "mc_remaining_time", "layer_num",
+    "stg_cur", "wifi_signal", "mc_print_sub_stage"
+  };
+  for (const char* field : fields) print[field] = true;
+  if (withAms) addAmsFilter(print.createNestedObject("ams"));
+  addCommandFilter(print);
+}
+
+static void addSystemFilter(JsonObject system) {
+  system["chamber_light"]["led_mode"] = true;
+  system["wifi_signal"] = true;
+  addCommandFilter(system);
+}
+
+static void buildReportFilter(JsonDocument& filter, bool withAms) {
+  addPrintFilter(filter["report"].createNestedObject("print"), withAms);
+  addSystemFilter(filter["report"].createNestedObject("system"));
+  addPrintFilter(filter.createNestedObject("print"), withAms);
+  addSystemFilter(filter.createNestedObject("system"));
+  if (filter.overflowed()) Serial.println("MQTT report filter overflowed!");
+}
+
+static JsonDocument& reportFilter(bool withAms) {
+  static StaticJsonDocument<112 * JSON_OBJECT_SIZE(1)> filter;
+  static StaticJsonDocument<144 * JSON_OBJECT_SIZE(1)> amsFilter;
+  JsonDocument& doc = withAms ? (JsonDocument&)amsFilter : (JsonDocument&)filter;
+  if (doc.isNull()) buildReportFilter(doc, withAms);
+  return doc;
+}
+
+static JsonDocument& deltaFilter() {
+  static StaticJsonDocument<4 * JSON_OBJECT_SIZE(1)> filter;
+  if (filter.isNull()) {
+    JsonObject node = filter.createNestedObject();
+    node["node"] = true;
+    node["value"] = true;
+    node["mode"] = true;
+  }
+  return filter;
+}
+
+// History line for the message being handled: timestamp, the payload cut at
+// MQTT_LOG_MAX_BYTES, then a note if it is rejected. Built in place so a
+// report costs no heap allocation.
+static char log_line[MQTT_HISTORY_ENTRY_MAX + 1];
+static size_t log_len = 0;
+
+static void logLineAppend(const char* format, ...) __attribute__((format(printf, 1, 2)));
+static void logLineAppend(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(log_line + log_len, sizeof(log_line) - log_len, format, args);
+  va_end(args);
+  if (n > 0) log_len = min(log_len + n, sizeof(log_line) - 1);
+}
+
+static void logLineStart(const byte* payload, unsigned int length) {
+  log_len = formatTimestamp(log_line, sizeof(log_line));
+  log_line[log_len++] = ' ';
+  unsigned int kept = length < MQTT_LOG_MAX_BYTES ? length : MQTT_LOG_MAX_BYTES;
+  memcpy(log_line + log_len, payload, kept);
+  log_len += kept;
+  log_line[log_len] = '\0';
+  if (kept < length) logLineAppend(" [... %u bytes]", length - kept);
+}
+
 void mqttCallback(char* topic, byte* payload, unsigned int length) {
-  char messageBuffer[length + 1];
-  memcpy(messageBuffer, payload, length);
-  messageBuffer[length] = '\0';
-  
-  String log_entry = getTimestamp() + " " + messageBuffer;
+  PROFILE_SCOPE(PROF_MQTT_PARSE);
+  metricsCount(metrics.mqtt_messages);
+  uint32_t parseStart = micros();
+
+  logLineStart(payload, length);
+
+  if (length > MQTT_MAX_PAYLOAD_BYTES) {
+    LOG_WARN("MQTT message of %u bytes exceeds the %u byte budget.", length, (unsigned)MQTT_MAX_PAYLOAD_BYTES);
+    logLineAppend(" [ERROR: Message too large]");
+    metricsCount(metrics.mqtt_parse_errors);
+    metricsCount(metrics.mqtt_budget_rejects);
+    addMqttHistory(log_line, log_len, true);
+    return;
+  }
+
+  // The first significant byte picks the filter: '{' full report, '[' delta
+  unsigned int first = 0;
+  while (first < length && isspace(payload[first])) first++;
+  bool delta = (first < length && payload[first] == '[');
+  JsonDocument& filter = delta ? deltaFilter() : reportFilter(amsSectionChanged(payload, length));
 
-  DynamicJsonDocument doc(JSON_DOC_SIZE + 256);
-  DeserializationError error = deserializeJson(doc, messageBuffer);
+  JsonLease doc;
+  DeserializationError error = deserializeJson(*doc, (const char*)payload, length,
+                                               DeserializationOption::Filter(filter),
+                                               DeserializationOption::NestingLimit(MQTT_JSON_MAX_NESTING));
 
   if (error) {
-    Serial.print("MQTT JSON Parse Error: ");
-    Serial.println(error.c_str());
-    log_entry += " [ERROR: Failed to parse JSON]";
+    LOG_WARN("MQTT JSON Parse Error: %s", error.c_str());
+    logLineAppend(" [ERROR: Failed to parse JSON: %s]", error.c_str());
+    metricsCount(metrics.mqtt_parse_errors);
+    if (error == DeserializationError::TooDeep || error == DeserializationError::NoMemory) {
+      metricsCount(metrics.mqtt_budget_rejects);
+    }
     // --- FIX for Highlighted Log ---
-    mqtt_history.push_back({log_entry, true}); // highlight = true (it's an error)
+    addMqttHistory(log_line, log_len, true); // highlight = true (it's an error)
     // --- END FIX ---
     return;
   }
 
-  if (doc.is<JsonObject>()) {
+  if (doc->is<JsonObject>()) {
       // --- FIX for Highlighted Log ---
       // Full reports are routine, so don't highlight them
-      mqtt_history.push_back({log_entry, false}); // highlight = false
+      addMqttHistory(log_line, log_len, false); // highlight = false
       // --- END FIX ---
-      parseFullReport(doc.as<JsonObject>());
+      if (!handlePrinterCommandReply(doc->as<JsonObject>())) {
+          parseFullReport(doc->as<JsonObject>());
+          bootMark(BOOT_FIRST_REPORT);
+      }
       
-  } else if (doc.is<JsonArray>()) {
+  } else if (doc->is<JsonArray>()) {
       // --- FIX for Highlighted Log ---
       // Delta updates are state changes, so highlight them
-      mqtt_history.push_back({log_entry, true}); // highlight = true
+      addMqttHistory(log_line, log_len, true); // highlight = true
       // --- END FIX ---
-      parseDeltaUpdate(doc.as<JsonArray>());
+      parseDeltaUpdate(doc->as<JsonArray>());
   } else {
-      Serial.println("Received unknown JSON type.");
-      log_entry += " [ERROR: Unknown JSON type]";
+      LOG_WARN("Received unknown JSON type.");
+      logLineAppend(" [ERROR: Unknown JSON type]");
       // --- FIX for Highlighted Log ---
-      mqtt_history.push_back({log_entry, true}); // highlight = true
+      addMqttHistory(log_line, log_len, true); // highlight = true
       // --- END FIX ---
   }
-  
-  // --- Common code for log history ---
-  if(mqtt_history.size() > MAX_HISTORY_SIZE) {
-    mqtt_history.pop_front();
-  }
+  mqtt_parse_histogram.observe(micros() - parseStart);
+
+  // Internal RAM left while a report is being handled, lowest since boot
+  uint32_t internalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  if (internalFree < mqtt_internal_heap_min_free) mqtt_internal_heap_min_free = internalFree;
 }
 
 void parseFullReport(JsonObject doc) {
@@ -183,20 +313,31 @@ void parseFullReport(JsonObject doc) {
       system_data = data["system"];
       print_data = data["print"];
   } else {
-      Serial.println("Received unknown JSON object.");
+      LOG_WARN("Received unknown JSON object.");
       return;
   }
 
   if(data.isNull()) {
-      Serial.println("MQTT JSON Error: 'data' object is null.");
+      LOG_WARN("MQTT JSON Error: 'data' object is null.");
       return;
   }
   
   if (print_data.isNull()) {
-      Serial.println("MQTT JSON Error: 'print' object is null.");
+      LOG_WARN("MQTT JSON Error: 'print' object is null.");
       return;
   }
 
+  // Absent means unchanged; the printer sends an empty list once entries clear
+  bool hmsChanged = false;
+  if (print_data.containsKey("hms")) {
+      hmsChanged = parseHms(print_data["hms"].as<JsonArray>());
+  }
+  // Only present when the section changed since it was last parsed
+  bool amsChanged = false;
+  if (print_data.containsKey("ams")) {
+      amsChanged = parseAms(print_data["ams"].as<JsonObject>());
+  }
+
   const char* newChamberLightMode = current_light_mode.c_str();
   const char* newGcodeState = current_gcode_state.c_str();
   int newPrintPercentage = current_print_percentage;
@@ -214,13 +355,15 @@ void parseFullReport(JsonObject doc) {
   if (!print_data.isNull() && print_data.containsKey("lights_report")) {
       JsonArray lightsReport = print_data["lights_report"].as<JsonArray>();
       if (!lightsReport.isNull()) {
+          int seen = 0;
           for (JsonObject node : lightsReport) {
+              if (++seen > MQTT_MAX_ARRAY_NODES) break;
               if (node.isNull()) continue;
               const char* nodeName = node["node"];
               if (nodeName && strcmp(nodeName, "chamber_light") == 0) {
                   newChamberLightMode = node["mode"] | current_light_mode.c_str();
                   lightModeFound = true;
-                  Serial.println("Found light_mode in lights_report array.");
+                  LOG_DEBUG("Found light_mode in lights_report array.");
                   break;
               }
           }
@@ -264,21 +407,22 @@ void parseFullReport(JsonObject doc) {
   if (subStage == 1 && !lightModeFound) {
       newChamberLightMode = "on";
       lightModeFound = true;
-      Serial.println("Inferred light 'on' from mc_print_sub_stage: 1");
+      LOG_DEBUG("Inferred light 'on' from mc_print_sub_stage: 1");
   }
 
   if (!gcodeStateFound && (newPrintPercentage > 0 || newLayerNum > 0) && strcmp(newGcodeState, "IDLE") == 0) {
       newGcodeState = "RUNNING";
-      Serial.println("Inferred state 'RUNNING' from print progress.");
+      LOG_INFO("Inferred state 'RUNNING' from print progress.");
   }
 
-  updatePrinterState(String(newGcodeState), newPrintPercentage, String(newChamberLightMode), newBedTemp, newNozzleTemp, String(newWifiSignal), newBedTargetTemp, newNozzleTargetTemp, newTimeRemaining, newLayerNum, newPrintStage);
+  updatePrinterState(newGcodeState, newPrintPercentage, newChamberLightMode, newBedTemp, newNozzleTemp, newWifiSignal, newBedTargetTemp, newNozzleTargetTemp, newTimeRemaining, newLayerNum, newPrintStage);
+  if (hmsChanged || amsChanged) broadcastWebSocketStatus();
 }
 
 void parseDeltaUpdate(JsonArray arr) {
-  String newGcodeState = current_gcode_state;
+  const char* newGcodeState = current_gcode_state.c_str();
   int newPrintPercentage = current_print_percentage;
-  String newChamberLightMode = current_light_mode;
+  const char* newChamberLightMode = current_light_mode.c_str();
   float newBedTemp = current_bed_temp;
   float newNozzleTemp = current_nozzle_temp;
   float newBedTargetTemp = current_bed_target_temp;
@@ -286,11 +430,17 @@ void parseDeltaUpdate(JsonArray arr) {
   int newTimeRemaining = current_time_remaining;
   int newLayerNum = current_layer;
   int newPrintStage = current_stage;
-  String newWifiSignal = current_wifi_signal;
+  const char* newWifiSignal = current_wifi_signal.c_str();
   bool gcodeStateFound = false;
   bool progressFound = false;
 
+  int seen = 0;
   for (JsonObject node : arr) {
+      if (++seen > MQTT_MAX_ARRAY_NODES) {
+          LOG_WARN("Delta update has more than %d nodes, ignoring the rest.", MQTT_MAX_ARRAY_NODES);
+          metricsCount(metrics.mqtt_budget_rejects);
+          break;
+      }
       if (node.isNull()) continue;
 
       const char* nodeName = node["node"];
@@ -298,8 +448,7 @@ void parseDeltaUpdate(JsonArray arr) {
 
       if (strcmp(nodeName, "chamber_light") == 0) {
           newChamberLightMode = node["mode"] | current_light_mode.c_str();
-          Serial.print("Received chamber_light delta update. New mode: ");
-          Serial.println(newChamberLightMode);
+          LOG_INFO("Received chamber_light delta update. New mode: %s", newChamberLightMode);
       }
       else if (strcmp(nodeName, "bed_temper") == 0) {
           newBedTemp = node["value"] | current_bed_temp;
@@ -316,8 +465,7 @@ void parseDeltaUpdate(JsonArray arr) {
       else if (strcmp(nodeName, "gcode_state") == 0) {
           newGcodeState = node["value"] | current_gcode_state.c_str();
           gcodeStateFound = true;
-          Serial.print("Received gcode_state delta update. New state: ");
-          Serial.println(newGcodeState);
+          LOG_INFO("Received gcode_state delta update. New state: %s", newGcodeState);
       }
       else if (strcmp(nodeName, "print_percentage") == 0) {
           newPrintPercentage = node["value"] | current_print_percentage;
@@ -341,7 +489,7 @@ void parseDeltaUpdate(JsonArray arr) {
           int subStage = node["value"] | -1;
           if (subStage == 1) {
               newChamberLightMode = "on";
-              Serial.println("Inferred light 'on' from mc_print_sub_stage delta update");
+              LOG_DEBUG("Inferred light 'on' from mc_print_sub_stage delta update");
           }
       }
       else if (strcmp(nodeName, "stg_cur") == 0) {
@@ -349,31 +497,60 @@ void parseDeltaUpdate(JsonArray arr) {
       }
   }
 
-  if (!gcodeStateFound && progressFound && newGcodeState == "IDLE") {
+  if (!gcodeStateFound && progressFound && strcmp(newGcodeState, "IDLE") == 0) {
       newGcodeState = "RUNNING";
-      Serial.println("Inferred state 'RUNNING' from delta print progress.");
+      LOG_INFO("Inferred state 'RUNNING' from delta print progress.");
   }
 
   updatePrinterState(newGcodeState, newPrintPercentage, newChamberLightMode, newBedTemp, newNozzleTemp, newWifiSignal, newBedTargetTemp, newNozzleTargetTemp, newTimeRemaining, newLayerNum, newPrintStage);
 }
 
-void updatePrinterState(String gcodeState, int printPercentage, String chamberLightMode, float bedTemp, float nozzleTemp, String wifiSignal, float bedTargetTemp, float nozzleTargetTemp, int timeRemaining, int layerNum, int stage) {
-  
+void updatePrinterState(const char* newGcodeState, int printPercentage, const char* newChamberLightMode, float bedTemp, float nozzleTemp, const char* newWifiSignal, float bedTargetTemp, float nozzleTargetTemp, int timeRemaining, int layerNum, int stage) {
+  // Copy first: the arguments may point into the current_* strings, and
+  // fixed buffers keep the update free of heap allocations
+  char gcodeState[PRINTER_STRING_MAX + 1];
+  char chamberLightMode[PRINTER_STRING_MAX + 1];
+  char wifiSignal[PRINTER_STRING_MAX + 1];
+  strlcpy(gcodeState, newGcodeState ? newGcodeState : "", sizeof(gcodeState));
+  strlcpy(chamberLightMode, newChamberLightMode ? newChamberLightMode : "", sizeof(chamberLightMode));
+  strlcpy(wifiSignal, newWifiSignal ? newWifiSignal : "", sizeof(wifiSignal));
+
   bool stateChanged = false;
-  if (gcodeState != current_gcode_state) stateChanged = true;
+  if (current_gcode_state != gcodeState) stateChanged = true;
   
-  if ( (gcodeState == "RUNNING" || gcodeState == "PAUSED") && (stage == 255 || printPercentage == 100) ) 
+  if ( (strcmp(gcodeState, "RUNNING") == 0 || strcmp(gcodeState, "PAUSED") == 0) && (stage == 255 || printPercentage == 100) ) 
   {
       if (current_gcode_state != "FINISH") {
-          Serial.printf("Inferred state 'FINISH' from stg_cur=%d or percentage=%d.\n", stage, printPercentage);
-          gcodeState = "FINISH";
+          LOG_INFO("Inferred 'FINISH': stg_cur=%d, percent=%d", stage, printPercentage);
+          strlcpy(gcodeState, "FINISH", sizeof(gcodeState));
           stateChanged = true;
       }
   }
 
-  if (gcodeState == "FINISH" && current_gcode_state != "FINISH") {
+  if (strcmp(gcodeState, "FINISH") == 0 && current_gcode_state != "FINISH") {
     finishTime = millis();
-    Serial.println("Print finished, starting 2-minute timers.");
+    scheduleFinishTimeout();
+    LOG_INFO("Print finished, starting 2-minute timers.");
+  }
+
+  // Any reported value moving invalidates the cached status JSON
+  bool valuesChanged = stateChanged ||
+      printPercentage != current_print_percentage ||
+      current_light_mode != chamberLightMode ||
+      bedTemp != current_bed_temp ||
+      nozzleTemp != current_nozzle_temp ||
+      bedTargetTemp != current_bed_target_temp ||
+      nozzleTargetTemp != current_nozzle_target_temp ||
+      timeRemaining != current_time_remaining ||
+      layerNum != current_layer ||
+      stage != current_stage ||
+      current_wifi_signal != wifiSignal;
+
+  // The first live report confirms or replaces a restored checkpoint
+  if (printer_state_stale) {
+    printer_state_stale = false;
+    valuesChanged = true;
+    LOG_INFO("Live printer report received, restored state replaced.");
   }
 
   current_gcode_state = gcodeState;
@@ -387,41 +564,41 @@ void updatePrinterState(String gcodeState, int printPercentage, String chamberLi
   current_layer = layerNum;
   current_stage = stage;
   current_wifi_signal = wifiSignal;
-  current_error_state = (gcodeState == "FAILED" || gcodeState == "STOP");
-
-  if (!manual_light_control) {
-    bool lightShouldBeOnBasedOnPrinter = (chamberLightMode == "on" || chamberLightMode == "flashing");
-    bool finalLightState = lightShouldBeOnBasedOnPrinter;
-
-    if (config.chamber_light_finish_timeout && finishTime > 0) {
-        if (millis() - finishTime < FINISH_LIGHT_TIMEOUT) {
-            finalLightState = true;
-        } else {
-            finalLightState = false;
-        }
-    }
-    
-    if (finalLightState != external_light_is_on) { 
-       setChamberLightState(finalLightState);
-    }
+  current_error_state = (strcmp(gcodeState, "FAILED") == 0 || strcmp(gcodeState, "STOP") == 0);
+
+  // New version first, so the LED plan and rules see the new state
+  if (valuesChanged) {
+    markStatusChanged();
   }
 
+  updateAutomaticLight();
+
   updateLEDs();
   
   // --- FIX for WebSockets (Suggestion 3) ---
-  // Only broadcast if the state actually changed, or 
-  // if it's a RUNNING state (to catch % updates)
-  if (stateChanged || gcodeState == "RUNNING") {
+  // Only broadcast when something the status JSON reports actually changed
+  if (valuesChanged) {
     broadcastWebSocketStatus(); // PUSH the update to all web clients!
   }
 }
 
 void handleMQTTConnection() {
-  if (!client.connected()) {
-    if (millis() - lastReconnectAttempt > RECONNECT_INTERVAL) {
-      lastReconnectAttempt = millis();
+  // mqtt_connected is part of the status, so push connection edges
+  static bool wasConnected = false;
+  bool isConnected = client.connected();
+  if (isConnected != wasConnected) {
+    wasConnected = isConnected;
+    markStatusChanged();
+    broadcastWebSocketStatus();
+  }
+
+  if (!isConnected) {
+    // No backoff running: try now, and on failure wait RECONNECT_INTERVAL.
+    // The expiring slot wakes loop() for the next attempt.
+    if (!timerActive(TIMER_MQTT_RECONNECT)) {
+      timerStart(TIMER_MQTT_RECONNECT, RECONNECT_INTERVAL, nullptr);
       if (reconnectMQTT()) {
-        lastReconnectAttempt = 0;
+        timerStop(TIMER_MQTT_RECONNECT);
       }
     }
   } else {
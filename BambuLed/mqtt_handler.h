@@ -4,13 +4,14 @@
 #include <PubSubClient.h>
 #include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
-#include <deque>
 #include "config.h" 
+#include "mqtt_history.h"
 
 // External declarations from main file
 extern PubSubClient client;
 extern WiFiClientSecure espClient; 
 extern String mqtt_topic_status;
+extern String mqtt_topic_request; // Printer commands, see printer_commands.h
 extern String current_light_mode;
 extern bool manual_light_control;
 extern bool external_light_is_on;
@@ -27,24 +28,15 @@ extern int current_stage;
 extern String current_wifi_signal;
 extern unsigned long finishTime;
 extern const unsigned long FINISH_LIGHT_TIMEOUT;
-extern unsigned long lastReconnectAttempt;
 extern const unsigned long RECONNECT_INTERVAL;
 extern Config config; 
 
-// --- FIX for Highlighted Log ---
-// 1. Define a struct to hold the log message and its state
-struct MqttLogEntry {
-  String message;
-  bool highlight;
-};
-
-// 2. Change the deque to use this new struct
-extern std::deque<MqttLogEntry> mqtt_history;
-
-// 3. Set the new history size
-const int MAX_HISTORY_SIZE = 500;  // Increased for 8MB RAM
-// --- END FIX ---
+// Longest gcode state, light mode or Wi-Fi signal string kept from a report.
+// The current_* Strings reserve this much at boot and are never grown.
+const size_t PRINTER_STRING_MAX = 23;
 
+// Lowest free internal heap seen right after handling a report
+extern uint32_t mqtt_internal_heap_min_free;
 
 // Function declarations
 void setupMQTT();
@@ -53,8 +45,8 @@ bool reconnectMQTT();
 void mqttCallback(char* topic, byte* payload, unsigned int length);
 void parseFullReport(JsonObject doc);
 void parseDeltaUpdate(JsonArray arr);
-void updatePrinterState(String gcodeState, int printPercentage, String chamberLightMode, 
-                       float bedTemp, float nozzleTemp, String wifiSignal, 
+void updatePrinterState(const char* gcodeState, int printPercentage, const char* chamberLightMode,
+                       float bedTemp, float nozzleTemp, const char* wifiSignal,
                        float bedTargetTemp, float nozzleTargetTemp, 
                        int timeRemaining, int layerNum, int stage);
 void handleMQTTConnection();
@@ -0,0 +1,94 @@
+#include "mqtt_history.h"
+#include <esp_heap_caps.h>
+#include <stdarg.h>
+
+// Entries are written one after another into the arena and wrap to its
+// start when the next one does not fit; the slots ring keeps them in order.
+struct HistorySlot {
+  uint32_t offset;
+  uint16_t length;
+  bool highlight;
+};
+
+static HistorySlot slots[MAX_HISTORY_SIZE];
+static size_t slot_first = 0; // Oldest entry
+static size_t slot_count = 0;
+
+static char* arena = nullptr;
+static size_t arena_size = 0;
+static size_t arena_head = 0; // Where the next entry goes
+
+uint32_t mqtt_history_next_seq = 1;
+
+void setupMqttHistory() {
+  if (arena) return;
+#ifdef BOARD_HAS_PSRAM
+  arena = (char*)heap_caps_malloc(MQTT_HISTORY_BYTES, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  arena = (char*)malloc(MQTT_HISTORY_BYTES);
+#endif
+  if (!arena) {
+    Serial.printf("MQTT history: could not allocate %u bytes, history disabled.\n", (unsigned)MQTT_HISTORY_BYTES);
+    return;
+  }
+  arena_size = MQTT_HISTORY_BYTES;
+}
+
+static void dropOldest() {
+  slot_first = (slot_first + 1) % MAX_HISTORY_SIZE;
+  slot_count--;
+}
+
+void addMqttHistory(const char* text, size_t length, bool highlight) {
+  if (!arena) {
+    mqtt_history_next_seq++; // Keep the cursor moving, nothing is stored
+    return;
+  }
+  if (length > MQTT_HISTORY_ENTRY_MAX) length = MQTT_HISTORY_ENTRY_MAX;
+  size_t need = length + 1;
+
+  if (slot_count == MAX_HISTORY_SIZE) dropOldest();
+  if (arena_head + need > arena_size) {
+    // Entries between the write position and the end are the oldest ones
+    while (slot_count && slots[slot_first].offset >= arena_head) dropOldest();
+    arena_head = 0;
+  }
+  while (slot_count) {
+    const HistorySlot& oldest = slots[slot_first];
+    bool overlaps = oldest.offset < arena_head + need && oldest.offset + oldest.length + 1 > arena_head;
+    if (!overlaps) break;
+    dropOldest();
+  }
+
+  memcpy(arena + arena_head, text, length);
+  arena[arena_head + length] = '\0';
+  HistorySlot& slot = slots[(slot_first + slot_count) % MAX_HISTORY_SIZE];
+  slot.offset = arena_head;
+  slot.length = length;
+  slot.highlight = highlight;
+  slot_count++;
+  arena_head += need;
+  mqtt_history_next_seq++;
+}
+
+void mqttHistoryPrintf(bool highlight, const char* format, ...) {
+  static char line[MQTT_HISTORY_ENTRY_MAX + 1];
+  size_t len = formatTimestamp(line, sizeof(line));
+  line[len++] = ' ';
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(line + len, sizeof(line) - len, format, args);
+  va_end(args);
+  if (n > 0) len = min(len + n, sizeof(line) - 1);
+  addMqttHistory(line, len, highlight);
+}
+
+size_t mqttHistoryCount() {
+  return slot_count;
+}
+
+MqttLogEntry mqttHistoryAt(size_t index) {
+  const HistorySlot& slot = slots[(slot_first + index) % MAX_HISTORY_SIZE];
+  uint32_t seq = mqtt_history_next_seq - slot_count + index;
+  return {arena + slot.offset, slot.length, slot.highlight, seq};
+}
@@ -0,0 +1,41 @@
+#ifndef MQTT_HISTORY_H
+#define MQTT_HISTORY_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Recent MQTT messages and connection events, shown on /mqtt.
+// The text lives in one arena allocated by setupMqttHistory(), so logging
+// never touches the heap afterwards. The oldest entries are dropped once
+// MAX_HISTORY_SIZE entries are stored or the arena is full.
+const int MAX_HISTORY_SIZE = 500;
+#ifdef BOARD_HAS_PSRAM
+const size_t MQTT_HISTORY_BYTES = 128 * 1024;
+#else
+const size_t MQTT_HISTORY_BYTES = 24 * 1024;
+#endif
+// Longest entry: timestamp, a payload cut at MQTT_LOG_MAX_BYTES and a note
+const size_t MQTT_HISTORY_ENTRY_MAX = MQTT_LOG_MAX_BYTES + 96;
+
+// Page sizes for the /mqtt/history.json cursor API
+const int MQTT_HISTORY_PAGE_DEFAULT = 25;
+const int MQTT_HISTORY_PAGE_MAX = 100;
+
+struct MqttLogEntry {
+  const char* message; // NUL-terminated, in the arena
+  uint16_t length;
+  bool highlight;
+  uint32_t seq; // Monotonic id, used as the cursor by /mqtt/history.json
+};
+
+// Sequence number the next history entry will get (entries are contiguous)
+extern uint32_t mqtt_history_next_seq;
+
+void setupMqttHistory();
+void addMqttHistory(const char* text, size_t length, bool highlight);
+// "<timestamp> <formatted text>"
+void mqttHistoryPrintf(bool highlight, const char* format, ...) __attribute__((format(printf, 2, 3)));
+size_t mqttHistoryCount();
+MqttLogEntry mqttHistoryAt(size_t index); // 0 is the oldest
+
+#endif
@@ -0,0 +1,343 @@
+#include "printer_commands.h"
+#include "mqtt_handler.h"
+#include "web_handlers.h"
+#include "status_cache.h"
+#include "scheduler.h"
+#include "metrics.h"
+#include "heap_guard.h"
+#include "chunked_response.h"
+#include "logger.h"
+#include <esp_system.h>
+
+const char* const PRINTER_COMMAND_NAMES[PRINTER_CMD_TYPE_COUNT] = {
+  "pushall", "ledctrl", "pause", "resume", "stop"
+};
+const char* const PRINTER_COMMAND_STATE_NAMES[PRINTER_CMD_STATE_COUNT] = {
+  "queued", "sent", "done", "failed", "timed_out", "dropped"
+};
+const char* const PRINTER_LED_MODE_NAMES[PRINTER_LED_MODE_COUNT] = {
+  "on", "off", "flashing"
+};
+
+// Ring of the last PRINTER_CMD_SLOTS commands; slot = number % PRINTER_CMD_SLOTS
+static PrinterCommand commands[PRINTER_CMD_SLOTS];
+static uint32_t command_total = 0; // Commands queued since boot
+static uint32_t next_seq = 0;
+static PrinterCommandStats stats;
+
+// Outgoing payload; the longest (ledctrl) is ~200 bytes
+static char payload[256];
+
+static void pollCommands();
+
+static uint8_t commandCount() {
+  return command_total < PRINTER_CMD_SLOTS ? command_total : PRINTER_CMD_SLOTS;
+}
+
+static PrinterCommand& commandAt(uint8_t index) {
+  return commands[(command_total - commandCount() + index) % PRINTER_CMD_SLOTS];
+}
+
+static bool isPending(const PrinterCommand& cmd) {
+  return cmd.state == PRINTER_CMD_QUEUED || cmd.state == PRINTER_CMD_SENT;
+}
+
+bool printerCommandType(const char* name, PrinterCommandType* out) {
+  for (uint8_t i = 0; i < PRINTER_CMD_TYPE_COUNT; i++) {
+    if (strcmp(name, PRINTER_COMMAND_NAMES[i]) == 0) {
+      *out = (PrinterCommandType)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool printerCommandAllowed(PrinterCommandType type) {
+  bool printControl = type == PRINTER_CMD_PAUSE || type == PRINTER_CMD_RESUME || type == PRINTER_CMD_STOP;
+  return !printControl || config.printer_control;
+}
+
+bool printerLedMode(const char* name, PrinterLedMode* out) {
+  for (uint8_t i = 0; i < PRINTER_LED_MODE_COUNT; i++) {
+    if (strcmp(name, PRINTER_LED_MODE_NAMES[i]) == 0) {
+      *out = (PrinterLedMode)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// --- Sending ---
+
+static size_t formatPayload(const PrinterCommand& cmd) {
+  const char* name = PRINTER_COMMAND_NAMES[cmd.type];
+  switch (cmd.type) {
+    case PRINTER_CMD_PUSHALL:
+      return snprintf(payload, sizeof(payload),
+                      "{\"pushing\":{\"sequence_id\":\"%u\",\"command\":\"%s\",\"version\":1,\"push_target\":1}}",
+                      (unsigned)cmd.seq, name);
+    case PRINTER_CMD_LEDCTRL:
+      return snprintf(payload, sizeof(payload),
+                      "{\"system\":{\"sequence_id\":\"%u\",\"command\":\"%s\",\"led_node\":\"chamber_light\","
+                      "\"led_mode\":\"%s\",\"led_on_time\":500,\"led_off_time\":500,\"loop_times\":0,\"interval_time\":0}}",
+                      (unsigned)cmd.seq, name, PRINTER_LED_MODE_NAMES[cmd.led_mode]);
+    default:
+      return snprintf(payload, sizeof(payload),
+                      "{\"print\":{\"sequence_id\":\"%u\",\"command\":\"%s\",\"param\":\"\"}}",
+                      (unsigned)cmd.seq, name);
+  }
+}
+
+static void sendCommand(PrinterCommand& cmd) {
+  size_t length = formatPayload(cmd);
+  if (cmd.attempts > 0) stats.retries++;
+  cmd.attempts++;
+  cmd.state = PRINTER_CMD_SENT;
+  cmd.sent_us = micros();
+  stats.sent++;
+
+  bool ok;
+  {
+    // Socket write; see heap_guard.h
+    HEAP_GUARD_EXEMPT();
+    ok = client.publish(mqtt_topic_request.c_str(), (const uint8_t*)payload, length);
+  }
+  // A failed publish is left to time out and be retried like a lost reply
+  LOG_INFO("Printer command %s #%u: attempt %u%s.", PRINTER_COMMAND_NAMES[cmd.type],
+           (unsigned)cmd.seq, cmd.attempts, ok ? "" : ", publish failed");
+  if (cmd.attempts == 1) markStatusChanged();
+}
+
+static void finishCommand(PrinterCommand& cmd, PrinterCommandState state) {
+  cmd.state = state;
+  const char* name = PRINTER_COMMAND_NAMES[cmd.type];
+  switch (state) {
+    case PRINTER_CMD_DONE:
+    case PRINTER_CMD_FAILED:
+      cmd.rtt_us = micros() - cmd.sent_us;
+      printer_command_histogram.observe(cmd.rtt_us);
+      if (state == PRINTER_CMD_DONE) stats.done++;
+      else stats.failed++;
+      mqttHistoryPrintf(state == PRINTER_CMD_FAILED, "Printer command %s #%u %s in %u ms.", name,
+                        (unsigned)cmd.seq, PRINTER_COMMAND_STATE_NAMES[state], (unsigned)(cmd.rtt_us / 1000));
+      break;
+    case PRINTER_CMD_TIMED_OUT:
+      stats.timed_out++;
+      mqttHistoryPrintf(true, "Printer command %s #%u: no reply after %u attempts.", name,
+                        (unsigned)cmd.seq, cmd.attempts);
+      break;
+    default:
+      stats.dropped++;
+      mqttHistoryPrintf(true, "Printer command %s #%u dropped, MQTT not connected.", name, (unsigned)cmd.seq);
+      break;
+  }
+  markStatusChanged();
+}
+
+// Sends the oldest queued command once nothing is awaiting a reply, and
+// retries or expires the one that is
+static void pollCommands() {
+  bool pending = false;
+  for (uint8_t i = 0; i < commandCount(); i++) {
+    PrinterCommand& cmd = commandAt(i);
+    if (cmd.state == PRINTER_CMD_SENT) {
+      if (micros() - cmd.sent_us < PRINTER_CMD_TIMEOUT_MS * 1000) return;
+      if (cmd.attempts >= PRINTER_CMD_MAX_ATTEMPTS) {
+        finishCommand(cmd, PRINTER_CMD_TIMED_OUT);
+        continue;
+      }
+      sendCommand(cmd);
+      return;
+    }
+    if (cmd.state != PRINTER_CMD_QUEUED) continue;
+    if (millis() - cmd.queued_ms > PRINTER_CMD_MAX_AGE_MS) {
+      finishCommand(cmd, PRINTER_CMD_DROPPED);
+      continue;
+    }
+    pending = true;
+    if (client.connected()) sendCommand(cmd);
+    return;
+  }
+  if (!pending) timerStop(TIMER_PRINTER_COMMAND);
+}
+
+uint32_t queuePrinterCommand(PrinterCommandType type, PrinterLedMode led_mode) {
+  PrinterCommand& cmd = commands[command_total % PRINTER_CMD_SLOTS];
+  // Commands go out in order, so a pending oldest slot means all are pending
+  if (command_total >= PRINTER_CMD_SLOTS && isPending(cmd)) {
+    stats.rejected++;
+    return 0;
+  }
+  // Random start, so replies to the last boot's commands match nothing
+  if (next_seq == 0) next_seq = 100000 + esp_random() % 900000;
+
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.seq = next_seq++;
+  cmd.type = type;
+  cmd.led_mode = led_mode;
+  cmd.state = PRINTER_CMD_QUEUED;
+  cmd.queued_ms = millis();
+  command_total++;
+  stats.queued++;
+  markStatusChanged();
+
+  if (!timerActive(TIMER_PRINTER_COMMAND)) {
+    timerStart(TIMER_PRINTER_COMMAND, PRINTER_CMD_POLL_MS, pollCommands, PRINTER_CMD_POLL_MS);
+  }
+  pollCommands(); // Send now if nothing is in flight
+  return cmd.seq;
+}
+
+uint32_t queuePrinterCommandText(const char* text) {
+  char name[16];
+  const char* colon = strchr(text, ':');
+  size_t name_len = colon ? (size_t)(colon - text) : strlen(text);
+  if (name_len >= sizeof(name)) return 0;
+  memcpy(name, text, name_len);
+  name[name_len] = '\0';
+
+  PrinterCommandType type;
+  PrinterLedMode mode = PRINTER_LED_ON;
+  if (!printerCommandType(name, &type)) return 0;
+  if (type == PRINTER_CMD_LEDCTRL && !(colon && printerLedMode(colon + 1, &mode))) return 0;
+  if (!printerCommandAllowed(type)) return 0;
+  return queuePrinterCommand(type, mode);
+}
+
+// --- Replies ---
+
+static bool isSuccess(const char* result) {
+  return result && strcasecmp(result, "success") == 0;
+}
+
+bool handlePrinterCommandReply(JsonObject doc) {
+  JsonObject body = doc["print"];
+  if (body.isNull()) body = doc["system"];
+  const char* command = body["command"];
+  if (!command) return false;
+
+  // Only one command is ever in flight
+  PrinterCommand* sent = nullptr;
+  for (uint8_t i = 0; i < commandCount(); i++) {
+    if (commandAt(i).state == PRINTER_CMD_SENT) sent = &commandAt(i);
+  }
+
+  // pushall is answered by the full report it asks for, which has the
+  // printer's own sequence_id; that report is still parsed as usual
+  if (strcmp(command, "push_status") == 0) {
+    if (sent && sent->type == PRINTER_CMD_PUSHALL && (body["msg"] | -1) == 0) {
+      finishCommand(*sent, PRINTER_CMD_DONE);
+      pollCommands();
+    }
+    return false;
+  }
+
+  PrinterCommandType type;
+  if (!printerCommandType(command, &type)) return false;
+  if (sent && sent->type == type && strtoul(body["sequence_id"] | "0", NULL, 10) == sent->seq) {
+    finishCommand(*sent, isSuccess(body["result"]) ? PRINTER_CMD_DONE : PRINTER_CMD_FAILED);
+    if (sent->state == PRINTER_CMD_FAILED) {
+      LOG_WARN("Printer rejected the command: %s", body["reason"] | "(no reason)");
+    }
+    pollCommands();
+  }
+  // Command replies, ours or another client's, carry no printer state
+  return true;
+}
+
+// --- Accessors ---
+
+uint8_t printerCommandCount() {
+  return commandCount();
+}
+
+const PrinterCommand& printerCommandAt(uint8_t index) {
+  return commandAt(index);
+}
+
+const PrinterCommand* lastPrinterCommand() {
+  return command_total ? &commandAt(commandCount() - 1) : nullptr;
+}
+
+uint8_t printerCommandsPending() {
+  uint8_t pending = 0;
+  for (uint8_t i = 0; i < commandCount(); i++) {
+    if (isPending(commandAt(i))) pending++;
+  }
+  return pending;
+}
+
+const PrinterCommandStats& getPrinterCommandStats() {
+  return stats;
+}
+
+// --- HTTP ---
+
+// Browsers send Origin with a cross-site POST, including a plain form submit,
+// so a page on another site can't use the device to control the printer.
+// Clients that send no Origin (curl, scripts) are not browsers.
+static bool isSameOrigin() {
+  String origin = server.header("Origin");
+  if (!origin.length()) return true;
+  int scheme = origin.indexOf("://");
+  return scheme >= 0 && strcmp(origin.c_str() + scheme + 3, server.header("Host").c_str()) == 0;
+}
+
+void handlePrinterCommand() {
+  if (server.method() != HTTP_POST) {
+    server.send(405, "text/plain", "Use POST.");
+    return;
+  }
+  if (!isSameOrigin()) {
+    server.send(403, "text/plain", "Cross-origin request refused.");
+    return;
+  }
+  PrinterCommandType type;
+  PrinterLedMode mode = PRINTER_LED_ON;
+  if (!printerCommandType(server.arg("cmd").c_str(), &type)) {
+    server.send(400, "text/plain", "Unknown cmd; use pushall, ledctrl, pause, resume or stop.");
+    return;
+  }
+  if (type == PRINTER_CMD_LEDCTRL && !printerLedMode(server.arg("mode").c_str(), &mode)) {
+    server.send(400, "text/plain", "ledctrl needs mode=on, off or flashing.");
+    return;
+  }
+  if (!printerCommandAllowed(type)) {
+    server.send(403, "text/plain", "Pause, resume and stop are off; enable them on /config.");
+    return;
+  }
+  uint32_t seq = queuePrinterCommand(type, mode);
+  if (!seq) {
+    server.send(503, "text/plain", "Printer command queue full.");
+    return;
+  }
+  char body[64];
+  snprintf(body, sizeof(body), "{\"seq\":%u,\"command\":\"%s\"}", (unsigned)seq, PRINTER_COMMAND_NAMES[type]);
+  server.send(202, "application/json", body);
+}
+
+void handlePrinterCommandsJson() {
+  ChunkedResponse out(server);
+  out.begin(200, "application/json");
+  out.printf("{\"queued\":%u,\"sent\":%u,\"retries\":%u,", (unsigned)stats.queued, (unsigned)stats.sent,
+             (unsigned)stats.retries);
+  out.printf("\"done\":%u,\"failed\":%u,\"timed_out\":%u,", (unsigned)stats.done, (unsigned)stats.failed,
+             (unsigned)stats.timed_out);
+  out.printf("\"dropped\":%u,\"rejected\":%u,\"pending\":%u,", (unsigned)stats.dropped, (unsigned)stats.rejected,
+             printerCommandsPending());
+  out.print("\"commands\":[");
+  for (uint8_t i = 0; i < commandCount(); i++) {
+    const PrinterCommand& cmd = commandAt(i);
+    out.printf("%s{\"seq\":%u,\"command\":\"%s\",", i ? "," : "", (unsigned)cmd.seq,
+               PRINTER_COMMAND_NAMES[cmd.type]);
+    if (cmd.type == PRINTER_CMD_LEDCTRL) out.printf("\"mode\":\"%s\",", PRINTER_LED_MODE_NAMES[cmd.led_mode]);
+    out.printf("\"state\":\"%s\",\"attempts\":%u,\"age_ms\":%u", PRINTER_COMMAND_STATE_NAMES[cmd.state],
+               cmd.attempts, (unsigned)(millis() - cmd.queued_ms));
+    if (cmd.state == PRINTER_CMD_DONE || cmd.state == PRINTER_CMD_FAILED) {
+      out.printf(",\"rtt_ms\":%.1f", cmd.rtt_us / 1000.0);
+    }
+    out.print("}");
+  }
+  out.print("]}");
+  out.end();
+}
@@ -0,0 +1,98 @@
+#ifndef PRINTER_COMMANDS_H
+#define PRINTER_COMMANDS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "config.h"
+
+// Commands published to the printer on device/<serial>/request.
+// Commands are sent one at a time, in order, each with its own sequence_id.
+// A command is done when the printer's reply on the report topic carries the
+// same command and sequence_id (a pushall is answered by a full push_status).
+// A command with no reply within PRINTER_CMD_TIMEOUT_MS is sent again, up to
+// PRINTER_CMD_MAX_ATTEMPTS times. A command still waiting for the MQTT
+// connection after PRINTER_CMD_MAX_AGE_MS is dropped, so a stale pause or
+// stop never reaches the printer minutes later.
+//
+// The last PRINTER_CMD_SLOTS commands, pending or done, are kept for
+// /printer/commands.json. Round-trip times go to /metrics.
+//
+// pause, resume and stop act on the print, so the web API and WebSocket only
+// accept them with Config::printer_control on (off by default). A browser
+// request from another site's page is refused whatever the command.
+
+enum PrinterCommandType : uint8_t {
+  PRINTER_CMD_PUSHALL = 0, PRINTER_CMD_LEDCTRL, PRINTER_CMD_PAUSE,
+  PRINTER_CMD_RESUME, PRINTER_CMD_STOP, PRINTER_CMD_TYPE_COUNT
+};
+
+enum PrinterCommandState : uint8_t {
+  PRINTER_CMD_QUEUED = 0, // Waiting for its turn or for MQTT
+  PRINTER_CMD_SENT,       // Waiting for the reply
+  PRINTER_CMD_DONE,       // Printer replied with success
+  PRINTER_CMD_FAILED,     // Printer replied with another result
+  PRINTER_CMD_TIMED_OUT,  // No reply after PRINTER_CMD_MAX_ATTEMPTS
+  PRINTER_CMD_DROPPED,    // Never sent, older than PRINTER_CMD_MAX_AGE_MS
+  PRINTER_CMD_STATE_COUNT
+};
+
+// ledctrl modes, as the printer names them
+enum PrinterLedMode : uint8_t {
+  PRINTER_LED_ON = 0, PRINTER_LED_OFF, PRINTER_LED_FLASHING, PRINTER_LED_MODE_COUNT
+};
+
+struct PrinterCommand {
+  uint32_t seq;        // sequence_id
+  uint8_t type;        // PrinterCommandType
+  uint8_t state;       // PrinterCommandState
+  uint8_t attempts;
+  uint8_t led_mode;    // PrinterLedMode, ledctrl only
+  uint32_t queued_ms;
+  uint32_t sent_us;    // Last attempt
+  uint32_t rtt_us;     // Last attempt to reply, once replied
+};
+
+struct PrinterCommandStats {
+  uint32_t queued;
+  uint32_t sent;       // Publishes, retries included
+  uint32_t retries;
+  uint32_t done;
+  uint32_t failed;
+  uint32_t timed_out;
+  uint32_t dropped;
+  uint32_t rejected;   // Queue full
+};
+
+extern const char* const PRINTER_COMMAND_NAMES[PRINTER_CMD_TYPE_COUNT];
+extern const char* const PRINTER_COMMAND_STATE_NAMES[PRINTER_CMD_STATE_COUNT];
+extern const char* const PRINTER_LED_MODE_NAMES[PRINTER_LED_MODE_COUNT];
+
+// Name lookups; false if unknown
+bool printerCommandType(const char* name, PrinterCommandType* out);
+bool printerLedMode(const char* name, PrinterLedMode* out);
+
+// Queues a command; returns its sequence_id, or 0 if the queue is full
+uint32_t queuePrinterCommand(PrinterCommandType type, PrinterLedMode led_mode = PRINTER_LED_ON);
+
+// Called with every report before it is parsed. Returns true if it was only
+// a command reply, with no printer state to parse.
+bool handlePrinterCommandReply(JsonObject doc);
+
+// Commands oldest first; count() includes finished ones
+uint8_t printerCommandCount();
+const PrinterCommand& printerCommandAt(uint8_t index);
+const PrinterCommand* lastPrinterCommand(); // Newest, or nullptr
+uint8_t printerCommandsPending();
+const PrinterCommandStats& getPrinterCommandStats();
+
+// False for pause, resume and stop while Config::printer_control is off
+bool printerCommandAllowed(PrinterCommandType type);
+
+// "<command>[:<mode>]" from a WebSocket "CMD:" message, e.g. "ledctrl:on".
+// Returns 0 if unknown or not allowed.
+uint32_t queuePrinterCommandText(const char* text);
+
+void handlePrinterCommand();      // POST /printer/command?cmd=...[&mode=...]
+void handlePrinterCommandsJson(); // GET /printer/commands.json
+
+#endif
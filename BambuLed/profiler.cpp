@@ -0,0 +1,116 @@
+#include "profiler.h"
+
+#if ENABLE_PROFILER
+
+#include "web_handlers.h"
+#include "chunked_response.h"
+
+static const char* const STAGE_NAMES[PROF_STAGE_COUNT] = {
+  "loop", "ota", "http", "websocket", "sse", "mqtt", "timers", "history",
+  "state_checkpoint", "mqtt_parse", "led_update", "status_json"
+};
+
+struct StageStats {
+  uint32_t window[PROFILE_WINDOW]; // Ring of recent durations
+  uint16_t head;
+  uint16_t filled;
+  uint32_t count;
+  uint32_t max_ever;
+};
+
+struct StallCapture {
+  uint32_t at_ms;
+  uint32_t total_us;
+  uint32_t stage_us[PROF_STAGE_COUNT];
+};
+
+static StageStats stages[PROF_STAGE_COUNT];
+static uint32_t iteration_us[PROF_STAGE_COUNT]; // Time per stage in the current iteration
+static uint32_t loop_start_us = 0;
+
+static StallCapture stalls[PROFILE_STALL_CAPTURES];
+static uint8_t stall_head = 0;
+static uint8_t stall_count = 0;
+static uint32_t stall_total = 0;
+
+void profileRecord(ProfileStage stage, uint32_t us) {
+  StageStats& s = stages[stage];
+  s.window[s.head] = us;
+  s.head = (s.head + 1) % PROFILE_WINDOW;
+  if (s.filled < PROFILE_WINDOW) s.filled++;
+  s.count++;
+  if (us > s.max_ever) s.max_ever = us;
+  iteration_us[stage] += us;
+}
+
+void profileLoopBegin() {
+  memset(iteration_us, 0, sizeof(iteration_us));
+  loop_start_us = micros();
+}
+
+void profileLoopEnd() {
+  uint32_t total = micros() - loop_start_us;
+  profileRecord(PROF_LOOP, total);
+  if (total < PROFILE_STALL_US) return;
+
+  StallCapture& c = stalls[stall_head];
+  c.at_ms = millis();
+  c.total_us = total;
+  memcpy(c.stage_us, iteration_us, sizeof(c.stage_us));
+  stall_head = (stall_head + 1) % PROFILE_STALL_CAPTURES;
+  if (stall_count < PROFILE_STALL_CAPTURES) stall_count++;
+  stall_total++;
+}
+
+// --- /profile.json ---
+
+static int compareU32(const void* a, const void* b) {
+  uint32_t x = *(const uint32_t*)a;
+  uint32_t y = *(const uint32_t*)b;
+  return (x > y) - (x < y);
+}
+
+void handleProfileJson() {
+  ChunkedResponse out(server);
+  out.begin(200, "application/json");
+  out.printf("{\"window\":%u,\"stall_threshold_us\":%u,\"stages\":[",
+             PROFILE_WINDOW, (unsigned)PROFILE_STALL_US);
+
+  uint32_t sorted[PROFILE_WINDOW];
+  for (uint8_t i = 0; i < PROF_STAGE_COUNT; i++) {
+    const StageStats& s = stages[i];
+    uint32_t minUs = 0, maxUs = 0, p99 = 0, avg = 0;
+    if (s.filled) {
+      memcpy(sorted, s.window, s.filled * sizeof(uint32_t));
+      qsort(sorted, s.filled, sizeof(uint32_t), compareU32);
+      uint64_t sum = 0;
+      for (uint16_t j = 0; j < s.filled; j++) sum += sorted[j];
+      minUs = sorted[0];
+      maxUs = sorted[s.filled - 1];
+      p99 = sorted[(s.filled * 99) / 100];
+      avg = sum / s.filled;
+    }
+    out.printf("%s{\"name\":\"%s\",\"count\":%u,\"min\":%u,\"avg\":%u,\"p99\":%u,\"max\":%u,\"max_ever\":%u}",
+               i ? "," : "", STAGE_NAMES[i], (unsigned)s.count, (unsigned)minUs, (unsigned)avg,
+               (unsigned)p99, (unsigned)maxUs, (unsigned)s.max_ever);
+  }
+
+  out.printf("],\"stall_total\":%u,\"stalls\":[", (unsigned)stall_total);
+  // Newest first
+  for (uint8_t n = 0; n < stall_count; n++) {
+    const StallCapture& c = stalls[(stall_head + PROFILE_STALL_CAPTURES - 1 - n) % PROFILE_STALL_CAPTURES];
+    out.printf("%s{\"age_ms\":%u,\"total_us\":%u,\"stages\":{",
+               n ? "," : "", (unsigned)(millis() - c.at_ms), (unsigned)c.total_us);
+    bool first = true;
+    for (uint8_t i = 1; i < PROF_STAGE_COUNT; i++) {
+      if (!c.stage_us[i]) continue;
+      out.printf("%s\"%s\":%u", first ? "" : ",", STAGE_NAMES[i], (unsigned)c.stage_us[i]);
+      first = false;
+    }
+    out.print("}}");
+  }
+  out.print("]}");
+  out.end();
+}
+
+#endif // ENABLE_PROFILER
@@ -0,0 +1,64 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Scoped timing of loop() stages and selected handlers.
+// Each stage keeps its last PROFILE_WINDOW durations for min/avg/p99/max, and
+// any loop() iteration slower than PROFILE_STALL_US is captured with its
+// per-stage breakdown. With ENABLE_PROFILER set to 0 the macros below expand
+// to nothing and none of this is compiled in.
+
+enum ProfileStage : uint8_t {
+  PROF_LOOP = 0,        // Whole loop() iteration
+  PROF_OTA,
+  PROF_HTTP,
+  PROF_WEBSOCKET,
+  PROF_SSE,
+  PROF_MQTT,
+  PROF_TIMERS,           // Expired scheduler deadlines
+  PROF_HISTORY,         // Nested in PROF_TIMERS
+  PROF_STATE_CHECKPOINT, // Nested in PROF_TIMERS
+  PROF_MQTT_PARSE,      // Nested in PROF_MQTT
+  PROF_LED_UPDATE,      // Nested in whichever stage changed the state
+  PROF_STATUS_JSON,     // Nested in whichever stage asked for the JSON
+  PROF_STAGE_COUNT
+};
+
+#define PROFILE_WINDOW 128
+#define PROFILE_STALL_US 50000
+#define PROFILE_STALL_CAPTURES 8
+
+#if ENABLE_PROFILER
+
+void profileRecord(ProfileStage stage, uint32_t us);
+void profileLoopBegin();
+void profileLoopEnd();
+void handleProfileJson();
+
+class ProfileScope {
+public:
+  explicit ProfileScope(ProfileStage stage) : _stage(stage), _start(micros()) {}
+  ~ProfileScope() { profileRecord(_stage, micros() - _start); }
+
+private:
+  ProfileStage _stage;
+  uint32_t _start;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(stage) ProfileScope PROFILE_CONCAT(_profile_scope_, __LINE__)(stage)
+#define PROFILE_LOOP_BEGIN() profileLoopBegin()
+#define PROFILE_LOOP_END() profileLoopEnd()
+
+#else
+
+#define PROFILE_SCOPE(stage)
+#define PROFILE_LOOP_BEGIN()
+#define PROFILE_LOOP_END()
+
+#endif // ENABLE_PROFILER
+
+#endif
@@ -0,0 +1,438 @@
+#include "rules.h"
+#include "config.h"
+#include "mqtt_handler.h"
+#include "status_cache.h"
+#include "state_store.h"
+#include "web_handlers.h"
+#include "json_pool.h"
+#include "chunked_response.h"
+#include "logger.h"
+#include <ArduinoJson.h>
+#include <ctype.h>
+
+static const char* const FIELD_NAMES[RULE_FIELD_COUNT] = {
+  "state", "light_mode", "percent", "layer", "stage", "remaining",
+  "bed", "bed_target", "nozzle", "nozzle_target", "error"
+};
+
+static const char* const OP_NAMES[RULE_OP_COUNT] = {"==", "!=", "<", "<=", ">", ">="};
+
+// Index is LightModeCode
+static const char* const LIGHT_MODE_NAMES[] = {"unknown", "on", "off", "flashing"};
+
+static RuleTable active_rules;
+static char rules_error[RULE_ERROR_MAX]; // Why config.rules was not loaded, if it wasn't
+static RuleOutcome outcome;
+static bool outcome_valid = false;
+static bool rules_reloaded = false;
+
+uint32_t rules_eval_count = 0;
+uint32_t rules_eval_us = 0;
+
+// --- Compiler ---
+
+static char* trim(char* s) {
+  while (*s == ' ' || *s == '\t') s++;
+  char* end = s + strlen(s);
+  while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) *--end = '\0';
+  return s;
+}
+
+// Cuts `s` at the first `sep` and returns what follows, or nullptr
+static char* splitAt(char* s, const char* sep) {
+  char* at = strstr(s, sep);
+  if (!at) return nullptr;
+  *at = '\0';
+  return at + strlen(sep);
+}
+
+static bool parseLong(const char* s, long lo, long hi, long& out) {
+  char* end;
+  long v = strtol(s, &end, 10);
+  if (end == s || *end != '\0' || v < lo || v > hi) return false;
+  out = v;
+  return true;
+}
+
+static bool isTemperature(uint8_t field) {
+  return field >= RULE_FIELD_BED && field <= RULE_FIELD_NOZZLE_TARGET;
+}
+
+static bool parseCondition(char* text, RuleCondition& cond, char* error) {
+  char* name = trim(text);
+  char* p = name;
+  while (isalnum((unsigned char)*p) || *p == '_') p++;
+  char* nameEnd = p;
+  while (*p == ' ') p++;
+
+  char op[3] = {0};
+  size_t opLen = 0;
+  while (*p && strchr("=!<>", *p) && opLen < 2) op[opLen++] = *p++;
+  char* value = trim(p);
+  *nameEnd = '\0';
+
+  cond.field = RULE_FIELD_COUNT;
+  for (uint8_t i = 0; i < RULE_FIELD_COUNT; i++) {
+    if (strcmp(name, FIELD_NAMES[i]) == 0) cond.field = i;
+  }
+  if (cond.field == RULE_FIELD_COUNT) {
+    snprintf(error, RULE_ERROR_MAX, "unknown field '%s'", name);
+    return false;
+  }
+
+  if (strcmp(op, "=") == 0) strcpy(op, "==");
+  cond.op = RULE_OP_COUNT;
+  for (uint8_t i = 0; i < RULE_OP_COUNT; i++) {
+    if (strcmp(op, OP_NAMES[i]) == 0) cond.op = i;
+  }
+  if (cond.op == RULE_OP_COUNT || *value == '\0') {
+    snprintf(error, RULE_ERROR_MAX, "expected '%s <op> <value>'", name);
+    return false;
+  }
+
+  if (cond.field == RULE_FIELD_STATE || cond.field == RULE_FIELD_LIGHT_MODE) {
+    if (cond.op != RULE_OP_EQ && cond.op != RULE_OP_NE) {
+      snprintf(error, RULE_ERROR_MAX, "%s only supports == and !=", name);
+      return false;
+    }
+    char buf[16];
+    strlcpy(buf, value, sizeof(buf));
+    if (cond.field == RULE_FIELD_STATE) {
+      for (char* c = buf; *c; c++) *c = toupper((unsigned char)*c);
+      cond.value = gcodeStateCode(buf);
+      if (cond.value == GCODE_UNKNOWN && strcmp(buf, "UNKNOWN") != 0) {
+        snprintf(error, RULE_ERROR_MAX, "unknown state '%s'", value);
+        return false;
+      }
+    } else {
+      for (char* c = buf; *c; c++) *c = tolower((unsigned char)*c);
+      cond.value = lightModeCode(buf);
+      if (cond.value == LIGHT_MODE_UNKNOWN) {
+        snprintf(error, RULE_ERROR_MAX, "unknown light mode '%s'", value);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if (cond.field == RULE_FIELD_ERROR) {
+    if (strcmp(value, "true") == 0) value = (char*)"1";
+    if (strcmp(value, "false") == 0) value = (char*)"0";
+  }
+
+  char* end;
+  double number = strtod(value, &end);
+  if (end == value || *trim(end) != '\0') {
+    snprintf(error, RULE_ERROR_MAX, "'%s' is not a number", value);
+    return false;
+  }
+  cond.value = lround(isTemperature(cond.field) ? number * 10 : number);
+  return true;
+}
+
+static bool parseAction(char* text, CompiledRule& rule, char* error) {
+  char* verb = trim(text);
+  char* args = verb;
+  while (*args && *args != ' ') args++;
+  if (*args) {
+    *args++ = '\0';
+    args = trim(args);
+  }
+
+  long v;
+  if (strcmp(verb, "light") == 0) {
+    if (strcmp(args, "on") == 0) {
+      rule.light_percent = RULE_LIGHT_CONFIGURED;
+    } else if (strcmp(args, "off") == 0) {
+      rule.light_percent = 0;
+    } else if (parseLong(args, 0, 100, v)) {
+      rule.light_percent = v;
+    } else {
+      strlcpy(error, "expected 'light on', 'light off' or 'light <0-100>'", RULE_ERROR_MAX);
+      return false;
+    }
+    rule.actions |= RULE_ACTION_LIGHT;
+  } else if (strcmp(verb, "leds") == 0) {
+    if (strcmp(args, "off") == 0) {
+      rule.led_bright = 0;
+      rule.actions |= RULE_ACTION_LED_BRIGHT;
+      return true;
+    }
+    char* color = args;
+    char* bright = splitAt(color, " ");
+    if (*color == '#') color++;
+    bool hex = strlen(color) == 6;
+    for (char* c = color; hex && *c; c++) hex = isxdigit((unsigned char)*c);
+    if (!hex) {
+      strlcpy(error, "expected 'leds RRGGBB [0-255]' or 'leds off'", RULE_ERROR_MAX);
+      return false;
+    }
+    rule.led_color = strtoul(color, nullptr, 16);
+    rule.actions |= RULE_ACTION_LED_COLOR;
+    if (bright) {
+      if (!parseLong(trim(bright), 0, 255, v)) {
+        strlcpy(error, "LED brightness must be 0-255", RULE_ERROR_MAX);
+        return false;
+      }
+      rule.led_bright = v;
+      rule.actions |= RULE_ACTION_LED_BRIGHT;
+    }
+  } else if (strcmp(verb, "notify") == 0) {
+    if (*args == '\0') {
+      strlcpy(error, "notify needs a message", RULE_ERROR_MAX);
+      return false;
+    }
+    strlcpy(rule.notify, args, sizeof(rule.notify));
+    rule.actions |= RULE_ACTION_NOTIFY;
+  } else {
+    snprintf(error, RULE_ERROR_MAX, "unknown action '%s'", verb);
+    return false;
+  }
+  return true;
+}
+
+static bool compileLine(char* line, int lineNo, RuleTable& out, char* error) {
+  char* s = trim(line);
+  if (*s == '\0' || *s == '#') return true;
+  if (out.rule_count >= MAX_RULES) {
+    snprintf(error, RULE_ERROR_MAX, "more than %d rules", MAX_RULES);
+    return false;
+  }
+
+  if (strncmp(s, "when ", 5) == 0) s += 5;
+  char* actions;
+  if (strncmp(s, "then ", 5) == 0) {
+    actions = s + 5;
+    *s = '\0';
+  } else {
+    actions = splitAt(s, " then ");
+  }
+  if (!actions) {
+    strlcpy(error, "expected '<conditions> then <actions>'", RULE_ERROR_MAX);
+    return false;
+  }
+
+  CompiledRule& rule = out.rules[out.rule_count];
+  memset(&rule, 0, sizeof(rule));
+  rule.first_condition = out.condition_count;
+  rule.line = min(lineNo, 255);
+
+  // A rule without conditions always applies
+  char* cond = *trim(s) ? s : nullptr;
+  while (cond) {
+    char* next = splitAt(cond, " and ");
+    if (out.condition_count >= MAX_RULE_CONDITIONS) {
+      snprintf(error, RULE_ERROR_MAX, "more than %d conditions in total", MAX_RULE_CONDITIONS);
+      return false;
+    }
+    if (!parseCondition(cond, out.conditions[out.condition_count], error)) return false;
+    out.condition_count++;
+    rule.condition_count++;
+    cond = next;
+  }
+
+  char* action = actions;
+  while (action) {
+    // notify takes the rest of the line, commas included, so it must come last
+    char* verb = trim(action);
+    bool notify = strncmp(verb, "notify", 6) == 0 && (verb[6] == ' ' || verb[6] == '\0');
+    char* next = notify ? nullptr : splitAt(action, ",");
+    if (!parseAction(action, rule, error)) return false;
+    action = next;
+  }
+  if (!rule.actions) {
+    strlcpy(error, "no actions", RULE_ERROR_MAX);
+    return false;
+  }
+  out.rule_count++;
+  return true;
+}
+
+bool compileRules(const char* text, RuleTable& out, char* error) {
+  memset(&out, 0, sizeof(out));
+  error[0] = '\0';
+  char line[RULES_TEXT_MAX];
+  int lineNo = 0;
+  const char* p = text;
+  while (*p) {
+    const char* eol = strchr(p, '\n');
+    size_t len = eol ? (size_t)(eol - p) : strlen(p);
+    size_t copy = min(len, sizeof(line) - 1);
+    memcpy(line, p, copy);
+    line[copy] = '\0';
+    p += eol ? len + 1 : len;
+    lineNo++;
+
+    char detail[RULE_ERROR_MAX];
+    if (!compileLine(line, lineNo, out, detail)) {
+      snprintf(error, RULE_ERROR_MAX, "line %d: ", lineNo);
+      strlcat(error, detail, RULE_ERROR_MAX);
+      memset(&out, 0, sizeof(out));
+      return false;
+    }
+  }
+  return true;
+}
+
+// --- Evaluation ---
+
+static void collectState(int32_t* state) {
+  state[RULE_FIELD_STATE] = gcodeStateCode(current_gcode_state.c_str());
+  state[RULE_FIELD_LIGHT_MODE] = lightModeCode(current_light_mode.c_str());
+  state[RULE_FIELD_PERCENT] = current_print_percentage;
+  state[RULE_FIELD_LAYER] = current_layer;
+  state[RULE_FIELD_STAGE] = current_stage;
+  state[RULE_FIELD_REMAINING] = current_time_remaining;
+  state[RULE_FIELD_BED] = lroundf(current_bed_temp * 10);
+  state[RULE_FIELD_BED_TARGET] = lroundf(current_bed_target_temp * 10);
+  state[RULE_FIELD_NOZZLE] = lroundf(current_nozzle_temp * 10);
+  state[RULE_FIELD_NOZZLE_TARGET] = lroundf(current_nozzle_target_temp * 10);
+  state[RULE_FIELD_ERROR] = current_error_state ? 1 : 0;
+}
+
+static bool testCondition(const RuleCondition& c, const int32_t* state) {
+  int32_t v = state[c.field];
+  switch (c.op) {
+    case RULE_OP_EQ: return v == c.value;
+    case RULE_OP_NE: return v != c.value;
+    case RULE_OP_LT: return v < c.value;
+    case RULE_OP_LE: return v <= c.value;
+    case RULE_OP_GT: return v > c.value;
+    default:         return v >= c.value;
+  }
+}
+
+static void evaluateRules(const RuleTable& table, const int32_t* state, RuleOutcome& result) {
+  memset(&result, 0, sizeof(result));
+  for (uint8_t r = 0; r < table.rule_count; r++) {
+    const CompiledRule& rule = table.rules[r];
+    bool match = true;
+    for (uint8_t c = 0; match && c < rule.condition_count; c++) {
+      match = testCondition(table.conditions[rule.first_condition + c], state);
+    }
+    if (!match) continue;
+
+    result.matched |= 1UL << r;
+    if (rule.actions & RULE_ACTION_LIGHT) {
+      result.light_set = true;
+      result.light_percent = rule.light_percent == RULE_LIGHT_CONFIGURED
+                             ? config.chamber_pwm_brightness : rule.light_percent;
+    }
+    if (rule.actions & RULE_ACTION_LED_COLOR) {
+      result.led_color_set = true;
+      result.led_color = rule.led_color;
+    }
+    if (rule.actions & RULE_ACTION_LED_BRIGHT) {
+      result.led_bright_set = true;
+      result.led_bright = rule.led_bright;
+    }
+  }
+}
+
+// Notifications fire when a rule starts matching, not while it keeps matching
+static void notifyNewMatches(uint32_t started) {
+  if (printer_state_stale) return; // Restored state, nothing actually happened
+  for (uint8_t r = 0; started && r < active_rules.rule_count; r++) {
+    if (!(started & (1UL << r)) || !(active_rules.rules[r].actions & RULE_ACTION_NOTIFY)) continue;
+    LOG_INFO("Rule on line %u: %s", active_rules.rules[r].line, active_rules.rules[r].notify);
+    mqttHistoryPrintf(true, "Rule: %s", active_rules.rules[r].notify);
+  }
+}
+
+const RuleOutcome& getRuleOutcome() {
+  uint32_t version = getStatusVersion();
+  if (outcome_valid && outcome.status_version == version) return outcome;
+
+  uint32_t start = micros();
+  // After a reload the bits refer to other rules; don't re-announce
+  uint32_t previous = (outcome_valid && !rules_reloaded) ? outcome.matched : UINT32_MAX;
+  int32_t state[RULE_FIELD_COUNT];
+  collectState(state);
+  evaluateRules(active_rules, state, outcome);
+  outcome.status_version = version;
+  outcome_valid = true;
+  rules_reloaded = false;
+  rules_eval_us = micros() - start;
+  rules_eval_count++;
+
+  notifyNewMatches(outcome.matched & ~previous);
+  return outcome;
+}
+
+void loadRules() {
+  if (compileRules(config.rules, active_rules, rules_error)) {
+    LOG_INFO("Rules loaded: %u rules, %u conditions.", active_rules.rule_count, active_rules.condition_count);
+  } else {
+    LOG_WARN("Rules ignored: %s", rules_error);
+  }
+  rules_reloaded = true;
+  markStatusChanged();
+}
+
+// --- /rules.json ---
+
+void handleRulesJson() {
+  const RuleOutcome& result = getRuleOutcome();
+
+  JsonLease lease;
+  JsonDocument& doc = *lease;
+  doc["text"] = config.rules;
+  doc["error"] = rules_error;
+  doc["conditions"] = active_rules.condition_count;
+  doc["table_bytes"] = sizeof(RuleTable);
+  doc["evaluations"] = rules_eval_count;
+  doc["last_eval_us"] = rules_eval_us;
+
+  JsonArray rules = doc.createNestedArray("rules");
+  for (uint8_t r = 0; r < active_rules.rule_count; r++) {
+    const CompiledRule& rule = active_rules.rules[r];
+    JsonObject obj = rules.createNestedObject();
+    obj["line"] = rule.line;
+    obj["matched"] = (result.matched & (1UL << r)) != 0;
+    JsonArray conds = obj.createNestedArray("when");
+    for (uint8_t c = 0; c < rule.condition_count; c++) {
+      const RuleCondition& cond = active_rules.conditions[rule.first_condition + c];
+      JsonObject jc = conds.createNestedObject();
+      jc["field"] = FIELD_NAMES[cond.field];
+      jc["op"] = OP_NAMES[cond.op];
+      if (cond.field == RULE_FIELD_STATE) jc["value"] = GCODE_STATE_NAMES[cond.value];
+      else if (cond.field == RULE_FIELD_LIGHT_MODE) jc["value"] = LIGHT_MODE_NAMES[cond.value];
+      else if (isTemperature(cond.field)) jc["value"] = cond.value / 10.0f;
+      else jc["value"] = cond.value;
+    }
+    JsonObject then = obj.createNestedObject("then");
+    if (rule.actions & RULE_ACTION_LIGHT) {
+      if (rule.light_percent == RULE_LIGHT_CONFIGURED) then["light"] = "on";
+      else then["light"] = rule.light_percent;
+    }
+    if (rule.actions & RULE_ACTION_LED_COLOR) then["led_color"] = rule.led_color;
+    if (rule.actions & RULE_ACTION_LED_BRIGHT) then["led_bright"] = rule.led_bright;
+    if (rule.actions & RULE_ACTION_NOTIFY) then["notify"] = rule.notify;
+  }
+
+  // ?bench=N: time N evaluations of the active table against the current state
+  if (server.hasArg("bench")) {
+    long iterations = constrain(server.arg("bench").toInt(), 1L, 100000L);
+    RuleOutcome scratch;
+    uint32_t checksum = 0;
+    int32_t state[RULE_FIELD_COUNT];
+    uint32_t start = micros();
+    for (long i = 0; i < iterations; i++) {
+      collectState(state);
+      evaluateRules(active_rules, state, scratch);
+      checksum += scratch.matched;
+    }
+    uint32_t elapsed = micros() - start;
+    JsonObject bench = doc.createNestedObject("bench");
+    bench["iterations"] = iterations;
+    bench["total_us"] = elapsed;
+    bench["ns_per_eval"] = elapsed * 1000.0 / iterations;
+    bench["checksum"] = checksum; // Keeps the loop from being optimized out
+  }
+
+  server.sendHeader("Cache-Control", "no-store");
+  ChunkedResponse out(server);
+  out.begin(200, "application/json");
+  serializeJson(doc, out);
+  out.end();
+}
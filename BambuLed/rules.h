@@ -0,0 +1,100 @@
+#ifndef RULES_H
+#define RULES_H
+
+#include <Arduino.h>
+
+// User rules (Config::rules) change how the light and LEDs react to the
+// printer, on top of the built-in behaviour. One rule per line:
+//
+//   when state == RUNNING and layer <= 1 then light 100
+//   when percent >= 20 and percent < 80 then light 30, leds 0000FF 40
+//   when state == FINISH then notify Print done
+//
+// Actions are separated by commas, except that notify takes the rest of the
+// line as its text (commas included), so it must be the last action.
+//
+// The text is compiled once (boot, config change) into a flat decision table
+// and evaluated only when the status version changes, never per LED frame.
+// For each output the last matching rule wins; outputs no rule sets keep the
+// built-in behaviour. Manual light control still overrides everything.
+
+#define MAX_RULES 16             // Also the width of RuleOutcome::matched
+#define MAX_RULE_CONDITIONS 48   // Shared by all rules
+#define RULE_NOTIFY_MAX 32
+#define RULE_ERROR_MAX 80
+#define RULE_LIGHT_CONFIGURED 0xFF // "light on": use the configured brightness
+
+enum RuleField : uint8_t {
+  RULE_FIELD_STATE = 0,     // GcodeStateCode, written as the state name
+  RULE_FIELD_LIGHT_MODE,    // LightModeCode: on, off, flashing
+  RULE_FIELD_PERCENT,
+  RULE_FIELD_LAYER,
+  RULE_FIELD_STAGE,
+  RULE_FIELD_REMAINING,     // Minutes
+  RULE_FIELD_BED,           // Temperatures in C, compared in tenths
+  RULE_FIELD_BED_TARGET,
+  RULE_FIELD_NOZZLE,
+  RULE_FIELD_NOZZLE_TARGET,
+  RULE_FIELD_ERROR,         // 1 while FAILED / STOP
+  RULE_FIELD_COUNT
+};
+
+enum RuleOp : uint8_t {
+  RULE_OP_EQ = 0, RULE_OP_NE, RULE_OP_LT, RULE_OP_LE, RULE_OP_GT, RULE_OP_GE, RULE_OP_COUNT
+};
+
+enum RuleActionFlags : uint8_t {
+  RULE_ACTION_LIGHT      = 1 << 0,
+  RULE_ACTION_LED_COLOR  = 1 << 1,
+  RULE_ACTION_LED_BRIGHT = 1 << 2,
+  RULE_ACTION_NOTIFY     = 1 << 3,
+};
+
+struct RuleCondition {
+  uint8_t field;  // RuleField
+  uint8_t op;     // RuleOp
+  int32_t value;  // Temperatures x10, names as their codes
+};
+
+struct CompiledRule {
+  uint8_t first_condition;  // Index into RuleTable::conditions
+  uint8_t condition_count;
+  uint8_t actions;          // RuleActionFlags
+  uint8_t light_percent;    // 0 = off, RULE_LIGHT_CONFIGURED = configured level
+  uint8_t led_bright;
+  uint8_t line;             // Source line, for /rules.json
+  uint32_t led_color;
+  char notify[RULE_NOTIFY_MAX];
+};
+
+struct RuleTable {
+  uint8_t rule_count;
+  uint8_t condition_count;
+  CompiledRule rules[MAX_RULES];
+  RuleCondition conditions[MAX_RULE_CONDITIONS];
+};
+
+// The active table evaluated against the current printer state
+struct RuleOutcome {
+  uint32_t status_version;
+  uint32_t matched;         // Bit per rule
+  bool light_set;
+  uint8_t light_percent;
+  bool led_color_set;
+  uint32_t led_color;
+  bool led_bright_set;
+  uint8_t led_bright;
+};
+
+// Parses `text` into `out`. On failure returns false with the first problem,
+// prefixed by its line number, in `error` (RULE_ERROR_MAX bytes).
+bool compileRules(const char* text, RuleTable& out, char* error);
+
+void loadRules();                    // Compiles config.rules into the active table
+const RuleOutcome& getRuleOutcome(); // Evaluated once per status version
+void handleRulesJson();              // GET /rules.json[?bench=N]
+
+extern uint32_t rules_eval_count;
+extern uint32_t rules_eval_us;       // Duration of the last evaluation
+
+#endif
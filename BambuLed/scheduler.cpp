@@ -0,0 +1,69 @@
+#include "scheduler.h"
+#include "config.h"
+#include "metrics.h"
+
+struct Timer {
+  uint32_t deadline;
+  uint32_t period;  // 0 = one-shot
+  TimerCallback callback;
+  bool active;
+};
+
+static Timer timers[TIMER_SLOT_COUNT];
+
+static bool isDue(uint32_t deadline, uint32_t now) {
+  return (int32_t)(now - deadline) >= 0;
+}
+
+void timerStart(TimerSlot slot, uint32_t delay_ms, TimerCallback callback, uint32_t period_ms) {
+  Timer& t = timers[slot];
+  t.deadline = millis() + delay_ms;
+  t.period = period_ms;
+  t.callback = callback;
+  t.active = true;
+}
+
+void timerStop(TimerSlot slot) {
+  timers[slot].active = false;
+}
+
+bool timerActive(TimerSlot slot) {
+  return timers[slot].active;
+}
+
+uint32_t timerRunDue() {
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < TIMER_SLOT_COUNT; i++) {
+    Timer& t = timers[i];
+    if (!t.active || !isDue(t.deadline, now)) continue;
+
+    if (t.period) {
+      t.deadline += t.period;
+      // Fell behind (long loop iteration): skip the missed periods rather
+      // than firing a burst
+      if (isDue(t.deadline, now)) t.deadline = now + t.period;
+    } else {
+      t.active = false;
+    }
+    metricsCount(metrics.timers_fired);
+    if (t.callback) t.callback();
+  }
+
+  // Callbacks may have re-armed slots, so look for the next deadline afterwards
+  now = millis();
+  uint32_t next = TIMER_NONE;
+  for (uint8_t i = 0; i < TIMER_SLOT_COUNT; i++) {
+    const Timer& t = timers[i];
+    if (!t.active) continue;
+    uint32_t wait = isDue(t.deadline, now) ? 0 : t.deadline - now;
+    if (wait < next) next = wait;
+  }
+  return next;
+}
+
+void loopIdle(uint32_t next_deadline_ms) {
+  uint32_t sleep_ms = min(next_deadline_ms, (uint32_t)LOOP_MAX_SLEEP_MS);
+  // delay() blocks the loop task, which lets the idle task run (and the CPU
+  // clock down) instead of spinning through empty iterations
+  if (sleep_ms) delay(sleep_ms);
+}
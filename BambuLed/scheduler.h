@@ -0,0 +1,43 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+// One-shot and periodic deadlines for loop(). Each user owns a fixed slot, so
+// there is nothing to allocate and re-arming a slot replaces its deadline.
+// Deadlines are compared as signed differences and survive the 49-day
+// millis() wrap as long as no delay exceeds ~24 days. Callbacks run from
+// timerRunDue() on the loop task; a slot without a callback is just a
+// deadline to poll with timerActive(), which still wakes loop() when it
+// expires.
+
+enum TimerSlot : uint8_t {
+  TIMER_FINISH_TIMEOUT = 0, // Finish timeout for the chamber light and LED plan
+  TIMER_LED_FRAME,          // Animation frames while the LED plan is animated
+  TIMER_MQTT_RECONNECT,     // Backoff between MQTT connect attempts
+  TIMER_HISTORY,            // 1 Hz history sample
+  TIMER_STATE_CHECKPOINT,   // 1 Hz state checkpoint
+  TIMER_PRINTER_COMMAND,    // Printer command send / reply timeout, while any is pending
+  TIMER_MQTT_BRIDGE,        // Bridge reconnect backoff, or the earliest next publish pass
+  TIMER_SLOT_COUNT
+};
+
+typedef void (*TimerCallback)();
+
+const uint32_t TIMER_NONE = 0xFFFFFFFF; // timerRunDue(): nothing armed
+
+// Fires after delay_ms, then every period_ms if that is non-zero
+void timerStart(TimerSlot slot, uint32_t delay_ms, TimerCallback callback, uint32_t period_ms = 0);
+void timerStop(TimerSlot slot);
+bool timerActive(TimerSlot slot);
+
+// Runs every callback that is due. Periodic slots are re-armed before their
+// callback runs, so a callback may stop or restart its own slot. Returns the
+// ms until the next deadline, or TIMER_NONE.
+uint32_t timerRunDue();
+
+// Sleeps until the next deadline, but at most LOOP_MAX_SLEEP_MS since the
+// sockets are still polled from loop()
+void loopIdle(uint32_t next_deadline_ms);
+
+#endif
@@ -0,0 +1,140 @@
+#include "sse_broadcaster.h"
+#include "status_cache.h"
+#include "web_handlers.h"
+#include "metrics.h"
+#include "heap_guard.h"
+#include "logger.h"
+
+struct SseClient {
+  WiFiClient client;
+  bool connected;
+  uint32_t sent_version;   // Status version last delivered
+  uint32_t last_send_ms;   // Last status event
+  uint32_t last_write_ms;  // Last event or heartbeat
+};
+
+static SseClient sse_clients[SSE_MAX_CLIENTS];
+
+// One event is assembled here so it goes out in a single write
+static char event_buf[STATUS_JSON_CAPACITY + 48];
+
+static uint32_t baseIntervalMs() {
+  int rate = constrain(config.ws_max_rate_hz, 1, MAX_WS_RATE_HZ);
+  return 1000 / rate;
+}
+
+static void dropClient(uint8_t slot, const char* reason) {
+  LOG_INFO("SSE client %u %s.", slot, reason);
+  sse_clients[slot].client.stop();
+  sse_clients[slot].connected = false;
+}
+
+static bool writeToClient(uint8_t slot, const char* data, size_t len) {
+  SseClient& c = sse_clients[slot];
+  size_t written;
+  {
+    HEAP_GUARD_EXEMPT(); // lwIP queues the segment
+    written = c.client.write((const uint8_t*)data, len);
+  }
+  if (written != len) {
+    dropClient(slot, "not accepting data, disconnecting");
+    return false;
+  }
+  c.last_write_ms = millis();
+  metricsCount(metrics.sse_bytes_sent, len);
+  return true;
+}
+
+static void sendStatusEvent(uint8_t slot) {
+  char id[24];
+  getStatusEventId(id, sizeof(id));
+  size_t json_len;
+  const char* json = getStatusJson(&json_len);
+
+  // The JSON is serialized without newlines, so it fits in one data: line
+  int len = snprintf(event_buf, sizeof(event_buf), "id: %s\ndata: %.*s\n\n", id, (int)json_len, json);
+  if (len < 0 || (size_t)len >= sizeof(event_buf)) {
+    LOG_WARN("SSE event buffer too small, event dropped.");
+    return;
+  }
+
+  uint32_t version = getStatusVersion();
+  if (writeToClient(slot, event_buf, len)) {
+    sse_clients[slot].sent_version = version;
+    sse_clients[slot].last_send_ms = millis();
+    metricsCount(metrics.sse_events_sent);
+  }
+}
+
+void handleEvents() {
+  int slot = -1;
+  for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!sse_clients[i].connected || !sse_clients[i].client.connected()) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot < 0) {
+    server.sendHeader("Retry-After", "10");
+    server.send(503, "text/plain", "Too many event streams");
+    return;
+  }
+
+  SseClient& c = sse_clients[slot];
+  // Holding a copy of the client keeps the socket open after this handler
+  // returns; the response is written by hand because it never ends.
+  c.client = server.client();
+  c.connected = true;
+  c.sent_version = 0;
+  c.last_send_ms = 0;
+
+  char head[160];
+  int len = snprintf(head, sizeof(head),
+                     "HTTP/1.1 200 OK\r\n"
+                     "Content-Type: text/event-stream\r\n"
+                     "Cache-Control: no-cache\r\n"
+                     "Connection: keep-alive\r\n"
+                     "\r\n"
+                     "retry: %u\n\n", (unsigned)SSE_RETRY_MS);
+  if (!writeToClient(slot, head, len)) return;
+
+  IPAddress ip = c.client.remoteIP();
+  LOG_INFO("SSE client %u connected from %d.%d.%d.%d", slot, ip[0], ip[1], ip[2], ip[3]);
+
+  // A reconnecting browser sends the id of the last event it saw. If that is
+  // still the current status there is nothing to resend.
+  char id[24];
+  getStatusEventId(id, sizeof(id));
+  if (server.header("Last-Event-ID") == id) {
+    c.sent_version = getStatusVersion();
+    c.last_send_ms = millis();
+  } else {
+    sendStatusEvent(slot);
+  }
+}
+
+void serviceSseClients() {
+  uint32_t version = getStatusVersion();
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+    SseClient& c = sse_clients[i];
+    if (!c.connected) continue;
+    if (!c.client.connected()) {
+      dropClient(i, "disconnected");
+      continue;
+    }
+    if (c.sent_version != version) {
+      if (now - c.last_send_ms >= baseIntervalMs()) sendStatusEvent(i); // Otherwise stays pending
+    } else if (now - c.last_write_ms >= SSE_HEARTBEAT_MS) {
+      writeToClient(i, ": ping\n\n", 8);
+    }
+  }
+}
+
+uint8_t getSseClientCount() {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (sse_clients[i].connected) count++;
+  }
+  return count;
+}
@@ -0,0 +1,23 @@
+#ifndef SSE_BROADCASTER_H
+#define SSE_BROADCASTER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "config.h"
+
+// Server-Sent Events status stream on the main web server (GET /events).
+// Delivery works like the WebSocket clients: each stream remembers the status
+// version it last received and gets the *current* status when it is due, so
+// nothing is queued and intermediate versions are skipped.
+
+#define SSE_MAX_CLIENTS 4
+// Comment line sent on idle streams so proxies and browsers keep them open
+const uint32_t SSE_HEARTBEAT_MS = 15000;
+// Reconnect delay suggested to the browser
+const uint32_t SSE_RETRY_MS = 3000;
+
+void handleEvents();       // GET /events
+void serviceSseClients();  // Called from loop()
+uint8_t getSseClientCount();
+
+#endif
@@ -0,0 +1,210 @@
+#include "state_store.h"
+#include "config_store.h" // configCrc32
+#include "mqtt_handler.h"
+#include "light_controller.h"
+#include "led_controller.h"
+#include "status_cache.h"
+#include <LittleFS.h>
+#include <esp_system.h>
+#include <time.h>
+
+// Survives software resets, not power cuts; the CRC tells garbage apart
+static RTC_NOINIT_ATTR PrinterCheckpoint rtc_checkpoint;
+
+static PrinterCheckpoint flash_checkpoint; // Copy last written to (or read from) flash
+static bool flash_dirty = false;
+static unsigned long last_flash_write = 0;
+
+#if ZERO_HEAP_AFTER_BOOT
+// Opened once at boot and rewritten in place; opening a file allocates
+static File checkpoint_file;
+#endif
+
+// Finish time restored from flash, applied once SNTP has set the clock
+static uint32_t pending_finish_epoch = 0;
+
+// Anything earlier means the clock has not been set yet
+static const time_t MIN_VALID_EPOCH = 1600000000;
+// Older finish times are dropped instead of restored
+static const uint32_t MAX_FINISH_RESTORE_AGE_S = 86400;
+
+// Index is LightModeCode
+static const char* const LIGHT_MODE_NAMES[] = {"UNKNOWN", "on", "off", "flashing"};
+
+static uint32_t checkpointCrc(const PrinterCheckpoint& cp) {
+  return configCrc32((const uint8_t*)&cp, offsetof(PrinterCheckpoint, crc));
+}
+
+static bool checkpointValid(const PrinterCheckpoint& cp) {
+  return cp.magic == STATE_CHECKPOINT_MAGIC &&
+         cp.version == STATE_CHECKPOINT_VERSION &&
+         cp.size == sizeof(PrinterCheckpoint) &&
+         cp.crc == checkpointCrc(cp) &&
+         cp.gcode_state < GCODE_STATE_COUNT &&
+         cp.light_mode <= LIGHT_MODE_FLASHING;
+}
+
+static int16_t toX10(float value) {
+  return (int16_t)constrain(lroundf(value * 10.0f), -32768L, 32767L);
+}
+
+static void captureCheckpoint(PrinterCheckpoint& cp) {
+  memset(&cp, 0, sizeof(cp));
+  cp.magic = STATE_CHECKPOINT_MAGIC;
+  cp.version = STATE_CHECKPOINT_VERSION;
+  cp.size = sizeof(PrinterCheckpoint);
+  cp.gcode_state = gcodeStateCode(current_gcode_state.c_str());
+  cp.light_mode = lightModeCode(current_light_mode.c_str());
+  if (external_light_is_on) cp.flags |= CHECKPOINT_FLAG_LIGHT_ON;
+  if (manual_light_control) cp.flags |= CHECKPOINT_FLAG_MANUAL;
+  cp.print_percentage = constrain(current_print_percentage, 0, 100);
+  cp.layer_num = constrain(current_layer, 0, 32767);
+  cp.stage = constrain(current_stage, -32768, 32767);
+  cp.time_remaining = current_time_remaining;
+  cp.nozzle_temp_x10 = toX10(current_nozzle_temp);
+  cp.nozzle_target_x10 = toX10(current_nozzle_target_temp);
+  cp.bed_temp_x10 = toX10(current_bed_temp);
+  cp.bed_target_x10 = toX10(current_bed_target_temp);
+
+  if (finishTime > 0) {
+    cp.flags |= CHECKPOINT_FLAG_FINISH_TIMER;
+    cp.finish_age_ms = millis() - finishTime;
+    time_t now = time(nullptr);
+    if (now > MIN_VALID_EPOCH) cp.finish_epoch = now - cp.finish_age_ms / 1000;
+  }
+  cp.crc = checkpointCrc(cp);
+}
+
+// Only changes that affect the light or LEDs are worth a flash write;
+// temperatures and time remaining ride along with the next one
+static bool flashWorthyChange(const PrinterCheckpoint& cp, const PrinterCheckpoint& stored) {
+  return !checkpointValid(stored) ||
+         cp.gcode_state != stored.gcode_state ||
+         cp.light_mode != stored.light_mode ||
+         cp.flags != stored.flags ||
+         cp.print_percentage != stored.print_percentage ||
+         (cp.finish_epoch != 0 && stored.finish_epoch == 0);
+}
+
+static bool readFlashCheckpoint(PrinterCheckpoint& cp) {
+  if (!LittleFS.exists(STATE_CHECKPOINT_PATH)) return false;
+  File f = LittleFS.open(STATE_CHECKPOINT_PATH, "r");
+  if (!f) return false;
+  bool ok = f.read((uint8_t*)&cp, sizeof(cp)) == sizeof(cp) && checkpointValid(cp);
+  f.close();
+  if (!ok) Serial.println("State checkpoint in flash is invalid, ignoring it.");
+  return ok;
+}
+
+static void writeFlashCheckpoint(const PrinterCheckpoint& cp) {
+#if ZERO_HEAP_AFTER_BOOT
+  File& f = checkpoint_file;
+  if (!f || !f.seek(0)) {
+#else
+  File f = LittleFS.open(STATE_CHECKPOINT_PATH, "w");
+  if (!f) {
+#endif
+    Serial.println("Failed to open state checkpoint for writing");
+    return;
+  }
+  bool ok = f.write((const uint8_t*)&cp, sizeof(cp)) == sizeof(cp);
+#if ZERO_HEAP_AFTER_BOOT
+  f.flush();
+#else
+  f.close();
+#endif
+  if (ok) flash_checkpoint = cp;
+}
+
+bool restorePrinterState() {
+  bool haveFlash = readFlashCheckpoint(flash_checkpoint);
+#if ZERO_HEAP_AFTER_BOOT
+  checkpoint_file = LittleFS.open(STATE_CHECKPOINT_PATH, LittleFS.exists(STATE_CHECKPOINT_PATH) ? "r+" : "w+");
+#endif
+
+  // RTC memory is only meaningful if the chip kept power
+  esp_reset_reason_t reason = esp_reset_reason();
+  bool fromRtc = reason != ESP_RST_POWERON && reason != ESP_RST_BROWNOUT &&
+                 checkpointValid(rtc_checkpoint);
+  if (!fromRtc && !haveFlash) {
+    Serial.println("No printer state checkpoint, starting idle.");
+    return false;
+  }
+  const PrinterCheckpoint cp = fromRtc ? rtc_checkpoint : flash_checkpoint;
+
+  current_gcode_state = cp.gcode_state == GCODE_UNKNOWN ? "IDLE" : GCODE_STATE_NAMES[cp.gcode_state];
+  current_light_mode = LIGHT_MODE_NAMES[cp.light_mode];
+  current_print_percentage = cp.print_percentage;
+  current_layer = cp.layer_num;
+  current_stage = cp.stage;
+  current_time_remaining = cp.time_remaining;
+  current_nozzle_temp = cp.nozzle_temp_x10 / 10.0f;
+  current_nozzle_target_temp = cp.nozzle_target_x10 / 10.0f;
+  current_bed_temp = cp.bed_temp_x10 / 10.0f;
+  current_bed_target_temp = cp.bed_target_x10 / 10.0f;
+  current_error_state = (current_gcode_state == "FAILED" || current_gcode_state == "STOP");
+  manual_light_control = cp.flags & CHECKPOINT_FLAG_MANUAL;
+
+  if (cp.flags & CHECKPOINT_FLAG_FINISH_TIMER) {
+    if (fromRtc) {
+      // The reboot itself (a few seconds) is not counted
+      finishTime = millis() - cp.finish_age_ms;
+      if (finishTime == 0) finishTime = 1;
+      scheduleFinishTimeout();
+    } else if (cp.finish_epoch) {
+      // millis() means nothing after a power cut; wait for the clock
+      pending_finish_epoch = cp.finish_epoch;
+    }
+  }
+
+  setChamberLightState(cp.flags & CHECKPOINT_FLAG_LIGHT_ON);
+  refreshLEDs();
+
+  printer_state_stale = true;
+  markStatusChanged();
+  Serial.printf("Restored last known printer state from %s: %s, %d%%, light %s (stale until first report)\n",
+                fromRtc ? "RTC memory" : "flash", current_gcode_state.c_str(), current_print_percentage,
+                external_light_is_on ? "ON" : "OFF");
+  return true;
+}
+
+static void resolvePendingFinish() {
+  time_t now = time(nullptr);
+  if (now < MIN_VALID_EPOCH) return;
+
+  uint32_t age_s = now > (time_t)pending_finish_epoch ? now - pending_finish_epoch : 0;
+  pending_finish_epoch = 0;
+  // A live report may have moved on, or started its own timer, meanwhile
+  if (age_s > MAX_FINISH_RESTORE_AGE_S || finishTime != 0 || current_gcode_state != "FINISH") return;
+
+  finishTime = millis() - age_s * 1000UL;
+  if (finishTime == 0) finishTime = 1;
+  scheduleFinishTimeout();
+  Serial.printf("Restored finish timer: print finished %u s ago.\n", (unsigned)age_s);
+  refreshLEDs();
+}
+
+void stateCheckpointTick() {
+  if (pending_finish_epoch) resolvePendingFinish();
+
+  unsigned long now = millis();
+
+  PrinterCheckpoint cp;
+  captureCheckpoint(cp);
+  rtc_checkpoint = cp;
+
+  if (flashWorthyChange(cp, flash_checkpoint)) flash_dirty = true;
+  if (flash_dirty && now - last_flash_write >= STATE_FLASH_MIN_INTERVAL_MS) {
+    writeFlashCheckpoint(cp);
+    last_flash_write = now;
+    flash_dirty = false;
+  }
+}
+
+void eraseStateCheckpoint() {
+  rtc_checkpoint.magic = 0;
+#if ZERO_HEAP_AFTER_BOOT
+  checkpoint_file.close();
+#endif
+  if (LittleFS.exists(STATE_CHECKPOINT_PATH)) LittleFS.remove(STATE_CHECKPOINT_PATH);
+}
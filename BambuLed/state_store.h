@@ -0,0 +1,60 @@
+#ifndef STATE_STORE_H
+#define STATE_STORE_H
+
+#include <Arduino.h>
+
+// Last known printer state and finish timer, kept so the light and LEDs come
+// back as they were after a reboot instead of showing idle until MQTT delivers
+// a report.
+//
+// The checkpoint lives in RTC memory that survives software resets, OTA and
+// crashes, refreshed at most once a second. A flash copy is written only when
+// something that changes the lights moves (state, light mode, progress,
+// manual control, finish timer), at most every STATE_FLASH_MIN_INTERVAL_MS,
+// and is used after a power cut.
+//
+// Restored values are provisional: printer_state_stale stays set until the
+// first live report replaces them.
+
+#define STATE_CHECKPOINT_MAGIC 0x54534C42 // "BLST"
+#define STATE_CHECKPOINT_VERSION 1
+#define STATE_CHECKPOINT_PATH "/state.bin"
+
+const unsigned long STATE_CHECKPOINT_INTERVAL_MS = 1000;
+const unsigned long STATE_FLASH_MIN_INTERVAL_MS = 10000;
+
+enum CheckpointFlags : uint8_t {
+  CHECKPOINT_FLAG_LIGHT_ON     = 1 << 0,
+  CHECKPOINT_FLAG_MANUAL       = 1 << 1,
+  CHECKPOINT_FLAG_FINISH_TIMER = 1 << 2,
+};
+
+struct PrinterCheckpoint {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;              // sizeof(PrinterCheckpoint)
+  uint8_t  gcode_state;       // GcodeStateCode
+  uint8_t  light_mode;        // LightModeCode
+  uint8_t  flags;             // CheckpointFlags
+  uint8_t  print_percentage;
+  int16_t  layer_num;
+  int16_t  stage;
+  int32_t  time_remaining;
+  int16_t  nozzle_temp_x10;
+  int16_t  nozzle_target_x10;
+  int16_t  bed_temp_x10;
+  int16_t  bed_target_x10;
+  uint32_t finish_age_ms;     // millis() - finishTime when written
+  uint32_t finish_epoch;      // Wall-clock finish time, 0 if the clock was not set
+  uint32_t crc;               // CRC-32 of everything above
+};
+
+extern bool printer_state_stale;
+
+// Call after config and hardware are initialized. Returns true if a
+// checkpoint was applied.
+bool restorePrinterState();
+void stateCheckpointTick(); // Every STATE_CHECKPOINT_INTERVAL_MS (TIMER_STATE_CHECKPOINT)
+void eraseStateCheckpoint();
+
+#endif
@@ -0,0 +1,105 @@
+#include "status_cache.h"
+#include "web_handlers.h"
+#include "profiler.h"
+#include "json_pool.h"
+#include "logger.h"
+#include <ArduinoJson.h>
+
+static uint32_t status_version = 1;
+static uint16_t details_version = 1;
+static uint32_t cached_version = 0;
+static uint32_t boot_id = 0;
+
+static char status_json[STATUS_JSON_CAPACITY];
+static size_t status_json_len = 0;
+static uint32_t status_json_encode_us = 0;
+
+static StatusFrame status_frame;
+static uint32_t frame_version = 0;
+static uint32_t status_frame_encode_us = 0;
+
+const char* const GCODE_STATE_NAMES[GCODE_STATE_COUNT] = {
+  "UNKNOWN", "IDLE", "PREPARE", "RUNNING", "PAUSE",
+  "PAUSED", "FINISH", "FAILED", "STOP", "SLICING",
+  "INIT", "OFFLINE"
+};
+
+GcodeStateCode gcodeStateCode(const char* state) {
+  for (uint8_t i = 1; i < GCODE_STATE_COUNT; i++) {
+    if (strcmp(state, GCODE_STATE_NAMES[i]) == 0) return (GcodeStateCode)i;
+  }
+  return GCODE_UNKNOWN;
+}
+
+LightModeCode lightModeCode(const char* mode) {
+  if (strcmp(mode, "on") == 0) return LIGHT_MODE_ON;
+  if (strcmp(mode, "off") == 0) return LIGHT_MODE_OFF;
+  if (strcmp(mode, "flashing") == 0) return LIGHT_MODE_FLASHING;
+  return LIGHT_MODE_UNKNOWN;
+}
+
+void markStatusChanged() {
+  status_version++;
+}
+
+uint32_t getStatusVersion() {
+  return status_version;
+}
+
+void markStatusDetailsChanged() {
+  details_version++;
+  markStatusChanged();
+}
+
+uint16_t getStatusDetailsVersion() {
+  return details_version;
+}
+
+const char* getStatusJson(size_t* length) {
+  if (cached_version != status_version) {
+    PROFILE_SCOPE(PROF_STATUS_JSON);
+    uint32_t start = micros();
+    JsonLease doc;
+    createStatusJson(*doc);
+    status_json_len = serializeJson(*doc, status_json, sizeof(status_json));
+    if (doc->overflowed() || status_json_len >= sizeof(status_json) - 1) {
+      LOG_ERROR("Status JSON truncated, increase STATUS_JSON_CAPACITY.");
+      // Clients get valid JSON they can tell apart, not a cut-off document
+      status_json_len = snprintf(status_json, sizeof(status_json), "{\"version\":%u,\"error\":\"truncated\"}",
+                                 (unsigned)status_version);
+    }
+    cached_version = status_version;
+    status_json_encode_us = micros() - start;
+  }
+  *length = status_json_len;
+  return status_json;
+}
+
+const uint8_t* getStatusFrame(size_t* length) {
+  if (frame_version != status_version) {
+    uint32_t start = micros();
+    encodeStatusFrame(status_frame);
+    frame_version = status_version;
+    status_frame_encode_us = micros() - start;
+  }
+  *length = sizeof(status_frame);
+  return (const uint8_t*)&status_frame;
+}
+
+uint32_t getStatusJsonEncodeUs() {
+  return status_json_encode_us;
+}
+
+uint32_t getStatusFrameEncodeUs() {
+  return status_frame_encode_us;
+}
+
+void getStatusEventId(char* buf, size_t size) {
+  if (boot_id == 0) boot_id = esp_random() | 1;
+  snprintf(buf, size, "%08x-%u", (unsigned)boot_id, (unsigned)status_version);
+}
+
+void getStatusEtag(char* buf, size_t size) {
+  if (boot_id == 0) boot_id = esp_random() | 1;
+  snprintf(buf, size, "\"%08x-%u\"", (unsigned)boot_id, (unsigned)status_version);
+}
@@ -0,0 +1,105 @@
+#ifndef STATUS_CACHE_H
+#define STATUS_CACHE_H
+
+#include <Arduino.h>
+
+// Serialized status JSON is cached per state version. Anything that changes a
+// value reported by createStatusJson() must call markStatusChanged(); every
+// consumer (HTTP, WebSocket) then shares the same pre-serialized buffer.
+const size_t STATUS_JSON_CAPACITY = 3584; // Room for HMS_MAX_ENTRIES descriptions and AMS_MAX_UNITS units
+
+void markStatusChanged();
+uint32_t getStatusVersion();
+
+// The HMS and AMS lists are only in the JSON. Changing them also bumps the
+// details version, which the binary frame carries so that its clients know
+// when to fetch /status.json again.
+void markStatusDetailsChanged();
+uint16_t getStatusDetailsVersion();
+
+// Returns the JSON for the current version, serializing it only if stale.
+const char* getStatusJson(size_t* length);
+
+// "<boot id>-<version>", used as the SSE event id
+void getStatusEventId(char* buf, size_t size);
+// Strong ETag for the current version, unique across reboots
+void getStatusEtag(char* buf, size_t size);
+
+// --- Compact binary status frame ---
+// Sent to WebSocket clients that ask for it with "PROTO:BIN". Display strings
+// are replaced by codes; web/status.js keeps the matching label tables, so
+// both sides must change together. Multi-byte fields are little-endian.
+const uint8_t STATUS_FRAME_MAGIC = 0xB1;
+const uint8_t STATUS_FRAME_VERSION = 2;
+
+// Index into GCODE_STATE_NAMES
+enum GcodeStateCode : uint8_t {
+  GCODE_UNKNOWN = 0, GCODE_IDLE, GCODE_PREPARE, GCODE_RUNNING, GCODE_PAUSE,
+  GCODE_PAUSED, GCODE_FINISH, GCODE_FAILED, GCODE_STOP, GCODE_SLICING,
+  GCODE_INIT, GCODE_OFFLINE, GCODE_STATE_COUNT
+};
+
+enum LightModeCode : uint8_t {
+  LIGHT_MODE_UNKNOWN = 0, LIGHT_MODE_ON, LIGHT_MODE_OFF, LIGHT_MODE_FLASHING
+};
+
+enum LedStatusCode : uint8_t {
+  LED_STATUS_DISABLED = 0, LED_STATUS_ERROR, LED_STATUS_PAUSED,
+  LED_STATUS_FINISH, LED_STATUS_FINISH_TIMING_OUT, LED_STATUS_FINISH_TIMEOUT_IDLE,
+  LED_STATUS_PRINTING, LED_STATUS_IDLE,
+  LED_STATUS_HMS_FATAL, LED_STATUS_HMS_SERIOUS, LED_STATUS_HMS_WARNING
+};
+
+enum LightExtraCode : uint8_t {
+  LIGHT_EXTRA_NONE = 0, LIGHT_EXTRA_FINISH_ON, LIGHT_EXTRA_FINISH_OFF
+};
+
+enum StatusFrameFlags : uint16_t {
+  STATUS_FLAG_MQTT_CONNECTED = 1 << 0,
+  STATUS_FLAG_LIGHT_ON       = 1 << 1,
+  STATUS_FLAG_MANUAL_CONTROL = 1 << 2,
+  STATUS_FLAG_IS_PRINTING    = 1 << 3,
+  STATUS_FLAG_INVERT_OUTPUT  = 1 << 4,
+  STATUS_FLAG_STATE_STALE    = 1 << 5, // Restored after reboot, no live report yet
+};
+
+struct __attribute__((packed)) StatusFrame {
+  uint8_t  magic;
+  uint8_t  frame_version;
+  uint16_t flags;              // StatusFrameFlags
+  uint32_t status_version;
+  uint8_t  gcode_state;        // GcodeStateCode
+  uint8_t  print_percentage;
+  int16_t  stage;
+  uint16_t layer_num;
+  int32_t  time_remaining;
+  int16_t  nozzle_temp_x10;
+  int16_t  nozzle_target_x10;
+  int16_t  bed_temp_x10;
+  int16_t  bed_target_x10;
+  int8_t   wifi_signal_dbm;    // 0 when unknown
+  uint8_t  bambu_light_mode;   // LightModeCode
+  uint8_t  chamber_bright;
+  uint8_t  light_extra;        // LightExtraCode
+  uint8_t  led_status;         // LedStatusCode
+  uint8_t  led_bright;
+  uint8_t  led_color[3];       // R, G, B
+  uint8_t  light_pin;
+  uint8_t  led_pin;
+  uint8_t  num_leds;
+  uint16_t details_version;    // getStatusDetailsVersion()
+};
+static_assert(sizeof(StatusFrame) == 40, "StatusFrame layout is part of the wire protocol");
+
+extern const char* const GCODE_STATE_NAMES[GCODE_STATE_COUNT];
+GcodeStateCode gcodeStateCode(const char* state);
+LightModeCode lightModeCode(const char* mode);
+
+// Returns the binary frame for the current version, encoding it only if stale.
+const uint8_t* getStatusFrame(size_t* length);
+
+// Time the last JSON / binary encode took, for comparing the two
+uint32_t getStatusJsonEncodeUs();
+uint32_t getStatusFrameEncodeUs();
+
+#endif
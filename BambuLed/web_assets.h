@@ -0,0 +1,866 @@
+// Generated by tools/build_web_assets.py from web/ -- do not edit by hand.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+#include "config.h"
+
+struct WebAsset {
+  const char* uri;
+  const char* content_type;
+  const char* etag;
+  bool immutable;          // Fingerprinted URI, safe to cache forever
+  const uint8_t* gz_data;  // gzip-compressed body
+  size_t gz_length;
+  size_t raw_length;       // Before compression
+};
+
+#define WEB_ASSET_STATUS_CSS_URI "/static/status.616c072a.css"
+#define WEB_ASSET_STATUS_JS_URI "/static/status.73242f02.js"
+#define WEB_ASSET_CONFIG_CSS_URI "/static/config.4fe89941.css"
+#define WEB_ASSET_CONFIG_JS_URI "/static/config.806c12f4.js"
+#define WEB_ASSET_MQTT_CSS_URI "/static/mqtt.bd145ff2.css"
+#define WEB_ASSET_MQTT_JS_URI "/static/mqtt.1369f74f.js"
+#define WEB_ASSET_PROFILE_CSS_URI "/static/profile.79f3f54f.css"
+#define WEB_ASSET_PROFILE_JS_URI "/static/profile.b0859347.js"
+
+// status.css: 3889 bytes, 1273 gzipped
+static const uint8_t WEB_ASSET_STATUS_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x57, 0x4b, 0x6f, 0xe3, 0x36,
+  0x10, 0xbe, 0xfb, 0x57, 0x10, 0x1b, 0x14, 0x88, 0x01, 0x4b, 0xd0, 0xc3, 0xf2, 0xf3, 0xd4, 0x1e,
+  0x8a, 0xf6, 0xd0, 0x1e, 0xba, 0xe8, 0x39, 0xa0, 0x48, 0x4a, 0x26, 0x42, 0x89, 0x02, 0x49, 0x3b,
+  0x71, 0x17, 0xf9, 0xef, 0x1d, 0x92, 0x7a, 0xda, 0x8e, 0xe3, 0x02, 0x8d, 0x81, 0x64, 0xc9, 0xf1,
+  0x7c, 0x9c, 0xe7, 0x37, 0xb3, 0x3b, 0x25, 0xa5, 0x41, 0x3f, 0x66, 0x08, 0x05, 0x41, 0x5e, 0x06,
+  0x44, 0x0a, 0xa9, 0x76, 0xe8, 0x29, 0xc6, 0xf0, 0xc9, 0xf7, 0xee, 0x9a, 0x60, 0x45, 0x7b, 0x41,
+  0x42, 0xe0, 0xc3, 0xbc, 0x20, 0x97, 0x8a, 0x32, 0xd5, 0x8b, 0x96, 0xcb, 0xa5, 0xbf, 0x37, 0xec,
+  0xdd, 0xf4, 0xb7, 0x2c, 0xb2, 0x9f, 0x4b, 0x41, 0x50, 0x1d, 0x0d, 0xa3, 0x20, 0xc6, 0x18, 0x5f,
+  0xc9, 0x72, 0xc5, 0xcb, 0x83, 0x01, 0x61, 0xe1, 0x7e, 0xbc, 0xbc, 0x51, 0xbc, 0xc2, 0xea, 0xdc,
+  0xe3, 0xa6, 0xeb, 0x0d, 0x29, 0x5a, 0xdc, 0x52, 0x31, 0x56, 0x0f, 0x26, 0x6e, 0xf0, 0x7a, 0x99,
+  0x79, 0x89, 0x62, 0x83, 0xe9, 0x94, 0xa4, 0x59, 0x77, 0x0f, 0x1a, 0x03, 0xd4, 0x8a, 0xac, 0xb3,
+  0x35, 0xdd, 0xcf, 0x3e, 0x66, 0xb9, 0xa4, 0x67, 0xf4, 0x03, 0xc1, 0x57, 0x0a, 0x59, 0x9b, 0xa0,
+  0xc0, 0x15, 0x17, 0xe7, 0x1d, 0x0a, 0x70, 0xd3, 0x08, 0x16, 0xe8, 0xb3, 0x36, 0xac, 0x5a, 0xa0,
+  0x5f, 0x04, 0xaf, 0x5f, 0xff, 0xc0, 0xe4, 0xbb, 0x3b, 0xff, 0x0a, 0xdf, 0x5c, 0xa0, 0x6f, 0xdf,
+  0x59, 0x29, 0x19, 0xfa, 0xfb, 0xf7, 0x6f, 0x0b, 0xf4, 0x97, 0xcc, 0xa5, 0x91, 0x70, 0xf7, 0x1b,
+  0x13, 0x27, 0x66, 0x38, 0xc1, 0xe8, 0x4f, 0x76, 0x64, 0x20, 0xf9, 0x59, 0x71, 0x2c, 0x16, 0x48,
+  0xe3, 0x5a, 0x07, 0x9a, 0x29, 0xee, 0x7c, 0x03, 0xb7, 0x4a, 0x5e, 0xef, 0x50, 0xb4, 0xb7, 0x0f,
+  0x37, 0x98, 0x52, 0x5e, 0x97, 0x3b, 0x14, 0x2b, 0x56, 0x59, 0x71, 0x8e, 0xc9, 0x6b, 0xa9, 0xe4,
+  0xb1, 0xee, 0x3d, 0x39, 0x61, 0xf5, 0x3c, 0x64, 0x6b, 0xee, 0xd4, 0x26, 0xa2, 0x21, 0x96, 0x5e,
+  0x58, 0xe1, 0xf7, 0xe0, 0x8d, 0x53, 0x73, 0xd8, 0xa1, 0x6d, 0x14, 0x35, 0xef, 0x93, 0x57, 0x11,
+  0x3e, 0x1a, 0x69, 0x9d, 0x0f, 0x85, 0x2c, 0xe5, 0x8b, 0xe1, 0x46, 0xb0, 0x97, 0x37, 0x05, 0x2e,
+  0x33, 0xe5, 0x0a, 0x83, 0x72, 0xdd, 0x08, 0x0c, 0x61, 0x28, 0x04, 0x73, 0xaa, 0x58, 0xf0, 0xb2,
+  0x0e, 0x38, 0xf8, 0xae, 0x77, 0x88, 0xb0, 0xda, 0x30, 0x65, 0xaf, 0x4b, 0xdc, 0x80, 0xd5, 0xd9,
+  0x18, 0x1e, 0x4a, 0xc4, 0x18, 0x59, 0x0d, 0xce, 0x7c, 0x62, 0x66, 0x9b, 0xf2, 0xb9, 0xf3, 0xd7,
+  0x57, 0x55, 0xa7, 0x99, 0x34, 0xef, 0x48, 0x4b, 0xc1, 0x69, 0xab, 0x34, 0xa9, 0x03, 0xa7, 0xd0,
+  0x46, 0xec, 0xe2, 0xad, 0xd6, 0x1f, 0xe7, 0x81, 0x35, 0x3c, 0xd0, 0x07, 0x05, 0x69, 0xb3, 0x61,
+  0x06, 0xd9, 0x21, 0x76, 0x82, 0x21, 0xf4, 0x5d, 0xca, 0x35, 0xff, 0x87, 0x01, 0x44, 0xb8, 0xce,
+  0x5a, 0x94, 0x43, 0xe2, 0x0b, 0xe2, 0xbf, 0x5b, 0x1e, 0x5f, 0x58, 0x3e, 0x6e, 0x97, 0x9b, 0x86,
+  0x6f, 0x26, 0xa1, 0x33, 0x12, 0xc2, 0x99, 0x74, 0xbe, 0x68, 0x83, 0xcd, 0x51, 0xbf, 0x94, 0x0a,
+  0xe0, 0x26, 0x49, 0xb1, 0x37, 0x2e, 0xfa, 0xf0, 0x17, 0xec, 0xaa, 0xe0, 0xd6, 0x30, 0xfb, 0xc8,
+  0xb1, 0xaa, 0x21, 0x3d, 0x8a, 0x35, 0x0c, 0x9b, 0x67, 0x9b, 0xe3, 0xa0, 0xe0, 0x50, 0xa8, 0x15,
+  0xaf, 0xa1, 0x1c, 0x9e, 0x13, 0x5b, 0x07, 0x0b, 0x14, 0x17, 0x6a, 0x3e, 0x1f, 0x92, 0x37, 0x7d,
+  0xcd, 0x3b, 0x3e, 0x14, 0xa4, 0x4d, 0x2d, 0xba, 0xce, 0x6d, 0x34, 0xf2, 0x5d, 0x61, 0xca, 0x8f,
+  0xda, 0xbb, 0x62, 0xbf, 0x6a, 0x14, 0x94, 0x3a, 0x37, 0x5c, 0x42, 0x90, 0x2f, 0x0b, 0x19, 0x45,
+  0x61, 0xa6, 0x17, 0x68, 0x1c, 0x16, 0x77, 0xe5, 0x14, 0x3f, 0xab, 0xfa, 0x81, 0x8c, 0x7c, 0x69,
+  0x7b, 0xed, 0xaf, 0x82, 0x8d, 0x46, 0x4e, 0x69, 0xa3, 0x64, 0x5d, 0x4e, 0x83, 0x98, 0x0b, 0x49,
+  0x5e, 0x2f, 0x6a, 0x20, 0x0a, 0xb7, 0x5f, 0x14, 0xad, 0xe3, 0xb0, 0xf9, 0x8d, 0x6a, 0x6f, 0x7b,
+  0xc0, 0x7d, 0xd5, 0x45, 0xa0, 0x90, 0x0a, 0xae, 0x8f, 0xb6, 0xa5, 0x08, 0xd6, 0xcc, 0xc6, 0x58,
+  0x37, 0xb8, 0x0e, 0x29, 0x36, 0x78, 0xc4, 0x37, 0x6f, 0xcc, 0x13, 0xdf, 0x2a, 0xf2, 0x5c, 0x30,
+  0xa9, 0xc8, 0x87, 0x5b, 0x08, 0x5c, 0x25, 0xb2, 0xae, 0x19, 0x01, 0xeb, 0x00, 0xfc, 0x3a, 0x92,
+  0xc0, 0xee, 0x29, 0x4e, 0x96, 0xfb, 0x0e, 0xea, 0x69, 0x43, 0x28, 0xde, 0xe6, 0x7b, 0x74, 0x41,
+  0xe8, 0x69, 0xba, 0xa2, 0x69, 0xb1, 0x47, 0x00, 0x08, 0x91, 0xfa, 0x02, 0x73, 0x19, 0xc5, 0x45,
+  0x92, 0x0c, 0x98, 0x45, 0xb4, 0xdd, 0x6c, 0x8b, 0x2b, 0xcc, 0x35, 0x49, 0xd3, 0x14, 0x3b, 0xcc,
+  0x37, 0xac, 0x6a, 0x6e, 0x33, 0x71, 0x13, 0x2e, 0x49, 0x37, 0x49, 0x3c, 0x86, 0xa3, 0xd1, 0x2a,
+  0xbe, 0x86, 0x63, 0x2b, 0x00, 0x74, 0x70, 0xc2, 0xba, 0x1f, 0xc8, 0xfa, 0x13, 0x97, 0x49, 0x1a,
+  0x2f, 0xf1, 0x80, 0xb7, 0x25, 0x30, 0xc6, 0x8a, 0x1b, 0x2e, 0x67, 0x74, 0xb3, 0x71, 0x78, 0x4c,
+  0x29, 0x28, 0xc8, 0xff, 0xc3, 0xd7, 0x49, 0x6e, 0x73, 0x29, 0xa8, 0xc3, 0x3f, 0x54, 0x3a, 0x10,
+  0x5c, 0xc3, 0xf0, 0xed, 0x69, 0x08, 0xea, 0x06, 0xf8, 0x18, 0x72, 0xdf, 0x31, 0x83, 0x60, 0x05,
+  0xa8, 0x24, 0x96, 0xb2, 0xad, 0x0a, 0x06, 0x95, 0x63, 0xcd, 0xad, 0xca, 0x94, 0x94, 0x6f, 0x52,
+  0xb2, 0xef, 0xe9, 0x95, 0xd5, 0x1d, 0x53, 0x4a, 0x36, 0x02, 0x13, 0x38, 0x67, 0xc2, 0x1a, 0x00,
+  0xc2, 0x76, 0x40, 0xc4, 0xd9, 0xf8, 0x35, 0xa8, 0xde, 0xb3, 0x6b, 0x95, 0x56, 0xba, 0x74, 0x8d,
+  0x7d, 0x68, 0x7d, 0x49, 0x96, 0xf6, 0x04, 0xd3, 0x90, 0x05, 0x93, 0xab, 0x3b, 0x7d, 0x79, 0xdd,
+  0x3e, 0x97, 0xd4, 0xb1, 0x1c, 0x35, 0x8f, 0x73, 0x6b, 0x70, 0x68, 0xd2, 0x9d, 0x6b, 0xdb, 0x0f,
+  0x43, 0x0a, 0x60, 0x4f, 0xf0, 0x3a, 0xfa, 0x80, 0xa9, 0x7c, 0xb3, 0x83, 0x2d, 0x72, 0xc3, 0xe3,
+  0x29, 0x8a, 0x1c, 0xe5, 0xf7, 0xfe, 0x84, 0x40, 0x92, 0xe6, 0x3c, 0xc9, 0x6c, 0xc7, 0x93, 0x2e,
+  0xe6, 0xe0, 0x0e, 0x56, 0xb0, 0x21, 0x80, 0x3d, 0xf0, 0xee, 0xf3, 0x32, 0xa3, 0xac, 0x5c, 0x78,
+  0x26, 0x6b, 0xb0, 0x62, 0x76, 0xda, 0x8f, 0x0e, 0xd6, 0xde, 0x85, 0x5b, 0x7e, 0x46, 0xff, 0x82,
+  0xa0, 0xcf, 0x27, 0x31, 0x0c, 0x31, 0x31, 0xfc, 0xc4, 0xec, 0xa3, 0x6d, 0x60, 0x86, 0xb9, 0xe6,
+  0x6d, 0xcf, 0xe5, 0xfb, 0xc4, 0xf4, 0x95, 0x35, 0xdd, 0x49, 0x3e, 0x66, 0xb3, 0x30, 0x3f, 0x02,
+  0xb3, 0xd4, 0x81, 0xb5, 0xb6, 0xb9, 0x3d, 0x94, 0x3d, 0x81, 0xb7, 0xc3, 0xdd, 0x0d, 0x3c, 0x3b,
+  0xc3, 0x77, 0xc8, 0xfe, 0x76, 0xab, 0x8d, 0x43, 0x58, 0xa0, 0x16, 0xca, 0xb3, 0xce, 0x67, 0x2c,
+  0x7b, 0x31, 0x64, 0x1f, 0x99, 0x7f, 0xd3, 0x51, 0x01, 0x76, 0x0c, 0xf3, 0xa2, 0x73, 0xb9, 0x96,
+  0x35, 0x1b, 0x5d, 0xf4, 0x19, 0xef, 0xbe, 0x47, 0x8e, 0x4a, 0xdb, 0x37, 0x1a, 0xc9, 0x7d, 0xbe,
+  0x2f, 0x28, 0xb0, 0x25, 0xc0, 0x49, 0x3b, 0x65, 0x51, 0xd4, 0x57, 0x0b, 0x65, 0x44, 0x2a, 0xec,
+  0x87, 0x8d, 0x7b, 0xeb, 0xeb, 0x01, 0x94, 0xe8, 0x36, 0x99, 0x96, 0xa1, 0xe1, 0x1c, 0xeb, 0x21,
+  0x56, 0xbb, 0x83, 0x3c, 0x31, 0xd5, 0x47, 0xcc, 0x1f, 0x5d, 0xf0, 0x65, 0x83, 0x09, 0x37, 0x67,
+  0x5b, 0x85, 0x9b, 0x6c, 0xa4, 0xe0, 0x93, 0x3c, 0x68, 0x74, 0x49, 0xef, 0xec, 0xf0, 0x63, 0x40,
+  0x13, 0x2c, 0xd8, 0x33, 0x8c, 0x97, 0xcd, 0x7c, 0xd0, 0x0d, 0x65, 0x51, 0xf4, 0x8a, 0xf6, 0x70,
+  0x93, 0x79, 0x7c, 0xf4, 0x87, 0xe5, 0xd5, 0x15, 0x59, 0xab, 0x63, 0x47, 0xfc, 0x80, 0x60, 0x4f,
+  0xf7, 0x21, 0xba, 0x8d, 0x79, 0x8c, 0x41, 0x71, 0x5d, 0x8e, 0x5c, 0x6e, 0xcf, 0x77, 0x70, 0xfa,
+  0xfd, 0x7a, 0xee, 0xeb, 0xf4, 0x24, 0x18, 0x1d, 0xfc, 0xbd, 0x3f, 0xf8, 0xdb, 0x28, 0xfa, 0x99,
+  0x6f, 0x27, 0x62, 0x85, 0x85, 0x70, 0xca, 0x5f, 0x0f, 0xdc, 0x1b, 0x73, 0xda, 0x8e, 0xbd, 0x03,
+  0x56, 0xc6, 0xad, 0x08, 0x0e, 0xe6, 0x91, 0x1d, 0xe2, 0xe1, 0x15, 0xe2, 0xf6, 0x8e, 0x73, 0xbd,
+  0xb0, 0x4f, 0xcd, 0x20, 0xb8, 0x3e, 0x61, 0x3d, 0x66, 0xd0, 0x38, 0x8a, 0x7e, 0xda, 0xdf, 0xd8,
+  0x3d, 0x7a, 0x3d, 0x65, 0x63, 0xae, 0xef, 0x34, 0x39, 0xc4, 0xab, 0xed, 0x84, 0xcb, 0x45, 0x2c,
+  0xcc, 0xa6, 0x26, 0xb4, 0x50, 0x6d, 0x32, 0xdd, 0xc9, 0xe1, 0xf6, 0x26, 0x47, 0x61, 0x0a, 0x1a,
+  0xb6, 0x8c, 0xc7, 0xbd, 0xd5, 0xc5, 0x75, 0x93, 0xdd, 0xff, 0x1f, 0xc8, 0xb8, 0x0e, 0xef, 0x3e,
+  0x1a, 0x8e, 0x1a, 0xe1, 0x41, 0xca, 0x19, 0xf0, 0x04, 0x2b, 0x59, 0x4d, 0xef, 0x91, 0xde, 0x3d,
+  0xdb, 0xc7, 0x93, 0xef, 0x2a, 0x3e, 0x2d, 0x74, 0xe8, 0xea, 0xea, 0xa1, 0xca, 0xfb, 0x98, 0xfd,
+  0x0b, 0xc2, 0x27, 0x70, 0x43, 0x31, 0x0f, 0x00, 0x00,
+};
+
+// status.js: 15008 bytes, 5128 gzipped
+static const uint8_t WEB_ASSET_STATUS_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5b, 0x7b, 0x73, 0xdb, 0xb6,
+  0xb2, 0xff, 0xdf, 0x9f, 0x02, 0x49, 0xa6, 0x21, 0xd5, 0x48, 0x94, 0xfc, 0x88, 0xeb, 0x4a, 0x71,
+  0xce, 0x38, 0x7e, 0x24, 0x3e, 0xd7, 0xaf, 0xf1, 0xa3, 0xbd, 0x33, 0x1e, 0x8f, 0x86, 0x12, 0x21,
+  0x8b, 0xc7, 0x14, 0xa9, 0x43, 0x50, 0x92, 0xdd, 0xd6, 0xdf, 0xfd, 0xfe, 0x76, 0x01, 0x92, 0xa0,
+  0x24, 0x5b, 0xee, 0x3d, 0xf7, 0x76, 0x52, 0x5b, 0x02, 0xf6, 0x85, 0xc5, 0xee, 0x62, 0x77, 0x01,
+  0x47, 0x32, 0x13, 0x33, 0xd5, 0x59, 0x8b, 0xf0, 0x3b, 0x90, 0x99, 0x1f, 0x46, 0xea, 0x37, 0x99,
+  0xaa, 0x30, 0x89, 0x3b, 0xa2, 0xd9, 0xcc, 0x87, 0xba, 0x53, 0x3d, 0x26, 0x92, 0x81, 0xc8, 0x86,
+  0x52, 0xfc, 0x38, 0xbd, 0x6a, 0xee, 0x9d, 0x5e, 0x89, 0x28, 0x54, 0x99, 0x12, 0x18, 0xa7, 0xc1,
+  0xb1, 0x7f, 0x2f, 0xd7, 0xd6, 0x80, 0xd4, 0x68, 0x34, 0xc4, 0xb7, 0x30, 0xf6, 0xd3, 0x27, 0xa1,
+  0x32, 0x3f, 0x9b, 0x28, 0x31, 0x48, 0xfd, 0x91, 0x54, 0x34, 0x41, 0xf3, 0xa7, 0x13, 0x95, 0x89,
+  0x91, 0x9f, 0xf5, 0x87, 0xe2, 0x8a, 0xe7, 0x8f, 0x68, 0x5a, 0xf8, 0x71, 0xc0, 0x74, 0xfa, 0x49,
+  0x20, 0x85, 0x8c, 0x27, 0x23, 0x25, 0xc2, 0x58, 0x7c, 0xf3, 0x47, 0xbd, 0xc9, 0x89, 0x0c, 0x9a,
+  0x9a, 0x54, 0xb7, 0xef, 0xf7, 0x87, 0xd2, 0x1b, 0x7a, 0x6b, 0xfd, 0x24, 0x06, 0x99, 0xa3, 0xcb,
+  0xbd, 0xd3, 0xc3, 0xee, 0xe9, 0xde, 0xf7, 0xe3, 0x7d, 0xb1, 0x2b, 0x5a, 0x8f, 0xdf, 0xd6, 0x3b,
+  0x95, 0x99, 0xdf, 0x0e, 0x2f, 0xaf, 0x8e, 0xcf, 0xcf, 0x30, 0xb7, 0x91, 0x4f, 0x7c, 0xdf, 0x3f,
+  0x3f, 0x38, 0xec, 0x5e, 0x5d, 0xef, 0x5d, 0x1f, 0x5e, 0x61, 0xfc, 0xd6, 0xb9, 0x39, 0xfb, 0xaf,
+  0xb3, 0xf3, 0xdf, 0xcf, 0x9c, 0xba, 0x70, 0x8e, 0x0f, 0x4e, 0x0e, 0xe9, 0xf7, 0xc5, 0xe5, 0xe1,
+  0xc5, 0xde, 0x25, 0x7f, 0xbc, 0xbc, 0x39, 0x3b, 0x3b, 0x3e, 0xfb, 0xce, 0xa3, 0x7b, 0x37, 0x57,
+  0x87, 0xc5, 0x87, 0x03, 0xa7, 0xbe, 0x26, 0x84, 0x73, 0x74, 0x7c, 0x76, 0x7c, 0xf5, 0x83, 0x46,
+  0x8f, 0xf6, 0x8e, 0x4f, 0x68, 0x54, 0x38, 0x57, 0xd7, 0xe7, 0x17, 0xfc, 0xfb, 0xe4, 0x78, 0xdf,
+  0xe0, 0x02, 0xea, 0x9a, 0x7e, 0x9f, 0x1f, 0x1d, 0x9d, 0x1c, 0x9f, 0x1d, 0x3a, 0x77, 0xb9, 0x38,
+  0x27, 0xc7, 0xdf, 0x7f, 0x5c, 0x77, 0x4f, 0x21, 0xd3, 0x82, 0x34, 0x49, 0xcc, 0x3f, 0x07, 0x03,
+  0xfa, 0x35, 0x88, 0x7c, 0x35, 0x0c, 0xe3, 0xfb, 0x79, 0xcc, 0xc3, 0xff, 0xbe, 0xbe, 0xdc, 0xd3,
+  0xa8, 0x04, 0x26, 0xdc, 0xa3, 0x30, 0x0e, 0xd5, 0x10, 0x7b, 0x73, 0x3f, 0xcc, 0x04, 0x96, 0xde,
+  0x10, 0x59, 0x38, 0x02, 0xa2, 0x48, 0x26, 0x99, 0xe7, 0x79, 0xb5, 0x65, 0x50, 0x47, 0x47, 0x1a,
+  0x4c, 0x02, 0x06, 0x1b, 0x30, 0x1a, 0xc3, 0x1e, 0x64, 0xcd, 0x62, 0x75, 0x78, 0xc0, 0x1a, 0xc3,
+  0xb2, 0x99, 0x15, 0x16, 0x7e, 0xeb, 0x1c, 0x84, 0xca, 0xef, 0x45, 0x32, 0x20, 0x82, 0x41, 0xa8,
+  0x00, 0x19, 0xcb, 0x7e, 0x86, 0xef, 0x77, 0x75, 0x9e, 0x3f, 0x4c, 0xd3, 0x24, 0x15, 0xee, 0xb7,
+  0x28, 0x8c, 0x1f, 0x88, 0xff, 0xa5, 0x0c, 0x98, 0xb9, 0xa4, 0xf1, 0x1c, 0xe8, 0xc2, 0x9f, 0x28,
+  0x19, 0x08, 0xf7, 0x62, 0x12, 0x29, 0x02, 0x3a, 0x4f, 0xfd, 0xf8, 0x5e, 0x32, 0xdc, 0xcc, 0x4f,
+  0x63, 0x5e, 0xb0, 0x81, 0x4c, 0xc3, 0x18, 0xdb, 0xca, 0x72, 0x13, 0xc6, 0xf7, 0x54, 0xca, 0x98,
+  0x01, 0x17, 0x38, 0x2f, 0x07, 0x15, 0xee, 0xf5, 0x82, 0x22, 0x16, 0x50, 0x8f, 0x83, 0x48, 0x16,
+  0xda, 0xb9, 0xd6, 0x1a, 0x61, 0x48, 0xd6, 0x54, 0x03, 0x5b, 0x62, 0xf3, 0x20, 0x6a, 0x17, 0x69,
+  0x72, 0x9f, 0x4a, 0xa5, 0x96, 0x88, 0x4c, 0xc4, 0x9a, 0xe7, 0x7a, 0xff, 0xe6, 0xf1, 0xe1, 0x43,
+  0xe2, 0xc8, 0xcf, 0xfc, 0x48, 0x18, 0x3d, 0x5d, 0x65, 0x69, 0xd2, 0x7b, 0x51, 0x4f, 0x04, 0xfe,
+  0x26, 0x85, 0x12, 0xe0, 0xef, 0x5a, 0x0c, 0xe1, 0x1e, 0x24, 0x13, 0xec, 0x90, 0x38, 0x22, 0xdb,
+  0x59, 0xaa, 0xda, 0x35, 0x6c, 0xf1, 0xda, 0x60, 0x12, 0xf7, 0x33, 0x72, 0xef, 0x40, 0x92, 0xf3,
+  0x59, 0x4e, 0xe9, 0xf6, 0x26, 0x83, 0x9a, 0xf8, 0x13, 0x84, 0xb5, 0x1d, 0x4c, 0xb1, 0xf9, 0xb1,
+  0x9c, 0x89, 0x03, 0x08, 0xfe, 0x5b, 0x28, 0x67, 0x3c, 0xdf, 0xc1, 0x74, 0x38, 0x10, 0xee, 0xd4,
+  0xeb, 0x3d, 0x65, 0xf2, 0x44, 0xc6, 0xf7, 0xd9, 0x50, 0x7c, 0x11, 0x5b, 0x2d, 0xf1, 0xd7, 0x5f,
+  0x62, 0xea, 0xdd, 0xcb, 0xec, 0x06, 0xaa, 0xda, 0x71, 0x5b, 0x35, 0xf1, 0x6e, 0x77, 0xb7, 0xe2,
+  0xb2, 0x55, 0x80, 0x75, 0x1b, 0xc0, 0x78, 0x6e, 0x4d, 0xa4, 0x32, 0x9b, 0xa4, 0xb1, 0x88, 0x27,
+  0x51, 0xd4, 0x29, 0x04, 0x81, 0x37, 0xdc, 0x2b, 0x08, 0x53, 0x60, 0xaf, 0x6f, 0xbb, 0x1b, 0x75,
+  0x91, 0xa5, 0x13, 0x59, 0x2b, 0xa1, 0xc6, 0x32, 0xed, 0x4b, 0x58, 0xc2, 0xae, 0xcd, 0xe5, 0x57,
+  0x0b, 0x20, 0xe8, 0x8d, 0xf2, 0xc9, 0x63, 0x9a, 0xdb, 0xd8, 0xb6, 0x26, 0x61, 0xda, 0x5a, 0x15,
+  0x00, 0xb1, 0x1d, 0xe0, 0xd6, 0x22, 0xb6, 0xd9, 0xaa, 0xdd, 0xd1, 0x2a, 0xe0, 0xb7, 0xf1, 0x43,
+  0x9c, 0xcc, 0xe2, 0x45, 0x67, 0x20, 0x82, 0x66, 0x0d, 0xa4, 0x48, 0x21, 0x4c, 0x30, 0x6d, 0x97,
+  0x42, 0x6d, 0x6e, 0xb8, 0x5b, 0x46, 0xf8, 0x3a, 0x83, 0x8c, 0xfe, 0x9d, 0x65, 0xdd, 0x82, 0x46,
+  0x5b, 0xbc, 0x7b, 0xe7, 0xea, 0x15, 0x7f, 0x14, 0xeb, 0x06, 0x84, 0xed, 0xa9, 0x1b, 0xaa, 0x2e,
+  0x51, 0xb2, 0xe6, 0x37, 0x72, 0x12, 0x7e, 0x3c, 0xf1, 0x23, 0x22, 0x02, 0xbb, 0x8a, 0x2a, 0x20,
+  0x5b, 0x06, 0x04, 0xc8, 0x63, 0x63, 0xc5, 0x95, 0xf9, 0x9d, 0x7c, 0x3e, 0x86, 0xa8, 0x59, 0x17,
+  0x1e, 0x30, 0x9e, 0x64, 0x55, 0x21, 0xb6, 0x0d, 0x08, 0x45, 0x65, 0xd9, 0xc5, 0xcf, 0x48, 0x56,
+  0x00, 0x36, 0x73, 0x31, 0xee, 0xc9, 0xa2, 0xba, 0x0c, 0xd6, 0xae, 0x84, 0x5e, 0x5b, 0x8b, 0x3b,
+  0x5a, 0x89, 0x65, 0xec, 0x63, 0x54, 0x96, 0xad, 0x6b, 0xf6, 0x10, 0x87, 0x4b, 0x3b, 0xdf, 0xcf,
+  0x82, 0x35, 0x8d, 0xe5, 0x9b, 0x07, 0x03, 0x58, 0x6f, 0x55, 0x94, 0x18, 0xf9, 0x4f, 0x32, 0xed,
+  0xe2, 0x20, 0x69, 0x57, 0xcc, 0x64, 0x7d, 0xa3, 0x02, 0x45, 0x51, 0xaf, 0x9b, 0xca, 0x91, 0x1f,
+  0xc6, 0xac, 0x87, 0x9c, 0x1e, 0xf6, 0x64, 0xbd, 0xba, 0x29, 0x71, 0xf2, 0xc7, 0x1f, 0x91, 0xec,
+  0x66, 0x72, 0x34, 0xae, 0xb2, 0xdd, 0x31, 0x60, 0xa2, 0x29, 0x20, 0x42, 0x05, 0xd6, 0x4f, 0x01,
+  0xb6, 0x88, 0xb2, 0xd1, 0x5a, 0x44, 0xe9, 0xc9, 0x60, 0x09, 0xe0, 0xc6, 0x0b, 0x80, 0x2f, 0x11,
+  0xde, 0x5a, 0x84, 0x9f, 0x85, 0x83, 0xb0, 0xab, 0xc2, 0xfb, 0xd8, 0x87, 0x19, 0x90, 0xc5, 0xff,
+  0x83, 0x7f, 0x7e, 0x82, 0xa1, 0x7e, 0x1b, 0x39, 0xa2, 0x2d, 0x9c, 0xb3, 0xe6, 0x9e, 0xd1, 0x79,
+  0x8f, 0x8e, 0xdb, 0xae, 0xb6, 0xad, 0x11, 0x76, 0xae, 0x6d, 0x9f, 0x4f, 0xf6, 0x96, 0x6d, 0xfc,
+  0x52, 0xbb, 0xd3, 0x28, 0xfd, 0x21, 0x70, 0xa0, 0xe8, 0x5e, 0x4a, 0x58, 0x6d, 0xdb, 0xd5, 0x36,
+  0x76, 0x2a, 0xc6, 0x4a, 0x04, 0xbb, 0xf2, 0x31, 0x4b, 0xfd, 0x76, 0xe5, 0xf0, 0xaa, 0xd0, 0xfd,
+  0xd5, 0xd8, 0x82, 0x11, 0x08, 0x4e, 0xd8, 0x35, 0x47, 0xbf, 0xca, 0xd2, 0x0a, 0x75, 0xf8, 0x9e,
+  0xd8, 0x45, 0xbc, 0xd8, 0xc6, 0x82, 0x16, 0xc3, 0xb1, 0x70, 0x1d, 0x2c, 0x31, 0x8f, 0x00, 0x58,
+  0xec, 0x4f, 0x35, 0x5a, 0x6b, 0xe1, 0xd4, 0xb7, 0xad, 0xbb, 0x05, 0x0e, 0x7d, 0xc4, 0x49, 0x65,
+  0xc3, 0xac, 0x5b, 0x30, 0x7a, 0x7d, 0xdd, 0x29, 0x69, 0xd1, 0x96, 0xa2, 0x70, 0x48, 0xc0, 0xf4,
+  0x93, 0x28, 0x49, 0x35, 0x88, 0x6b, 0xc3, 0x6c, 0xd4, 0xc4, 0x97, 0x2f, 0xe4, 0x35, 0xe2, 0xaf,
+  0xea, 0xc4, 0x26, 0x4f, 0xec, 0xd0, 0xb8, 0x3d, 0xbc, 0x55, 0xd1, 0xdb, 0x38, 0x8c, 0xab, 0x2c,
+  0x3f, 0x5b, 0x2c, 0x17, 0x26, 0x73, 0xd7, 0x84, 0xe1, 0x77, 0x01, 0xa0, 0xaa, 0xb3, 0xbf, 0x98,
+  0xd9, 0xb9, 0xcc, 0xae, 0xea, 0x22, 0x9b, 0xb9, 0x45, 0x03, 0xf4, 0xb9, 0xb3, 0xf6, 0x6c, 0x1d,
+  0x11, 0x83, 0x24, 0x45, 0xea, 0x46, 0x07, 0xa3, 0xab, 0xf4, 0xc9, 0x40, 0xa1, 0x5f, 0x89, 0x2f,
+  0xc8, 0xbe, 0x8a, 0x58, 0xed, 0x34, 0x1a, 0x6d, 0xfe, 0xe7, 0x50, 0xf0, 0xa3, 0xdc, 0x72, 0x88,
+  0x18, 0x7a, 0xea, 0x67, 0x43, 0x6f, 0x10, 0x25, 0x49, 0x0a, 0xf8, 0xa6, 0xd8, 0xdc, 0x6e, 0xb5,
+  0x6a, 0x1d, 0xa1, 0xc4, 0x4f, 0xbb, 0xfc, 0x39, 0x07, 0x1d, 0x2d, 0x82, 0x6e, 0x17, 0x80, 0xdb,
+  0x25, 0x18, 0xd9, 0x03, 0x40, 0x47, 0x38, 0x6a, 0xd6, 0x5b, 0x64, 0x02, 0x2d, 0xda, 0xf0, 0x11,
+  0xf6, 0x78, 0x94, 0xc3, 0x28, 0x03, 0xa3, 0xaa, 0x30, 0x0a, 0x30, 0xca, 0x0a, 0xcb, 0x43, 0xf1,
+  0x55, 0xd0, 0xec, 0x90, 0xcc, 0xa4, 0xcd, 0x54, 0x18, 0x31, 0xff, 0xa6, 0xc9, 0xb4, 0x97, 0x8d,
+  0x56, 0x95, 0xd3, 0x9b, 0x84, 0x51, 0xf0, 0x5b, 0x98, 0x66, 0x88, 0xbc, 0xc8, 0x59, 0x95, 0xdb,
+  0x4f, 0x26, 0x71, 0xa6, 0xd5, 0x44, 0xf2, 0xf4, 0x7c, 0x92, 0x26, 0x48, 0xfa, 0x93, 0x11, 0x8c,
+  0x92, 0x14, 0x7e, 0x18, 0x49, 0xfa, 0xf8, 0xed, 0xe9, 0x38, 0x70, 0x9d, 0xa9, 0xc6, 0x6c, 0x00,
+  0xcc, 0x29, 0x4e, 0x55, 0x7c, 0xf1, 0x02, 0x1c, 0xb7, 0x4a, 0x66, 0x1e, 0x93, 0x63, 0x9b, 0x47,
+  0xb2, 0x00, 0x63, 0x37, 0xf4, 0x73, 0xbd, 0x13, 0xca, 0x12, 0x70, 0xc1, 0xbf, 0x73, 0x7a, 0x25,
+  0x8d, 0x56, 0xcd, 0x1c, 0x48, 0x84, 0x13, 0xe2, 0xac, 0x49, 0x7f, 0x5c, 0x9f, 0x9e, 0x00, 0xfe,
+  0xfd, 0x97, 0x20, 0x9c, 0x22, 0xbe, 0x3e, 0x45, 0x72, 0x17, 0x79, 0xa7, 0x7c, 0x6c, 0xdc, 0xa7,
+  0xc9, 0xac, 0x2d, 0xd6, 0x3b, 0x62, 0x28, 0xb5, 0x93, 0xaf, 0xb7, 0x5a, 0x3f, 0x75, 0x44, 0x06,
+  0x67, 0x6e, 0xf8, 0x30, 0x52, 0xd8, 0x0f, 0xb9, 0x99, 0x4c, 0x3b, 0x82, 0x5d, 0xa0, 0x2d, 0x3e,
+  0xec, 0xec, 0xec, 0x74, 0x50, 0x13, 0x04, 0x01, 0xe4, 0x6c, 0x64, 0x09, 0xc2, 0xd4, 0xe7, 0xf1,
+  0x63, 0x07, 0xf6, 0x13, 0x67, 0x0d, 0x15, 0xfe, 0x81, 0xc8, 0xd2, 0xf2, 0x7e, 0x95, 0xa3, 0x8e,
+  0xf3, 0x15, 0x67, 0xab, 0x12, 0x81, 0x49, 0x26, 0xbf, 0x34, 0xc1, 0xfb, 0xeb, 0xfb, 0x0e, 0x0b,
+  0x56, 0x2e, 0xeb, 0x79, 0xed, 0x25, 0x31, 0xd9, 0x67, 0x77, 0x9d, 0x29, 0x25, 0xa2, 0x6f, 0x90,
+  0xd9, 0xf9, 0x6a, 0x38, 0x78, 0xa9, 0x1c, 0x4b, 0x3f, 0x33, 0x2a, 0xac, 0xee, 0xe3, 0x64, 0x0c,
+  0x15, 0xca, 0x03, 0x39, 0x0d, 0xfb, 0xf2, 0x38, 0x1e, 0x24, 0x2e, 0x69, 0xb4, 0xb4, 0x76, 0xfa,
+  0xe6, 0xe9, 0xa8, 0xaa, 0xc2, 0x80, 0x73, 0x96, 0x49, 0x1c, 0xc8, 0x41, 0x18, 0x23, 0x21, 0x33,
+  0x3a, 0x7d, 0x71, 0x93, 0x09, 0xaf, 0xa1, 0xe3, 0x8d, 0x53, 0xd3, 0xeb, 0xb9, 0x86, 0x1a, 0xb1,
+  0x1e, 0x67, 0xff, 0xfc, 0xec, 0xec, 0x70, 0xff, 0xfa, 0xf0, 0x40, 0xc7, 0xae, 0x39, 0x36, 0xb0,
+  0x3b, 0xb8, 0x42, 0x31, 0x11, 0x8e, 0x69, 0xa4, 0xe6, 0xe4, 0xda, 0x79, 0x91, 0xa1, 0x4e, 0x3c,
+  0x11, 0x26, 0xe6, 0xd8, 0x31, 0x95, 0x22, 0xc0, 0x74, 0x56, 0x93, 0x88, 0x92, 0xfb, 0xb0, 0xbf,
+  0x8c, 0x48, 0x25, 0x4f, 0x20, 0x2f, 0xdb, 0x83, 0x1a, 0xa7, 0x52, 0x9c, 0x9c, 0xff, 0xce, 0xc7,
+  0x8b, 0xf9, 0xfa, 0x03, 0x21, 0xdf, 0x79, 0x9d, 0x8f, 0x0c, 0x5e, 0x14, 0x54, 0x87, 0xba, 0x95,
+  0xe8, 0xbc, 0x9d, 0xcb, 0x08, 0xe4, 0xe1, 0x90, 0x9d, 0x64, 0xde, 0x4f, 0x2b, 0x10, 0xda, 0x18,
+  0x50, 0xa8, 0x9a, 0x22, 0xd6, 0x54, 0xaf, 0x7d, 0x3f, 0xc5, 0x97, 0x38, 0xa1, 0xea, 0x97, 0x2b,
+  0x5f, 0xe1, 0x26, 0x71, 0xf4, 0xc4, 0x35, 0x2b, 0x4c, 0xd8, 0xd4, 0xba, 0x08, 0x54, 0x0f, 0x52,
+  0x8e, 0x79, 0x14, 0x96, 0x99, 0xa1, 0x3a, 0x96, 0x1e, 0x11, 0x1b, 0x48, 0x14, 0xbc, 0xfa, 0x58,
+  0xf9, 0xa7, 0x4a, 0x62, 0xb7, 0x26, 0x7a, 0xe4, 0xc2, 0x28, 0x72, 0x33, 0xd8, 0x9b, 0xc8, 0x12,
+  0x12, 0x53, 0x8a, 0xd9, 0x50, 0x72, 0x39, 0x1d, 0xa6, 0x0b, 0xc5, 0xf7, 0x28, 0x99, 0x4a, 0xe5,
+  0xcd, 0x5b, 0xe9, 0x8f, 0x91, 0x5a, 0x66, 0x9e, 0x43, 0x94, 0xcf, 0xbb, 0x55, 0xc3, 0x2c, 0xbd,
+  0xc9, 0x24, 0xbf, 0xe1, 0xf4, 0xb5, 0x68, 0x04, 0x0a, 0x0d, 0x80, 0x38, 0x76, 0x46, 0x4c, 0xab,
+  0x5e, 0x81, 0x42, 0x30, 0x1a, 0x87, 0x3e, 0x91, 0x97, 0x45, 0x7e, 0x5f, 0xee, 0x0f, 0xa1, 0xf1,
+  0x54, 0x62, 0xd9, 0xbc, 0x83, 0x46, 0x42, 0x0f, 0xa7, 0xc9, 0x21, 0x0a, 0x7a, 0x57, 0x8a, 0xdd,
+  0xaf, 0xc6, 0x71, 0x34, 0xa7, 0x10, 0x99, 0x8d, 0xcd, 0xa9, 0x9f, 0xc2, 0x57, 0xa5, 0x61, 0x46,
+  0x06, 0xa9, 0x59, 0x08, 0x06, 0xf4, 0x28, 0x0e, 0xed, 0x23, 0xb0, 0xe8, 0x5c, 0x5f, 0x7a, 0x4a,
+  0x42, 0x67, 0x61, 0xf6, 0xe4, 0x65, 0xc9, 0xcd, 0x18, 0x29, 0xc0, 0x3e, 0xc2, 0x21, 0x14, 0x4e,
+  0x1e, 0x44, 0xfe, 0x23, 0x3d, 0xee, 0x31, 0x50, 0x20, 0xa7, 0xef, 0x4c, 0x47, 0x08, 0x57, 0x7a,
+  0x81, 0x54, 0xfd, 0x34, 0x1c, 0xb3, 0x76, 0x91, 0x83, 0x48, 0x0f, 0x19, 0xcb, 0x24, 0x62, 0x48,
+  0xc1, 0x45, 0x56, 0x5d, 0x28, 0x29, 0x79, 0x6f, 0xb9, 0x2f, 0x21, 0x4e, 0xfc, 0x1e, 0xd2, 0xab,
+  0x87, 0x42, 0x1a, 0x5e, 0xb2, 0x0f, 0x96, 0x71, 0xc0, 0x2b, 0x76, 0x49, 0x3c, 0x9e, 0x7b, 0x2e,
+  0x02, 0x7a, 0xbe, 0x78, 0xa4, 0x43, 0xa9, 0xac, 0xfd, 0x9f, 0xad, 0xda, 0xf9, 0x54, 0x84, 0x86,
+  0x9c, 0x38, 0xcb, 0x4d, 0x1f, 0x9c, 0x95, 0xd2, 0xd1, 0xa6, 0x84, 0x53, 0x8f, 0xe3, 0xa7, 0x87,
+  0x58, 0x8c, 0x4d, 0x7b, 0xca, 0x3d, 0x87, 0x36, 0x2a, 0xd2, 0x55, 0x1d, 0x7c, 0x9b, 0x3d, 0x3a,
+  0x86, 0x55, 0x3b, 0xa5, 0x5d, 0xcc, 0x92, 0x54, 0x65, 0x4b, 0xc1, 0xf3, 0x11, 0x64, 0x5b, 0xc5,
+  0xae, 0x10, 0x01, 0x1d, 0x07, 0xc0, 0x91, 0xc3, 0xf7, 0x19, 0xf5, 0x7f, 0xb0, 0x04, 0xd3, 0x2e,
+  0xa2, 0x85, 0xb8, 0x86, 0x26, 0x4c, 0xd8, 0x19, 0x50, 0x99, 0xec, 0xd0, 0x8e, 0x58, 0x83, 0x0a,
+  0xb4, 0x12, 0xc4, 0x50, 0x92, 0x49, 0x17, 0xc0, 0x44, 0x37, 0x2f, 0x6c, 0x57, 0xf9, 0x30, 0x75,
+  0xaf, 0x90, 0x87, 0x3e, 0x29, 0x21, 0x43, 0x6c, 0x67, 0xca, 0xdd, 0x27, 0x1f, 0x2a, 0x4b, 0xe5,
+  0x00, 0xd9, 0x23, 0x75, 0x0d, 0x68, 0x97, 0x15, 0x09, 0x36, 0xf3, 0x9f, 0x88, 0x92, 0xfb, 0xcf,
+  0xab, 0xf3, 0x33, 0xe1, 0x47, 0x33, 0xc2, 0x1a, 0xfa, 0x4a, 0xbc, 0xc7, 0xba, 0xde, 0xd7, 0x19,
+  0x33, 0x19, 0x85, 0x19, 0x06, 0x7c, 0x0c, 0xc0, 0x1e, 0xb2, 0x21, 0xb5, 0x51, 0x26, 0x31, 0xc6,
+  0x6a, 0x9e, 0xb8, 0x66, 0x36, 0x44, 0x1b, 0x01, 0x06, 0x89, 0x32, 0x48, 0xfb, 0xfd, 0x34, 0x41,
+  0x86, 0xca, 0x10, 0x75, 0x1c, 0x89, 0x93, 0x94, 0x12, 0x55, 0xfe, 0x0e, 0x7a, 0xd4, 0xf7, 0x22,
+  0x86, 0x24, 0x5f, 0x17, 0x35, 0xe5, 0x82, 0xcb, 0xef, 0xfd, 0x7f, 0xb9, 0xbc, 0xbf, 0xe8, 0xf2,
+  0x54, 0x3f, 0xa2, 0x34, 0x92, 0xe9, 0x2a, 0x3c, 0x5e, 0x4c, 0x81, 0xa9, 0x71, 0x96, 0x7b, 0xbf,
+  0x26, 0xcc, 0xf0, 0xb9, 0xcd, 0x80, 0x40, 0x6e, 0x2c, 0xf8, 0xe8, 0xe9, 0xb9, 0xb6, 0xb8, 0xe5,
+  0xe2, 0x99, 0xbf, 0x15, 0xa1, 0x82, 0xbe, 0xcd, 0x47, 0x0b, 0x9c, 0xf4, 0xaf, 0xb8, 0x4d, 0xb1,
+  0x22, 0x41, 0x80, 0x55, 0x8b, 0xcb, 0x25, 0x37, 0x1e, 0x62, 0xc2, 0x9c, 0xdf, 0x93, 0xd1, 0x2b,
+  0x04, 0xd5, 0xd8, 0x8f, 0x0b, 0x8f, 0x27, 0xd8, 0x45, 0x9a, 0x3c, 0xec, 0xd8, 0x20, 0x73, 0xde,
+  0x4a, 0x06, 0x48, 0x76, 0xae, 0x13, 0x39, 0x6f, 0x90, 0x26, 0xa3, 0xfd, 0xa1, 0x9f, 0xee, 0x23,
+  0x30, 0xb9, 0xdb, 0x9f, 0x31, 0x41, 0x52, 0x79, 0x21, 0xf6, 0xb0, 0x88, 0x4f, 0x3c, 0x32, 0x9c,
+  0x8c, 0xc2, 0x80, 0x9c, 0xa8, 0x92, 0x75, 0x90, 0x13, 0x08, 0xb7, 0x98, 0x73, 0x72, 0xfc, 0x62,
+  0x04, 0x91, 0xa0, 0xf9, 0x99, 0x0b, 0x20, 0xc7, 0xd6, 0x85, 0x1d, 0x0c, 0x58, 0x4c, 0x33, 0xc7,
+  0xc8, 0xec, 0x1f, 0x85, 0xde, 0x5d, 0xfa, 0x5a, 0x17, 0x61, 0xad, 0x54, 0x7e, 0xae, 0x2f, 0x15,
+  0x25, 0xd9, 0x1b, 0xd5, 0x25, 0x18, 0x78, 0x51, 0x5f, 0x44, 0xdc, 0xc9, 0x41, 0xc8, 0xa2, 0x69,
+  0xa0, 0x56, 0xf0, 0x31, 0x68, 0x3a, 0x3c, 0xf5, 0xfc, 0xfe, 0x03, 0x92, 0x3b, 0x2c, 0x7e, 0x9f,
+  0x72, 0x4d, 0x22, 0xf1, 0x81, 0x56, 0x4c, 0x28, 0x1e, 0xa7, 0x9f, 0x9d, 0x2a, 0x5a, 0x16, 0x66,
+  0x11, 0x71, 0x62, 0x80, 0xec, 0x69, 0x4c, 0x81, 0x91, 0x19, 0x78, 0xba, 0xee, 0x5f, 0xd4, 0x65,
+  0x5d, 0x14, 0x04, 0x0d, 0x08, 0x85, 0xd2, 0x9f, 0x90, 0xc4, 0x0f, 0xb2, 0x8a, 0x12, 0x4b, 0x1e,
+  0x95, 0xed, 0x2d, 0x38, 0xe5, 0x50, 0xcf, 0x42, 0x46, 0x4a, 0xce, 0xaf, 0x87, 0xd5, 0x70, 0xc2,
+  0x51, 0x39, 0x80, 0x1b, 0xa1, 0x98, 0xcf, 0x9e, 0x16, 0x29, 0x1b, 0xe9, 0x9d, 0x43, 0x9e, 0x2e,
+  0x28, 0x5a, 0xca, 0x2a, 0x1c, 0x27, 0x0f, 0x19, 0x26, 0x0e, 0xb0, 0x05, 0x89, 0x9f, 0xc5, 0x16,
+  0xc4, 0xc7, 0xc6, 0x2d, 0xe3, 0xe9, 0x73, 0x6e, 0x56, 0x32, 0x9d, 0xb7, 0x0a, 0xc2, 0x31, 0x93,
+  0xcf, 0xb5, 0xc2, 0x49, 0x8c, 0x7b, 0xdb, 0x80, 0x40, 0xb4, 0x0e, 0xba, 0x65, 0x87, 0x89, 0xf6,
+  0xe3, 0xe5, 0x27, 0x89, 0x0e, 0xd6, 0x47, 0x93, 0x28, 0x32, 0x79, 0x14, 0x2c, 0x2d, 0xee, 0x47,
+  0x13, 0xaa, 0x1e, 0xf2, 0x2b, 0x07, 0x8e, 0xb4, 0xe5, 0xb5, 0x43, 0xaf, 0x12, 0xd9, 0x23, 0xe9,
+  0x23, 0xc5, 0x44, 0xdc, 0xb5, 0x4a, 0xd5, 0x85, 0x8c, 0x8b, 0xd4, 0xcf, 0xa3, 0xae, 0x63, 0xee,
+  0x13, 0xbc, 0x7f, 0x61, 0x06, 0xe9, 0x22, 0x58, 0xc4, 0x6e, 0x4a, 0xa6, 0x9d, 0xf2, 0x90, 0x5b,
+  0x33, 0x63, 0x3a, 0xe2, 0xde, 0x1c, 0xd7, 0xbc, 0x3e, 0xdd, 0x58, 0xb8, 0xae, 0xb6, 0xff, 0xe7,
+  0xa5, 0x15, 0xc3, 0xcd, 0xf1, 0xb2, 0xb8, 0xcc, 0xa7, 0x13, 0xc6, 0xe8, 0x42, 0xe5, 0x1a, 0x4b,
+  0x09, 0xb8, 0xae, 0xa0, 0xaa, 0x2c, 0x0a, 0x70, 0x16, 0x65, 0x62, 0x80, 0x88, 0xc6, 0xa7, 0x8d,
+  0x59, 0xb9, 0xf4, 0xee, 0x3d, 0xf1, 0x1e, 0x05, 0x78, 0x0c, 0x9e, 0x32, 0x78, 0x5f, 0x84, 0xa6,
+  0x04, 0xfa, 0xa4, 0x13, 0xce, 0x75, 0x4c, 0x63, 0x72, 0x12, 0xfb, 0x53, 0xe4, 0x88, 0x54, 0x39,
+  0xb5, 0xcb, 0xd2, 0x40, 0x33, 0x5c, 0x56, 0x42, 0x65, 0x50, 0x98, 0xb6, 0xc1, 0xca, 0xa9, 0x31,
+  0x57, 0xc1, 0x54, 0x2f, 0x82, 0xf2, 0x18, 0x3d, 0x97, 0x8e, 0x9a, 0x40, 0xb1, 0xb4, 0x52, 0xea,
+  0xac, 0xbd, 0x5e, 0x03, 0x51, 0x7b, 0x73, 0x79, 0x0d, 0xc4, 0x9c, 0xaa, 0xdd, 0x4f, 0x32, 0x95,
+  0xa2, 0x32, 0x62, 0x9b, 0x39, 0x38, 0xbe, 0x2a, 0x07, 0x3a, 0x6f, 0x66, 0xa5, 0x8f, 0xb6, 0x97,
+  0x33, 0x8e, 0x17, 0x78, 0x97, 0xad, 0x5c, 0xe2, 0x5d, 0xe9, 0xed, 0x1a, 0x1d, 0xbf, 0x2e, 0x01,
+  0x77, 0x40, 0x59, 0x04, 0xb9, 0x6c, 0xb1, 0x56, 0x83, 0xb4, 0x10, 0xc2, 0xea, 0xaa, 0xea, 0xc8,
+  0xce, 0x95, 0x04, 0xf7, 0x97, 0xab, 0x31, 0xfc, 0x45, 0xa6, 0xdc, 0x3b, 0x6d, 0x98, 0xee, 0xd7,
+  0x32, 0xb6, 0xf3, 0xcd, 0x55, 0x1d, 0xe0, 0x56, 0x69, 0x93, 0x5b, 0xaa, 0x0d, 0xe4, 0x31, 0x4b,
+  0x4b, 0xb4, 0xbc, 0xdf, 0xba, 0x82, 0x08, 0x37, 0x6e, 0x97, 0x11, 0xe0, 0x89, 0x37, 0x2d, 0x8c,
+  0x9a, 0xb6, 0x73, 0x14, 0xac, 0xc6, 0x14, 0x13, 0xab, 0xf6, 0x75, 0x57, 0xe9, 0x4b, 0xf7, 0x6b,
+  0x1b, 0xd4, 0x4f, 0xcd, 0xe9, 0x9a, 0x2e, 0x83, 0x2e, 0x0d, 0xcb, 0xd6, 0x2f, 0x6a, 0x8a, 0xa3,
+  0xf0, 0x51, 0x06, 0x74, 0x5b, 0x31, 0x57, 0x92, 0x2f, 0x36, 0x7d, 0xe7, 0x81, 0x3f, 0x06, 0xf2,
+  0xbe, 0xb3, 0xbf, 0x4a, 0xcb, 0x3d, 0xd4, 0xb1, 0x2f, 0x49, 0x92, 0x77, 0x89, 0x5f, 0x11, 0x63,
+  0xae, 0x3f, 0xfc, 0xbf, 0x93, 0x41, 0xb7, 0x29, 0xb8, 0x69, 0xbc, 0x6c, 0xab, 0xac, 0x9e, 0xb2,
+  0x1d, 0x08, 0x8a, 0x62, 0xd4, 0x1e, 0xdc, 0xab, 0x0e, 0xae, 0xb0, 0x30, 0x6e, 0x35, 0xbc, 0x1c,
+  0x1b, 0xac, 0x6b, 0x0f, 0xb8, 0x86, 0xeb, 0x20, 0x25, 0x2f, 0x9b, 0x25, 0xd5, 0x56, 0xb4, 0x69,
+  0xfa, 0xd6, 0xc8, 0x61, 0xce, 0x8f, 0x8e, 0x56, 0xda, 0xb6, 0xc5, 0xf9, 0x4d, 0xa1, 0xa2, 0x2a,
+  0x4a, 0x79, 0xc1, 0xf7, 0x52, 0x98, 0x58, 0xc1, 0x99, 0xba, 0xe3, 0x4b, 0xa3, 0x61, 0xe5, 0x22,
+  0x87, 0x38, 0x9d, 0xee, 0x9d, 0xdd, 0xec, 0x9d, 0x10, 0x1f, 0xd7, 0xd9, 0xbb, 0xb9, 0x3e, 0x2f,
+  0xd6, 0x3f, 0xdf, 0x66, 0x5f, 0xc5, 0x98, 0xbb, 0xfd, 0x8d, 0xd7, 0xd9, 0xcf, 0xdf, 0x08, 0xbc,
+  0x69, 0x13, 0x61, 0xc0, 0xaf, 0x6c, 0x61, 0xa5, 0xa5, 0xdf, 0x79, 0x2b, 0xa9, 0x15, 0x7b, 0x32,
+  0x4f, 0x9a, 0xe1, 0xcc, 0x41, 0x44, 0xbd, 0xd7, 0xbe, 0xc9, 0x15, 0x0b, 0xb8, 0xa2, 0x57, 0x0f,
+  0x07, 0x31, 0xed, 0xd4, 0xf5, 0xed, 0x9a, 0x37, 0xf6, 0xa9, 0xf9, 0x9f, 0x66, 0xee, 0x76, 0x9d,
+  0xda, 0xc5, 0x79, 0x9a, 0x4f, 0xdd, 0x5b, 0xb6, 0xaa, 0x98, 0xee, 0x16, 0x2c, 0x32, 0xe5, 0xb5,
+  0x40, 0x09, 0x99, 0x8c, 0xfd, 0x3e, 0x65, 0xdd, 0xbb, 0xc2, 0xb5, 0x90, 0x9a, 0x62, 0xe3, 0xf3,
+  0xe7, 0x5a, 0xe1, 0x8e, 0x1b, 0x16, 0x69, 0xea, 0x5e, 0x2a, 0x3b, 0x85, 0xfe, 0xf7, 0x44, 0xa6,
+  0x4f, 0x57, 0x32, 0x82, 0x01, 0x25, 0xe9, 0x5e, 0x14, 0xb9, 0xce, 0x07, 0xab, 0x3b, 0x2c, 0x3c,
+  0x6e, 0x77, 0x5a, 0x04, 0x10, 0x75, 0x4f, 0x34, 0x09, 0x26, 0x65, 0xb2, 0x2c, 0x6b, 0xaf, 0x8a,
+  0xf3, 0xde, 0xba, 0xf4, 0x13, 0x1f, 0x3f, 0xbe, 0x70, 0x18, 0x50, 0x3f, 0x1c, 0x93, 0x39, 0xd5,
+  0xaf, 0x65, 0xaf, 0x58, 0xb3, 0x23, 0x1e, 0xdd, 0x2c, 0xd1, 0x66, 0x91, 0xf7, 0xeb, 0xfb, 0x32,
+  0x8c, 0x5c, 0x77, 0x39, 0x41, 0xba, 0x8d, 0x02, 0x8d, 0x9f, 0x73, 0x92, 0x45, 0xbe, 0x39, 0xa0,
+  0x1b, 0x6d, 0x22, 0x19, 0xd2, 0xfb, 0x8d, 0x0e, 0x7e, 0x7d, 0xc9, 0x61, 0xf0, 0xe5, 0xd3, 0x27,
+  0xbb, 0x06, 0xa0, 0x35, 0xd0, 0x7c, 0x85, 0xbb, 0x0d, 0x20, 0xf4, 0xea, 0x6f, 0xc3, 0xbb, 0x15,
+  0xa5, 0xc2, 0x5c, 0x95, 0xb0, 0x80, 0x57, 0x6e, 0xa0, 0xf9, 0x54, 0xc2, 0x2e, 0x64, 0xf2, 0x6f,
+  0x62, 0xda, 0x6a, 0xb5, 0x9c, 0x37, 0xf1, 0x73, 0xd6, 0x3d, 0x1b, 0xf2, 0xb9, 0x92, 0xed, 0xcf,
+  0xf1, 0xd6, 0x5b, 0x9d, 0x17, 0x68, 0xf8, 0x62, 0x97, 0x66, 0x7c, 0x3b, 0xf4, 0xf7, 0xd4, 0x50,
+  0x22, 0xbc, 0xb8, 0xfe, 0xbc, 0x06, 0x20, 0x79, 0x9e, 0x05, 0xa7, 0xc4, 0xc2, 0xad, 0x74, 0xb1,
+  0x28, 0x47, 0xe5, 0x04, 0xd4, 0x35, 0x0f, 0x40, 0xf8, 0x10, 0x20, 0x6b, 0xbb, 0x39, 0x6e, 0xa3,
+  0xb0, 0x92, 0xa6, 0xe1, 0x64, 0x67, 0xcf, 0x26, 0x54, 0xfe, 0x2e, 0x7b, 0x57, 0x49, 0xff, 0x41,
+  0x66, 0x6e, 0xf9, 0xe6, 0x80, 0xc8, 0x45, 0xc9, 0xbd, 0xeb, 0xec, 0x6b, 0x18, 0x22, 0x54, 0xc0,
+  0x79, 0x9e, 0x67, 0x5a, 0x8d, 0xec, 0x74, 0x92, 0xaa, 0x37, 0x64, 0x02, 0x3e, 0x94, 0x44, 0xa3,
+  0x33, 0x65, 0x9e, 0x2b, 0x94, 0x84, 0x9d, 0x99, 0x6a, 0x37, 0x9b, 0xb4, 0xf6, 0x59, 0x18, 0x07,
+  0xa8, 0x75, 0xa2, 0x04, 0x8b, 0x80, 0x0c, 0xde, 0x30, 0x51, 0x59, 0x4c, 0x61, 0x85, 0xda, 0x82,
+  0x3b, 0xeb, 0x4d, 0x4d, 0x78, 0xa6, 0x3c, 0x5d, 0x67, 0x5c, 0x53, 0xd9, 0x48, 0xc5, 0x6a, 0x8a,
+  0x12, 0xab, 0x37, 0x19, 0x0c, 0x64, 0xea, 0x70, 0x74, 0x01, 0x44, 0x12, 0x13, 0x6f, 0xe2, 0x6c,
+  0x16, 0xe4, 0xe6, 0x0a, 0x29, 0x64, 0xa2, 0xdb, 0xb4, 0x4e, 0x45, 0x47, 0xbc, 0xa8, 0x42, 0x30,
+  0x51, 0x9c, 0x16, 0x5e, 0xee, 0xd6, 0xa8, 0x16, 0xf6, 0xd4, 0x03, 0x3b, 0x08, 0xbd, 0xc8, 0x41,
+  0xa1, 0x56, 0x2d, 0x79, 0x3a, 0x5c, 0x33, 0x0c, 0x42, 0xea, 0x88, 0xf1, 0x88, 0x18, 0xf9, 0xf4,
+  0xe2, 0x2a, 0x44, 0x0d, 0x05, 0x29, 0xa9, 0xe3, 0xee, 0x2b, 0x41, 0x4d, 0x2b, 0x7d, 0x0b, 0xac,
+  0x3c, 0x85, 0x62, 0xcd, 0x75, 0x2e, 0x2e, 0xcf, 0xaf, 0xcf, 0xdb, 0xdf, 0x8e, 0xcf, 0x34, 0xa3,
+  0xe7, 0x72, 0x15, 0x20, 0xaa, 0xc8, 0x59, 0xad, 0x85, 0xc8, 0x69, 0xe1, 0x60, 0x90, 0xe7, 0x0c,
+  0xba, 0xcc, 0x81, 0xa8, 0x63, 0x21, 0x94, 0x4c, 0x51, 0x0e, 0xbc, 0x2b, 0xc2, 0x10, 0x39, 0x7f,
+  0xa7, 0x88, 0x37, 0x40, 0xe6, 0xbb, 0x28, 0x94, 0x72, 0x08, 0xca, 0x71, 0x5f, 0x26, 0x03, 0xb1,
+  0x47, 0xfa, 0xfb, 0xc6, 0xfa, 0x2b, 0x3d, 0x97, 0x81, 0x76, 0x97, 0x3c, 0x3f, 0xc9, 0x29, 0xd4,
+  0xec, 0xd6, 0xc0, 0xbb, 0xb2, 0xc6, 0xd2, 0xff, 0x41, 0x32, 0xf3, 0xfa, 0xc2, 0x28, 0x02, 0x99,
+  0x28, 0x75, 0xe0, 0x5c, 0x2e, 0xa4, 0xfc, 0x41, 0x46, 0xfd, 0x3d, 0xd2, 0xd4, 0x68, 0x46, 0x6d,
+  0x38, 0x9d, 0x95, 0xd4, 0xda, 0x64, 0x28, 0x91, 0x20, 0xdf, 0xa0, 0xee, 0x7b, 0xa1, 0xa8, 0x25,
+  0xca, 0xa2, 0x39, 0xbb, 0x2e, 0x2f, 0x8b, 0xaa, 0xa5, 0x95, 0xf8, 0x7c, 0xe3, 0x9e, 0xca, 0xab,
+  0x6a, 0x4d, 0x65, 0x4b, 0xff, 0xb6, 0x6a, 0x8b, 0x16, 0x79, 0x1e, 0x4b, 0x5d, 0xbe, 0x72, 0xb7,
+  0x10, 0xc9, 0x4e, 0x7c, 0x2f, 0x0b, 0x32, 0x0b, 0xd5, 0x6e, 0xe7, 0xb5, 0xd0, 0x61, 0x34, 0x4e,
+  0x0b, 0xc3, 0x89, 0x97, 0xaa, 0x05, 0x55, 0x3f, 0x5b, 0x09, 0x5c, 0x5e, 0xd6, 0xb2, 0x10, 0x37,
+  0x3c, 0x54, 0xbe, 0xf8, 0xab, 0x58, 0x50, 0x3f, 0x4a, 0x94, 0x5c, 0xe6, 0x08, 0xda, 0x15, 0xcd,
+  0x13, 0x1e, 0xb3, 0x8d, 0xda, 0x39, 0x4a, 0x55, 0x80, 0xf8, 0x45, 0x92, 0x66, 0x62, 0x67, 0x1d,
+  0xc5, 0x68, 0x2a, 0x11, 0xd3, 0xa8, 0xae, 0x15, 0xee, 0x38, 0x4d, 0x1e, 0x9f, 0x6a, 0x02, 0x7e,
+  0x50, 0xba, 0x8b, 0x36, 0x3c, 0xae, 0x9e, 0xe9, 0x32, 0x27, 0xa3, 0x96, 0x69, 0xd1, 0x92, 0x22,
+  0x47, 0x3a, 0x9c, 0xe2, 0xe4, 0xb9, 0x4a, 0x26, 0x38, 0x81, 0x4a, 0x55, 0xd8, 0xfb, 0xf6, 0xfc,
+  0x9a, 0x37, 0xda, 0xe9, 0x9b, 0x27, 0x2e, 0x65, 0xbf, 0x0c, 0x3e, 0x61, 0x2c, 0x36, 0x55, 0x11,
+  0x78, 0x58, 0xea, 0x6b, 0xf8, 0x24, 0x2c, 0x28, 0xcd, 0xc1, 0x04, 0x35, 0xba, 0x9f, 0xc4, 0x26,
+  0xa4, 0xc4, 0x48, 0xa0, 0xf4, 0x73, 0x15, 0x99, 0x99, 0xe7, 0x64, 0xee, 0x7c, 0xb8, 0xab, 0x8b,
+  0xcd, 0x16, 0xdd, 0x85, 0x57, 0x75, 0xc9, 0x41, 0xb4, 0xe2, 0x8b, 0x69, 0xfa, 0x42, 0xa0, 0x2d,
+  0x05, 0xe7, 0x90, 0xcb, 0x61, 0x36, 0xcd, 0x3b, 0x00, 0x20, 0xc6, 0xdb, 0xe2, 0xe6, 0x0c, 0x96,
+  0x44, 0xde, 0x8a, 0xb6, 0x16, 0x63, 0xef, 0x0d, 0x3f, 0xcd, 0xbb, 0x62, 0x9d, 0x37, 0xae, 0xa8,
+  0xc5, 0xc5, 0x08, 0xfc, 0xf4, 0xb3, 0x29, 0xf9, 0xa3, 0xd1, 0x07, 0xb4, 0x61, 0xd1, 0x2a, 0x55,
+  0xc2, 0xa0, 0xd4, 0xd4, 0x25, 0x27, 0xa5, 0x3e, 0x4e, 0x2a, 0xd5, 0x84, 0xfa, 0x36, 0xd4, 0x2d,
+  0x17, 0x27, 0x28, 0x6f, 0x1b, 0x8c, 0xd7, 0x38, 0x3e, 0x28, 0x3a, 0xc4, 0x32, 0x0f, 0xdf, 0xb6,
+  0x74, 0x8e, 0xe1, 0xa7, 0xd9, 0xc9, 0xd5, 0x61, 0xab, 0x30, 0xe1, 0x65, 0xb6, 0x6e, 0xa9, 0xc4,
+  0x3c, 0x5c, 0xbd, 0x46, 0xc5, 0x24, 0x53, 0x78, 0x11, 0x02, 0xc5, 0x30, 0x54, 0xc8, 0xbe, 0x9e,
+  0xc8, 0xd3, 0x60, 0x96, 0xf4, 0x7a, 0x95, 0x9f, 0x32, 0xe8, 0xd1, 0x4b, 0xf2, 0x3e, 0x41, 0x2f,
+  0x12, 0x5a, 0xf6, 0x13, 0x3a, 0x33, 0x0b, 0x5d, 0x85, 0x52, 0x97, 0x3d, 0x75, 0xf6, 0xd4, 0x58,
+  0x46, 0x5a, 0x22, 0xf0, 0xb9, 0x64, 0x33, 0x54, 0xe2, 0xf6, 0x4f, 0x6a, 0xf7, 0x4f, 0xef, 0xeb,
+  0x62, 0x14, 0xc6, 0xf8, 0xe1, 0x3f, 0x3e, 0xdf, 0x69, 0x85, 0x90, 0x3d, 0xe7, 0xd6, 0x23, 0x7a,
+  0x72, 0x40, 0x97, 0x39, 0x88, 0x6f, 0x85, 0x6a, 0xc2, 0xe0, 0x31, 0x0f, 0x14, 0x86, 0xb8, 0x42,
+  0x9e, 0x1d, 0xc8, 0xc7, 0xf3, 0x81, 0x9b, 0x73, 0x2b, 0x5b, 0xed, 0xaa, 0xef, 0x73, 0x07, 0x51,
+  0x17, 0xd9, 0xf4, 0xe5, 0x16, 0x04, 0xee, 0xac, 0xfb, 0x9b, 0x30, 0xc8, 0x86, 0x39, 0xc0, 0x20,
+  0x94, 0x51, 0xa0, 0x6f, 0x12, 0x1c, 0x08, 0x47, 0x17, 0x2c, 0xeb, 0x28, 0x35, 0x36, 0x4b, 0xf0,
+  0x22, 0x48, 0xa5, 0xc9, 0xcc, 0x4e, 0x35, 0xcd, 0x73, 0x8a, 0x72, 0x6a, 0xe4, 0x8f, 0x5d, 0x6a,
+  0x0c, 0x56, 0xdb, 0xc6, 0x9a, 0x08, 0x48, 0x83, 0x0c, 0x26, 0x49, 0x16, 0x24, 0x86, 0x2c, 0xc3,
+  0x9d, 0xdd, 0x86, 0x87, 0x52, 0x00, 0x61, 0x64, 0x83, 0x34, 0x9b, 0x90, 0x64, 0x0e, 0x1e, 0x87,
+  0xf5, 0xfa, 0x1d, 0x84, 0x03, 0xb1, 0x0a, 0xa6, 0xff, 0xf8, 0x06, 0xcc, 0x8d, 0x0a, 0x66, 0xe5,
+  0x89, 0x9e, 0x10, 0x59, 0xdb, 0xf4, 0xd2, 0xe2, 0xa0, 0xab, 0xdb, 0x23, 0x6e, 0x2c, 0x1a, 0xd0,
+  0x44, 0x83, 0xd6, 0xf2, 0x73, 0xde, 0xb0, 0x90, 0xe3, 0xba, 0x41, 0x00, 0xa1, 0xb6, 0x5e, 0xd4,
+  0xae, 0x8e, 0x74, 0xe0, 0xc9, 0xbf, 0xf4, 0x68, 0x53, 0xef, 0x42, 0x0e, 0x3d, 0xa2, 0x57, 0x3b,
+  0xbc, 0xc0, 0x05, 0x68, 0x1a, 0x9d, 0x87, 0xf6, 0x1f, 0xdb, 0x7a, 0x51, 0x8b, 0xd0, 0x18, 0x35,
+  0xd0, 0x3a, 0xac, 0xe5, 0x3d, 0x58, 0xdb, 0xcb, 0x83, 0xd4, 0x9f, 0xfd, 0xd0, 0x86, 0x69, 0x35,
+  0x28, 0xcd, 0x05, 0x8f, 0x1f, 0x4f, 0x7d, 0xf5, 0xea, 0xad, 0xae, 0xc6, 0x6c, 0xb0, 0x1b, 0x54,
+  0xee, 0x86, 0x32, 0x52, 0xb3, 0x26, 0x40, 0x58, 0xdc, 0xff, 0x7e, 0x44, 0x92, 0xb5, 0x11, 0xd8,
+  0x60, 0xb3, 0x12, 0x28, 0x37, 0x34, 0xf3, 0xb5, 0x1f, 0x85, 0xe0, 0xf2, 0x3b, 0x0d, 0x96, 0xe0,
+  0xd6, 0xbc, 0x7e, 0xb9, 0x61, 0xbd, 0xe7, 0xf4, 0x29, 0x97, 0xda, 0xe4, 0x37, 0x40, 0x60, 0x0e,
+  0x7c, 0xe9, 0xa7, 0x88, 0xce, 0x99, 0xdb, 0xaa, 0x0b, 0xfc, 0x83, 0xa1, 0x0d, 0x75, 0xf3, 0xd1,
+  0x18, 0x3e, 0x7b, 0xa1, 0x79, 0xb0, 0x2c, 0xc4, 0x9f, 0x62, 0x9c, 0xa9, 0xf6, 0x52, 0x17, 0x35,
+  0x0d, 0x20, 0xa7, 0x56, 0x17, 0xba, 0x75, 0xf2, 0x2a, 0x98, 0x69, 0xaf, 0x10, 0xb4, 0x79, 0xee,
+  0xe2, 0x7c, 0x18, 0x0c, 0x76, 0xfa, 0x5b, 0x1b, 0x8e, 0x78, 0xae, 0xaf, 0xe4, 0xd5, 0xa3, 0xda,
+  0x6d, 0x05, 0xa3, 0xb2, 0x89, 0x53, 0xe1, 0xb2, 0xf9, 0xcb, 0x4e, 0x7f, 0xd0, 0x72, 0xf8, 0xf4,
+  0xba, 0x2b, 0x9e, 0x42, 0xf9, 0x8f, 0xd7, 0x58, 0xe4, 0x67, 0xd6, 0x8b, 0x5e, 0x73, 0x51, 0x15,
+  0x28, 0xf2, 0x3b, 0xe5, 0x41, 0x18, 0x0f, 0x3a, 0x41, 0xae, 0xeb, 0x2a, 0x4f, 0xd3, 0xad, 0x15,
+  0x30, 0x63, 0xf6, 0x4d, 0x3e, 0x94, 0xc7, 0x1e, 0x19, 0xd4, 0x3b, 0x63, 0x66, 0xb5, 0x9c, 0x34,
+  0xd7, 0x77, 0xf8, 0xec, 0xd2, 0xf7, 0xba, 0x60, 0x28, 0xa4, 0x03, 0xcf, 0x3a, 0x80, 0xda, 0x40,
+  0x5c, 0x04, 0xf2, 0x40, 0x13, 0x02, 0x91, 0xa7, 0x90, 0x58, 0xc5, 0x8e, 0x90, 0xc1, 0xf0, 0xf5,
+  0xdd, 0x0c, 0x8e, 0xe4, 0x66, 0x00, 0xb2, 0xc3, 0x29, 0x81, 0xbb, 0x34, 0x83, 0x8d, 0xb6, 0x0c,
+  0x88, 0xea, 0x90, 0x29, 0x21, 0x0d, 0xf5, 0x14, 0x55, 0xd2, 0x84, 0x3e, 0xc5, 0x07, 0x62, 0xc5,
+  0x68, 0xc3, 0x02, 0xcd, 0x18, 0x87, 0xca, 0xd2, 0xe4, 0x01, 0xd9, 0xe4, 0x93, 0xbe, 0x3d, 0xf9,
+  0xb0, 0xb5, 0xb5, 0xe5, 0xe4, 0x86, 0x33, 0x40, 0x92, 0x5c, 0xce, 0xf8, 0xbe, 0x5f, 0xce, 0x24,
+  0xfa, 0x7e, 0x6e, 0xbd, 0x35, 0x7e, 0x14, 0xca, 0x8f, 0x55, 0x83, 0x14, 0x3a, 0xe0, 0xf9, 0xa2,
+  0x56, 0x9d, 0xea, 0x5a, 0x75, 0x4a, 0xaf, 0xde, 0x48, 0x00, 0xfa, 0xf8, 0x69, 0x97, 0xd7, 0x6b,
+  0x42, 0x1c, 0x28, 0xf5, 0xe4, 0x7d, 0x18, 0x5f, 0x40, 0x27, 0x79, 0xfe, 0x41, 0x83, 0xf4, 0x86,
+  0xe3, 0x3a, 0x71, 0x21, 0x68, 0x5d, 0x3c, 0xb9, 0xd3, 0x9a, 0x35, 0x15, 0x85, 0x31, 0x4d, 0xcd,
+  0x16, 0x26, 0xf4, 0x42, 0x6c, 0x2a, 0x24, 0x3e, 0x75, 0x54, 0xdc, 0x69, 0x5d, 0x6c, 0x68, 0x78,
+  0x04, 0xa8, 0x4d, 0x53, 0x59, 0xbd, 0x60, 0x04, 0x45, 0x16, 0x7f, 0x1a, 0xc6, 0x4d, 0xda, 0xe5,
+  0x1e, 0x9d, 0xc3, 0x48, 0x46, 0xe8, 0x48, 0x4c, 0x45, 0x16, 0x22, 0xd3, 0x14, 0xf4, 0xa2, 0xa5,
+  0x56, 0x6d, 0x18, 0x98, 0xf3, 0xe0, 0x5d, 0x7e, 0x1e, 0x94, 0x09, 0xdb, 0xbc, 0x26, 0x95, 0xbe,
+  0x7d, 0xa3, 0x0a, 0x6a, 0x73, 0xb3, 0x28, 0x62, 0xb5, 0xf1, 0x55, 0x6d, 0xad, 0x52, 0xd2, 0xc3,
+  0x9a, 0xac, 0x40, 0x58, 0x9b, 0xcb, 0xae, 0x4b, 0x36, 0xec, 0xe8, 0x8f, 0x00, 0xcf, 0x6a, 0xb4,
+  0x66, 0x6d, 0x84, 0xf5, 0xd2, 0x36, 0xd7, 0xeb, 0xa5, 0xf1, 0xd8, 0x11, 0x7a, 0xde, 0xc8, 0x0c,
+  0x72, 0x88, 0x2c, 0xbc, 0x51, 0xd0, 0xa1, 0xd7, 0x05, 0xeb, 0xb5, 0x65, 0x65, 0xae, 0x10, 0xb7,
+  0xb7, 0xbc, 0x86, 0xba, 0xb8, 0xbd, 0xbb, 0xc3, 0x8f, 0xdc, 0x81, 0xf0, 0x71, 0xab, 0x2e, 0xb6,
+  0xee, 0xee, 0xee, 0xca, 0x4b, 0xd2, 0x5b, 0x86, 0x0b, 0x7c, 0x35, 0xbc, 0xab, 0x5e, 0x94, 0x2e,
+  0x18, 0xa4, 0xaa, 0x5e, 0x55, 0x32, 0x80, 0xcc, 0x4e, 0x60, 0x04, 0x07, 0xc0, 0x76, 0x89, 0x44,
+  0xcd, 0x9e, 0x5c, 0x30, 0x27, 0xed, 0xfb, 0xa6, 0xf0, 0xcc, 0x4b, 0x5e, 0x7e, 0x37, 0xbd, 0x4a,
+  0xdd, 0xf6, 0x29, 0x45, 0xf7, 0x52, 0x36, 0x8d, 0x5c, 0xfb, 0x45, 0x55, 0x63, 0x90, 0xe8, 0xef,
+  0x27, 0x2c, 0x2b, 0xb5, 0xb7, 0x01, 0xe4, 0x6a, 0x56, 0x71, 0xc4, 0x75, 0x86, 0x65, 0xeb, 0xaf,
+  0x80, 0x6a, 0xc6, 0x65, 0x6d, 0x5c, 0x2a, 0x7e, 0x99, 0xe5, 0x3f, 0xdb, 0x3e, 0x61, 0xa9, 0xea,
+  0xf6, 0xae, 0xb6, 0xec, 0xd0, 0x8b, 0x12, 0x3f, 0xc8, 0x0f, 0xbd, 0xea, 0xd5, 0x9f, 0xb1, 0x06,
+  0xbe, 0xe8, 0xfb, 0x07, 0xff, 0x51, 0xc4, 0x2e, 0x75, 0x04, 0x2a, 0x46, 0xc2, 0x9c, 0x2a, 0xd7,
+  0x82, 0xc9, 0x03, 0x65, 0x11, 0xe6, 0x76, 0x10, 0x27, 0x2f, 0x6b, 0xcf, 0x02, 0xd3, 0x25, 0x55,
+  0x1e, 0x48, 0xf5, 0x31, 0xbb, 0x70, 0xf0, 0x52, 0xcc, 0xd4, 0x38, 0xaf, 0x5e, 0x27, 0x52, 0xf1,
+  0x79, 0x42, 0x67, 0xdf, 0x7e, 0x32, 0x1a, 0xc1, 0x4d, 0xe1, 0xa5, 0xfc, 0x1b, 0xa1, 0x17, 0x16,
+  0x50, 0xde, 0x2f, 0xa2, 0xac, 0xfa, 0xf8, 0x91, 0x32, 0x7c, 0x94, 0x4b, 0xc1, 0xd3, 0x15, 0x5f,
+  0x22, 0xd1, 0xce, 0x96, 0x1d, 0x92, 0xf3, 0x8b, 0xc3, 0xb3, 0xb2, 0x08, 0xd3, 0x55, 0xad, 0x21,
+  0xa6, 0xb5, 0x66, 0xd7, 0x85, 0xe6, 0x82, 0xd2, 0x74, 0x55, 0xa1, 0x7d, 0xe9, 0x8f, 0xc4, 0x38,
+  0xec, 0x3f, 0x28, 0x7e, 0xa2, 0x46, 0x7f, 0x9c, 0xc5, 0x45, 0x67, 0x07, 0xc9, 0x42, 0xec, 0x64,
+  0x08, 0x88, 0x51, 0x94, 0xcc, 0x78, 0x22, 0x95, 0x41, 0x98, 0x52, 0xed, 0x83, 0x42, 0xa8, 0xb9,
+  0x56, 0x14, 0xa4, 0x2e, 0xc9, 0x5b, 0x87, 0x4e, 0xf2, 0x79, 0x1c, 0x62, 0xba, 0xa1, 0xed, 0x98,
+  0xfd, 0xe4, 0x4e, 0x50, 0x91, 0x7b, 0xf8, 0x41, 0xc0, 0xd9, 0x3e, 0x5d, 0x50, 0xa3, 0x3a, 0x44,
+  0x6d, 0x73, 0x70, 0x7e, 0x6a, 0xee, 0xd5, 0x4f, 0xb0, 0xa1, 0xfc, 0xd7, 0x46, 0x6e, 0xe1, 0x5a,
+  0x0b, 0x0f, 0x7c, 0x8a, 0x6b, 0x60, 0x16, 0x2a, 0x96, 0xd9, 0x2c, 0x49, 0x1f, 0xf2, 0x12, 0xbb,
+  0x2e, 0x54, 0x62, 0x0a, 0x68, 0xcc, 0x8e, 0x10, 0xec, 0xfa, 0x72, 0xed, 0x85, 0xca, 0x79, 0xb1,
+  0x25, 0xc5, 0x07, 0x4b, 0xc5, 0xa8, 0xf4, 0x71, 0x4b, 0x2f, 0xef, 0x51, 0x19, 0xf9, 0x51, 0xbe,
+  0x99, 0xa6, 0x49, 0x91, 0x2f, 0x69, 0x18, 0x06, 0x01, 0x79, 0x4f, 0x15, 0x15, 0x79, 0x02, 0xb5,
+  0x44, 0x4d, 0xd9, 0xf7, 0x4a, 0xdf, 0xd7, 0xe3, 0xb4, 0xab, 0xc1, 0x66, 0xaa, 0x84, 0xc7, 0xbf,
+  0x9d, 0xf2, 0xec, 0xee, 0x65, 0x71, 0xe9, 0xe2, 0xf8, 0xb2, 0x44, 0x83, 0xc8, 0xb2, 0xfa, 0x0f,
+  0x15, 0xb5, 0x55, 0x3a, 0xee, 0x7f, 0x9f, 0x25, 0x91, 0xe9, 0x59, 0x0f, 0x09, 0x52, 0x49, 0xae,
+  0x5e, 0xbe, 0x25, 0x28, 0x7c, 0x98, 0xe4, 0x59, 0xf1, 0xde, 0x60, 0xae, 0x9a, 0xe2, 0xfa, 0x0c,
+  0x0a, 0xa5, 0x75, 0x15, 0xef, 0x98, 0xf5, 0xdf, 0x2d, 0x15, 0x51, 0x6f, 0x7e, 0x0b, 0xf2, 0xc8,
+  0xa0, 0x7f, 0x6a, 0xab, 0x60, 0xe7, 0x11, 0xf9, 0x9d, 0xc9, 0x7d, 0x82, 0x75, 0x24, 0xd4, 0x30,
+  0x20, 0xab, 0x28, 0xab, 0xe5, 0xfc, 0xb1, 0x25, 0xaa, 0xab, 0x90, 0xce, 0x3e, 0xf9, 0xda, 0xeb,
+  0x52, 0x48, 0xd4, 0x28, 0xee, 0x78, 0x6a, 0x6f, 0xd4, 0xf3, 0x82, 0x23, 0x3b, 0xfa, 0x0f, 0x1f,
+  0xce, 0xf9, 0x0f, 0xfc, 0x9a, 0x4c, 0xaf, 0x99, 0x98, 0xe7, 0x31, 0xcf, 0xb5, 0xce, 0x1b, 0x05,
+  0x18, 0x0c, 0xfe, 0x73, 0x09, 0x8e, 0x8e, 0x6c, 0x11, 0x88, 0xe2, 0xdf, 0x92, 0xc1, 0x9f, 0x64,
+  0xc9, 0x7f, 0x2c, 0x04, 0xdf, 0x5e, 0x95, 0x52, 0x68, 0x9a, 0x45, 0x30, 0xc7, 0xff, 0xff, 0x03,
+  0x7c, 0x61, 0x04, 0x29, 0xa0, 0x3a, 0x00, 0x00,
+};
+
+// config.css: 1660 bytes, 776 gzipped
+static const uint8_t WEB_ASSET_CONFIG_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x54, 0x4d, 0x6f, 0xdc, 0x38,
+  0x0c, 0xbd, 0xf7, 0x57, 0x10, 0x0d, 0x8a, 0x24, 0x80, 0x3d, 0xb0, 0x27, 0x71, 0x3b, 0xb5, 0xd1,
+  0xc3, 0xee, 0x61, 0xb1, 0x7b, 0x68, 0x0f, 0x1b, 0xec, 0xa9, 0x28, 0x0a, 0x59, 0xa2, 0x6d, 0x21,
+  0xb2, 0x64, 0x48, 0x72, 0x66, 0x66, 0x8d, 0xfc, 0xf7, 0x52, 0xfe, 0xc8, 0x78, 0xa6, 0x69, 0x21,
+  0xc0, 0xb0, 0x28, 0x8a, 0x22, 0xdf, 0x7b, 0x64, 0x69, 0xc4, 0x71, 0xa8, 0x8c, 0xf6, 0x71, 0xc5,
+  0x5a, 0xa9, 0x8e, 0x79, 0xcc, 0xba, 0x4e, 0x61, 0xec, 0x8e, 0xce, 0x63, 0x1b, 0xc1, 0x9f, 0x4a,
+  0xea, 0xc7, 0xcf, 0x8c, 0x3f, 0x8c, 0xfb, 0xbf, 0xc8, 0x31, 0x82, 0xb7, 0x0f, 0x58, 0x1b, 0x84,
+  0xff, 0xfe, 0x79, 0x1b, 0xc1, 0xbf, 0xa6, 0x34, 0xde, 0x90, 0xed, 0x6f, 0x54, 0x4f, 0xe8, 0x25,
+  0x67, 0xf0, 0x05, 0x7b, 0xa4, 0x93, 0x3f, 0xac, 0x64, 0x2a, 0x02, 0xc7, 0xb4, 0x8b, 0x1d, 0x5a,
+  0x59, 0x15, 0x2d, 0xb3, 0xb5, 0xd4, 0xf9, 0x36, 0xe9, 0x0e, 0x45, 0xc9, 0xf8, 0x63, 0x6d, 0x4d,
+  0xaf, 0x45, 0x7e, 0x95, 0x32, 0x5a, 0x65, 0xc1, 0x8d, 0x32, 0x36, 0xbf, 0xc2, 0x24, 0x2c, 0x72,
+  0x3e, 0xc4, 0x7b, 0x29, 0x7c, 0x93, 0xc3, 0xc7, 0x24, 0xdc, 0x80, 0xf9, 0x3a, 0x24, 0xc0, 0x7a,
+  0x6f, 0x0a, 0xe8, 0x98, 0x10, 0x52, 0xd7, 0x39, 0xa4, 0x16, 0xdb, 0xe2, 0xf9, 0x4d, 0x93, 0x46,
+  0xcd, 0x36, 0x6a, 0xee, 0x86, 0x39, 0x50, 0x55, 0x55, 0xc5, 0x33, 0x34, 0xdb, 0xa1, 0x34, 0x56,
+  0xa0, 0x8d, 0x29, 0x51, 0x6f, 0xda, 0x7c, 0xdb, 0x1d, 0xc0, 0x19, 0x25, 0x05, 0x5c, 0xdd, 0x7d,
+  0xd8, 0xf1, 0x2a, 0x29, 0xe6, 0x40, 0x8b, 0x43, 0x76, 0x7a, 0x2c, 0xf6, 0xa6, 0xcb, 0x61, 0x3b,
+  0xc5, 0xaf, 0x8c, 0x6d, 0x87, 0x75, 0xde, 0x5b, 0x4e, 0x0b, 0x97, 0xeb, 0x73, 0x5d, 0xd3, 0x5b,
+  0x96, 0x09, 0xd9, 0xbb, 0x7c, 0x37, 0x5a, 0x0e, 0xb1, 0x6b, 0x98, 0x30, 0xfb, 0x3c, 0x81, 0xf0,
+  0x38, 0xc5, 0x07, 0x5b, 0x97, 0xec, 0x26, 0x89, 0xc6, 0xb5, 0x49, 0x6f, 0x29, 0xba, 0x90, 0x4f,
+  0xc3, 0xfc, 0xe8, 0x9c, 0x47, 0x1a, 0x12, 0x79, 0x06, 0xc5, 0x4a, 0x54, 0x83, 0x90, 0xae, 0x53,
+  0xec, 0x98, 0x97, 0xca, 0xf0, 0xc7, 0xe2, 0xdc, 0x31, 0xf8, 0x8d, 0x14, 0xee, 0x51, 0xd6, 0x8d,
+  0xcf, 0x4b, 0xa3, 0xc4, 0x82, 0x26, 0xe7, 0x9c, 0x82, 0x4b, 0xdd, 0xf5, 0xfe, 0xab, 0x3f, 0x76,
+  0xf8, 0xe9, 0xda, 0xe3, 0xc1, 0x5f, 0x7f, 0x8b, 0xd6, 0x26, 0xdd, 0xb7, 0x25, 0xda, 0x0b, 0x63,
+  0xc7, 0x9c, 0xdb, 0x53, 0x35, 0x64, 0x76, 0xa8, 0x90, 0xfb, 0x61, 0xa2, 0xe3, 0xe3, 0xee, 0xdd,
+  0x19, 0x39, 0xb4, 0x5d, 0x10, 0xd8, 0xbd, 0x00, 0x90, 0xa7, 0x27, 0x94, 0xb3, 0x2c, 0xbb, 0x80,
+  0xe5, 0x7e, 0x49, 0x78, 0xd6, 0xdc, 0x24, 0x95, 0x95, 0x52, 0xc6, 0x43, 0x27, 0xff, 0xc7, 0x3c,
+  0x25, 0xe8, 0x4f, 0x98, 0xc7, 0x73, 0x55, 0x77, 0x8c, 0x16, 0xbf, 0x50, 0xcc, 0x79, 0x99, 0xbc,
+  0x41, 0xfe, 0x48, 0xd8, 0x5f, 0x7f, 0x5b, 0x60, 0xb5, 0x23, 0x38, 0x69, 0x60, 0xe9, 0x09, 0x6d,
+  0x90, 0xaa, 0x8a, 0x99, 0x92, 0xb5, 0xce, 0x5b, 0x29, 0x84, 0x42, 0x0a, 0x30, 0x62, 0xfd, 0x95,
+  0x88, 0xfe, 0x74, 0x2d, 0x75, 0x70, 0xa2, 0xe2, 0x61, 0x65, 0xe4, 0x0d, 0x0b, 0x48, 0x7d, 0xf7,
+  0xb2, 0x45, 0xd3, 0x5f, 0x9e, 0x2a, 0x14, 0xdf, 0x2b, 0xa9, 0xa5, 0x6b, 0x4e, 0x0e, 0x30, 0xc0,
+  0x42, 0x9d, 0xd4, 0xd4, 0x4b, 0x18, 0x4f, 0x0c, 0xae, 0xf9, 0xd2, 0x24, 0x2c, 0xa6, 0x0a, 0x78,
+  0x7e, 0x53, 0xf6, 0x44, 0xa8, 0x8e, 0x60, 0x33, 0xfd, 0x0c, 0xaf, 0x54, 0x3e, 0x49, 0xf6, 0x24,
+  0xf1, 0xa0, 0xf2, 0x05, 0xff, 0x34, 0xc8, 0x6b, 0x25, 0x43, 0x8a, 0xac, 0xf1, 0x02, 0xfb, 0x20,
+  0x16, 0xde, 0x5b, 0x47, 0xd7, 0x3b, 0x23, 0xb5, 0x47, 0xbb, 0x46, 0xfb, 0x7d, 0xd0, 0x7e, 0x50,
+  0x48, 0x2c, 0x90, 0x1b, 0xcb, 0xbc, 0x34, 0xd4, 0x71, 0x63, 0x98, 0x97, 0x3a, 0xe0, 0xac, 0x90,
+  0xb3, 0x4e, 0x19, 0xc1, 0x5d, 0xca, 0xc8, 0x1b, 0x43, 0x10, 0x0e, 0xa6, 0x63, 0x5c, 0x7a, 0xba,
+  0x96, 0x6c, 0x76, 0x19, 0x1d, 0x6e, 0xc6, 0xdc, 0xe3, 0x91, 0xab, 0x59, 0x52, 0xe9, 0xd8, 0xe0,
+  0x6b, 0x15, 0xbd, 0x4e, 0xd0, 0xfc, 0x94, 0xc2, 0x6a, 0xe6, 0xf1, 0x75, 0xb1, 0xd1, 0x1b, 0xb5,
+  0x95, 0xe2, 0xa5, 0x67, 0xc2, 0xa6, 0x08, 0x9f, 0x98, 0x46, 0x18, 0x59, 0x3c, 0x06, 0x34, 0xfb,
+  0x56, 0xbb, 0xdc, 0x62, 0x87, 0xcc, 0xdf, 0x84, 0x81, 0x12, 0x57, 0x92, 0x66, 0x5b, 0x2b, 0x35,
+  0x89, 0xfb, 0x66, 0x1b, 0x32, 0x8a, 0x20, 0xad, 0xec, 0xed, 0xed, 0x74, 0xb5, 0x66, 0xdd, 0xd4,
+  0xe1, 0xa1, 0x02, 0x66, 0xc5, 0xd9, 0x24, 0x98, 0xf5, 0xf8, 0xc2, 0x43, 0xf6, 0xd3, 0x24, 0xc8,
+  0x7e, 0x93, 0xad, 0x23, 0xf6, 0xd5, 0x32, 0xb5, 0x18, 0x63, 0x64, 0x62, 0xcb, 0x36, 0xdb, 0xb1,
+  0xf7, 0x61, 0x8e, 0x2d, 0xb0, 0xb9, 0x3d, 0xf3, 0xbc, 0x99, 0x71, 0x9b, 0xb8, 0x86, 0x66, 0x92,
+  0xd1, 0xbc, 0xfb, 0x05, 0x4d, 0x17, 0x88, 0xc2, 0x0c, 0x29, 0xac, 0x31, 0x9d, 0xf8, 0x83, 0x39,
+  0x4f, 0xb8, 0x48, 0x14, 0xce, 0x2b, 0x82, 0xfb, 0xd1, 0xf7, 0x52, 0xa1, 0x70, 0x95, 0x24, 0xa1,
+  0x17, 0x37, 0x82, 0xe9, 0x9a, 0xe8, 0xff, 0x59, 0xc2, 0x82, 0xdf, 0x65, 0xf7, 0xa1, 0xee, 0x1f,
+  0xfa, 0xfd, 0xdc, 0x76, 0x7c, 0x06, 0x00, 0x00,
+};
+
+// config.js: 1038 bytes, 480 gzipped
+static const uint8_t WEB_ASSET_CONFIG_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x53, 0x61, 0x6b, 0xdb, 0x30,
+  0x10, 0xfd, 0xde, 0x5f, 0x71, 0xeb, 0x06, 0x92, 0x59, 0xe2, 0x78, 0x85, 0x0e, 0xd6, 0x2c, 0x85,
+  0xae, 0x4b, 0xa1, 0xb0, 0xb5, 0x85, 0x7d, 0x0c, 0x59, 0x50, 0xa5, 0x73, 0x22, 0xea, 0x48, 0x9e,
+  0x24, 0xa7, 0x35, 0xad, 0xff, 0xfb, 0x64, 0xd9, 0x71, 0x1c, 0xb6, 0x2e, 0xf3, 0x17, 0x9f, 0xce,
+  0xf7, 0xee, 0x9e, 0xdf, 0x3d, 0xa5, 0x85, 0xe2, 0x4e, 0x6a, 0x05, 0x45, 0x2e, 0x98, 0xc3, 0x3b,
+  0x83, 0x1b, 0x89, 0x8f, 0x34, 0x82, 0xe7, 0x23, 0x00, 0x67, 0xca, 0xf0, 0x06, 0xc8, 0xd0, 0x81,
+  0x75, 0xbe, 0x00, 0x26, 0x20, 0x34, 0x2f, 0xd6, 0xa8, 0x5c, 0xfc, 0xab, 0x40, 0x53, 0xfe, 0xc0,
+  0x0c, 0xb9, 0xd3, 0x86, 0x12, 0xa9, 0xf2, 0xc2, 0xcd, 0x14, 0x5b, 0xe3, 0xe4, 0x38, 0x6f, 0xfa,
+  0x2c, 0x02, 0xe6, 0x78, 0x7e, 0xc6, 0x57, 0xc8, 0x1f, 0x50, 0x90, 0x28, 0xde, 0xb0, 0xac, 0xc0,
+  0x71, 0xd7, 0x94, 0xeb, 0x4c, 0x9b, 0x7e, 0xd3, 0x25, 0xba, 0x69, 0x86, 0x75, 0xf8, 0xa5, 0xbc,
+  0x16, 0xb4, 0x19, 0xfa, 0x1e, 0xc8, 0x22, 0x54, 0xee, 0x37, 0x90, 0x29, 0xd0, 0x37, 0x21, 0x1f,
+  0xaf, 0x99, 0xe3, 0x2b, 0x3a, 0xfa, 0x39, 0x4b, 0x86, 0x9f, 0xd8, 0x30, 0xbd, 0x18, 0x5e, 0xcd,
+  0x9f, 0x3f, 0x56, 0xef, 0x46, 0x91, 0xff, 0x93, 0x6e, 0x08, 0x49, 0xc2, 0x43, 0xc6, 0x50, 0x75,
+  0x04, 0xee, 0x8d, 0x5c, 0xae, 0x9c, 0xff, 0x98, 0x33, 0x63, 0xf1, 0x5a, 0x39, 0x7a, 0x98, 0x4a,
+  0x83, 0xd9, 0x72, 0x19, 0xc0, 0x87, 0x24, 0xda, 0x11, 0x92, 0xf6, 0x86, 0xdd, 0xd0, 0xa6, 0x24,
+  0x82, 0x97, 0x97, 0xed, 0x84, 0xcf, 0x90, 0xf4, 0x4e, 0xe7, 0x70, 0x72, 0x7a, 0x5a, 0x73, 0xeb,
+  0xe6, 0x27, 0x7d, 0x56, 0x3a, 0x67, 0x5c, 0xba, 0xd2, 0xa7, 0xdb, 0x4e, 0x30, 0x0a, 0x80, 0xd8,
+  0xe9, 0x2b, 0xf9, 0x84, 0x82, 0x9e, 0x44, 0x3b, 0x0d, 0x37, 0x19, 0x0a, 0xfb, 0xea, 0x62, 0x2e,
+  0xb2, 0x8c, 0x92, 0xb8, 0xae, 0x21, 0x2d, 0x26, 0xd4, 0xc7, 0xa9, 0x36, 0x53, 0xe6, 0x35, 0xf3,
+  0x07, 0x98, 0x9c, 0xb7, 0x7b, 0xae, 0x1b, 0x8a, 0xd8, 0xba, 0x32, 0xc3, 0xf8, 0x9e, 0xf1, 0x87,
+  0xa5, 0xd1, 0x85, 0x12, 0x97, 0x5b, 0xfd, 0xde, 0x12, 0xff, 0xff, 0x41, 0xcd, 0xf1, 0x1f, 0xe5,
+  0x3b, 0xca, 0x6d, 0xd4, 0x94, 0x54, 0x3d, 0xa2, 0x41, 0xc1, 0x9a, 0xe9, 0x8c, 0x48, 0x91, 0x21,
+  0x19, 0x00, 0xc9, 0x8d, 0x54, 0x2e, 0x04, 0xac, 0xb0, 0x21, 0x83, 0xc6, 0xf8, 0x3d, 0xfb, 0x20,
+  0x95, 0x4a, 0xda, 0x15, 0x99, 0x37, 0xf8, 0x06, 0xdb, 0xb1, 0xb6, 0xfb, 0x9c, 0xbd, 0x91, 0xfe,
+  0x65, 0xa2, 0xd7, 0x0c, 0xb4, 0xb5, 0xd0, 0x01, 0xfb, 0xfc, 0xc5, 0x3a, 0xf0, 0x3f, 0xc3, 0x16,
+  0xf6, 0xb1, 0xee, 0xeb, 0x67, 0x1e, 0x50, 0xb4, 0x2f, 0x55, 0x05, 0xbc, 0x06, 0x01, 0xc5, 0xc6,
+  0xba, 0xca, 0x6a, 0x0f, 0x0d, 0xaa, 0x50, 0xd2, 0xde, 0xcf, 0xf6, 0xb6, 0x42, 0xca, 0xa4, 0x5f,
+  0xc0, 0x99, 0x57, 0x0b, 0xa3, 0x9a, 0x59, 0x75, 0xd4, 0xb1, 0x62, 0x42, 0x4c, 0x37, 0x3e, 0xf8,
+  0x26, 0xad, 0x43, 0x85, 0x1e, 0xfb, 0xf5, 0xf6, 0xfb, 0xa5, 0x56, 0xae, 0xce, 0x69, 0x26, 0xbc,
+  0x1d, 0x06, 0xfb, 0x97, 0xde, 0x4f, 0xff, 0x0d, 0x71, 0xde, 0x62, 0x05, 0x0e, 0x04, 0x00, 0x00,
+};
+
+// mqtt.css: 502 bytes, 295 gzipped
+static const uint8_t WEB_ASSET_MQTT_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x8f, 0x4d, 0x8e, 0xc3, 0x20,
+  0x0c, 0x85, 0xf7, 0x3d, 0x05, 0x52, 0xb6, 0x43, 0x45, 0xaa, 0xb6, 0x9a, 0x9a, 0xd5, 0x1c, 0xc5,
+  0x09, 0x26, 0x41, 0x25, 0x80, 0x80, 0x2a, 0xe9, 0x44, 0x73, 0xf7, 0x21, 0xe9, 0x8f, 0xb2, 0xab,
+  0x2c, 0x24, 0x6c, 0x7d, 0xcf, 0x7e, 0xaf, 0xf1, 0xea, 0x3e, 0x6b, 0xef, 0x32, 0xd7, 0x38, 0x18,
+  0x7b, 0x87, 0xc1, 0x3b, 0x9f, 0x02, 0xb6, 0x24, 0x07, 0x8c, 0x9d, 0x71, 0x70, 0x10, 0x61, 0x92,
+  0x0d, 0xb6, 0xd7, 0x2e, 0xfa, 0x9b, 0x53, 0x50, 0xd5, 0x58, 0xaa, 0x91, 0xad, 0xb7, 0x3e, 0x42,
+  0x45, 0x62, 0xa9, 0x02, 0x4f, 0x7c, 0x34, 0x2a, 0xf7, 0xc0, 0x2e, 0x62, 0x51, 0xb0, 0xa7, 0x9c,
+  0x09, 0x86, 0xb7, 0xec, 0x25, 0x0b, 0xa8, 0x94, 0x71, 0x1d, 0xb0, 0x3a, 0xd2, 0x20, 0xff, 0x76,
+  0x7d, 0x3d, 0x3f, 0x57, 0x68, 0xad, 0xe5, 0xd6, 0xc2, 0x4f, 0x34, 0x68, 0xbf, 0x12, 0xba, 0xc4,
+  0x13, 0x45, 0xa3, 0x0b, 0x1c, 0xe6, 0x4f, 0x40, 0xa4, 0x79, 0xec, 0x4d, 0x26, 0xbe, 0x9a, 0x87,
+  0xd2, 0xf3, 0x31, 0x62, 0x90, 0xa3, 0x8f, 0x6a, 0xfd, 0x41, 0x13, 0x09, 0xaf, 0x7c, 0xe9, 0x1f,
+  0xd7, 0x92, 0xf9, 0x25, 0x10, 0xfb, 0x4b, 0x71, 0xb3, 0x8d, 0x77, 0x68, 0x4b, 0x91, 0x7c, 0xd9,
+  0xad, 0xd7, 0xf8, 0x45, 0x44, 0x91, 0x47, 0x54, 0xe6, 0x96, 0xe0, 0xf4, 0x9e, 0x40, 0x1d, 0x26,
+  0x96, 0xbc, 0x35, 0x8a, 0x55, 0xc7, 0xe3, 0xb1, 0xf8, 0xc0, 0x57, 0xa8, 0xd3, 0x37, 0x9e, 0x4b,
+  0xae, 0x4c, 0x53, 0xe6, 0x8a, 0x5a, 0x1f, 0x31, 0x1b, 0xef, 0xc0, 0x79, 0x47, 0x9f, 0xc2, 0xee,
+  0x7b, 0xd3, 0xf5, 0xb6, 0xbc, 0x3c, 0xef, 0x18, 0x7b, 0xec, 0x63, 0x95, 0x16, 0x4a, 0x9c, 0x6b,
+  0x59, 0x26, 0xab, 0x7c, 0xa4, 0x05, 0x00, 0xd6, 0x78, 0xab, 0xe4, 0xae, 0x88, 0x3a, 0x0c, 0x5b,
+  0x1c, 0x11, 0xdf, 0x6c, 0xca, 0x77, 0x4b, 0xc0, 0x4c, 0x46, 0x6b, 0xda, 0x05, 0xfe, 0x07, 0x29,
+  0xf4, 0x83, 0x8d, 0xf6, 0x01, 0x00, 0x00,
+};
+
+// mqtt.js: 1762 bytes, 798 gzipped
+static const uint8_t WEB_ASSET_MQTT_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x55, 0x4d, 0x4f, 0xdb, 0x40,
+  0x10, 0xbd, 0xfb, 0x57, 0x4c, 0x2f, 0x59, 0x5b, 0xa1, 0x4e, 0xda, 0xaa, 0x17, 0xa2, 0x80, 0x5a,
+  0x14, 0xb5, 0x48, 0x14, 0x90, 0xe0, 0x54, 0x55, 0x42, 0x5b, 0x7b, 0x62, 0xbb, 0xac, 0x77, 0xd3,
+  0xf5, 0x86, 0x10, 0x55, 0xfc, 0xf7, 0xbe, 0x5d, 0xdb, 0xf9, 0x80, 0x42, 0x39, 0xe4, 0xe0, 0xf9,
+  0x7c, 0xf3, 0xe6, 0xcd, 0x66, 0x34, 0xa2, 0x4b, 0x59, 0x70, 0x43, 0xae, 0xb4, 0x66, 0x59, 0x94,
+  0x34, 0xaa, 0x7f, 0x3b, 0x37, 0x2a, 0xab, 0xc6, 0x19, 0xbb, 0x4e, 0x7f, 0x35, 0x46, 0xd3, 0xaa,
+  0x72, 0x25, 0x49, 0xca, 0x96, 0xb6, 0x31, 0xf6, 0x00, 0x91, 0xac, 0xe9, 0x96, 0x79, 0xd1, 0xd0,
+  0xc2, 0x28, 0x55, 0xe9, 0x82, 0xe6, 0xc6, 0x92, 0xe6, 0x55, 0x34, 0x1a, 0x11, 0x6b, 0x67, 0x2b,
+  0x6e, 0x52, 0xba, 0x2e, 0x99, 0x72, 0xbe, 0xab, 0x32, 0x26, 0xa3, 0xd5, 0x9a, 0xf8, 0x8e, 0x2d,
+  0x95, 0x46, 0xe5, 0x0d, 0xbe, 0x99, 0x16, 0xe8, 0x4a, 0x66, 0x4e, 0x66, 0xe9, 0x16, 0x4b, 0x47,
+  0x95, 0xa6, 0x9a, 0x6b, 0xdf, 0x32, 0xca, 0x8c, 0x6e, 0x1c, 0x5d, 0x7e, 0xfa, 0x32, 0xbb, 0xb9,
+  0x3a, 0xfd, 0x3e, 0xa3, 0x29, 0xbd, 0xff, 0x38, 0xe9, 0xad, 0x17, 0x67, 0x67, 0x37, 0xdf, 0xae,
+  0x60, 0xfb, 0x30, 0x1e, 0x8f, 0x27, 0x51, 0xa4, 0xd8, 0x75, 0xc0, 0x60, 0x83, 0xc1, 0x7f, 0x37,
+  0xa5, 0x59, 0xe9, 0xed, 0x67, 0xc1, 0x9a, 0xad, 0x74, 0x95, 0xe9, 0x6c, 0xd1, 0x7c, 0xa9, 0xb3,
+  0xf0, 0x29, 0x17, 0x0b, 0xd6, 0xf9, 0x0c, 0x88, 0xd7, 0xb1, 0x32, 0xc5, 0x41, 0x00, 0xbf, 0x4e,
+  0xe8, 0x4f, 0x44, 0xe4, 0x33, 0x31, 0x1b, 0x23, 0x27, 0x37, 0xd9, 0xb2, 0x86, 0x2b, 0xcd, 0x2c,
+  0x4b, 0xc7, 0x33, 0xc5, 0xfe, 0x2b, 0x16, 0xcd, 0x42, 0x6a, 0x91, 0x4c, 0x10, 0x5c, 0xcd, 0x29,
+  0x0e, 0xb9, 0x69, 0xa9, 0x92, 0x90, 0x96, 0x66, 0x4a, 0x36, 0xcd, 0xb9, 0xac, 0x7d, 0x01, 0x51,
+  0x56, 0x45, 0xa9, 0xf0, 0x73, 0xc2, 0x47, 0x07, 0xbf, 0xe3, 0x7b, 0x77, 0x62, 0xb4, 0x43, 0x1a,
+  0x22, 0xda, 0xe4, 0xba, 0x29, 0x68, 0x48, 0xe2, 0x87, 0x6e, 0xc3, 0x4c, 0x91, 0xb6, 0x08, 0x4f,
+  0xca, 0x4a, 0xe5, 0xb1, 0x4f, 0x0b, 0xdd, 0xc2, 0x7c, 0xc3, 0xe1, 0x24, 0x7a, 0x88, 0x22, 0xd9,
+  0xac, 0x75, 0x46, 0x9b, 0x89, 0xe6, 0xec, 0xb2, 0xd2, 0x2f, 0x34, 0xc6, 0xd4, 0xed, 0x20, 0x2d,
+  0x71, 0xa5, 0xba, 0xf0, 0x4b, 0xd8, 0x19, 0xa6, 0x60, 0xd7, 0x4d, 0xf2, 0x79, 0x7d, 0x9a, 0xc7,
+  0x5b, 0x8c, 0x6f, 0xfd, 0xba, 0x44, 0x92, 0x66, 0x25, 0x67, 0xb7, 0x9c, 0xd3, 0x31, 0x89, 0xc1,
+  0xc6, 0x79, 0xe3, 0x9d, 0xd3, 0x77, 0x82, 0x0e, 0x49, 0x04, 0x94, 0x6d, 0x79, 0x0b, 0x05, 0x4d,
+  0x49, 0xae, 0x64, 0xe5, 0x5a, 0x0c, 0xb1, 0x78, 0x2a, 0xa4, 0x63, 0x39, 0x77, 0x6c, 0xa7, 0x02,
+  0x33, 0x76, 0x2b, 0xc3, 0xb0, 0x03, 0x55, 0xd5, 0x95, 0x0b, 0xc6, 0xed, 0xca, 0x87, 0x1d, 0xde,
+  0x64, 0xdb, 0x21, 0xe8, 0xa5, 0x6f, 0x81, 0x76, 0xa1, 0x62, 0xbc, 0x61, 0x1f, 0xe3, 0xd2, 0x9b,
+  0xe9, 0x74, 0x67, 0xd9, 0x09, 0xa2, 0xdc, 0xd2, 0x82, 0x13, 0xa9, 0x1a, 0xc6, 0xda, 0xfb, 0x4a,
+  0xe0, 0xf5, 0x25, 0x1e, 0xe0, 0xde, 0x2e, 0xb5, 0x93, 0x12, 0x0a, 0x8f, 0x93, 0xb0, 0x90, 0xfd,
+  0xb5, 0x79, 0x50, 0x69, 0xaf, 0x78, 0xc5, 0xba, 0xc0, 0xa1, 0x80, 0xae, 0xc0, 0xce, 0xb9, 0xa1,
+  0x5c, 0x3a, 0x09, 0x14, 0x19, 0x57, 0x77, 0xe0, 0x71, 0xcd, 0x2e, 0x15, 0x7d, 0xe1, 0x90, 0x59,
+  0xc8, 0x05, 0x0d, 0x06, 0x9d, 0x5e, 0x8f, 0x7c, 0x0b, 0xbf, 0xb0, 0x56, 0x7b, 0xde, 0xf7, 0x1a,
+  0xe9, 0x91, 0x8f, 0xdc, 0x57, 0x1b, 0x0c, 0x62, 0xeb, 0xda, 0x47, 0x2c, 0xd2, 0x34, 0x25, 0x1c,
+  0x21, 0x6e, 0xb1, 0xc3, 0x4d, 0x2b, 0xb6, 0xb8, 0x54, 0x6b, 0x20, 0xb5, 0x9c, 0x7e, 0x32, 0x6e,
+  0x99, 0xfd, 0x8d, 0xaf, 0x41, 0xd7, 0x52, 0x79, 0x0b, 0x06, 0x97, 0x39, 0x7c, 0x48, 0xed, 0xa4,
+  0xf9, 0x54, 0x9c, 0xe8, 0x14, 0xe0, 0x3c, 0xe0, 0xb7, 0xc7, 0x0a, 0xca, 0xcd, 0x24, 0xf4, 0x10,
+  0x14, 0x4e, 0xd3, 0xa3, 0xe7, 0x8e, 0x2e, 0x69, 0x37, 0xd4, 0x9f, 0x72, 0xa8, 0xa1, 0x01, 0xdd,
+  0x17, 0x7d, 0x76, 0x57, 0x81, 0x39, 0x48, 0xb5, 0xd2, 0xd8, 0xfa, 0x35, 0xa2, 0x91, 0x19, 0x6c,
+  0x2f, 0x66, 0xd5, 0xf2, 0xfe, 0x51, 0x4e, 0xe8, 0x06, 0xb3, 0x4f, 0xeb, 0x54, 0xd3, 0x9a, 0xc0,
+  0xc5, 0xbf, 0xce, 0xcc, 0x13, 0xb2, 0xbd, 0x30, 0x3f, 0x58, 0xbb, 0xb8, 0x15, 0xb8, 0x60, 0x8a,
+  0x77, 0xee, 0x60, 0x73, 0x8b, 0x08, 0xf5, 0xdc, 0x3c, 0x50, 0x26, 0x61, 0xc6, 0x73, 0xd1, 0x2f,
+  0xdb, 0x8b, 0xd2, 0x28, 0x10, 0x66, 0xad, 0xb1, 0xb1, 0xf8, 0xda, 0x1e, 0x4c, 0x9b, 0x0d, 0xed,
+  0xa2, 0x60, 0x7e, 0x28, 0xc0, 0xd2, 0x86, 0xde, 0x5e, 0xee, 0xd3, 0x47, 0x72, 0x6f, 0xd8, 0x5d,
+  0x57, 0x35, 0xe3, 0x41, 0x8d, 0xe3, 0xc4, 0x33, 0xbd, 0x41, 0x79, 0xd0, 0xbf, 0x9b, 0x49, 0x18,
+  0x66, 0x33, 0x06, 0xce, 0xc8, 0x49, 0xeb, 0xe2, 0x16, 0xca, 0xb6, 0x96, 0x7f, 0x5b, 0x68, 0xef,
+  0x59, 0xa5, 0xdd, 0x47, 0x95, 0xfe, 0x73, 0x3c, 0x8f, 0x25, 0x77, 0x06, 0x1c, 0xf8, 0x97, 0x80,
+  0x7c, 0xba, 0x77, 0xad, 0x85, 0xd5, 0x03, 0x0f, 0x98, 0x5e, 0xff, 0x2c, 0xc9, 0x3c, 0x9f, 0xdd,
+  0xc1, 0x7d, 0x06, 0xa2, 0x7c, 0x91, 0x58, 0x64, 0xa5, 0xd4, 0x05, 0x83, 0xa3, 0x6e, 0x1e, 0x54,
+  0xdc, 0x4c, 0x36, 0x89, 0xfe, 0x02, 0xfd, 0x17, 0xc8, 0xdc, 0xe2, 0x06, 0x00, 0x00,
+};
+
+#if ENABLE_PROFILER
+// profile.css: 358 bytes, 242 gzipped
+static const uint8_t WEB_ASSET_PROFILE_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x55, 0x8f, 0xdd, 0x6a, 0xc3, 0x30,
+  0x0c, 0x85, 0xef, 0xf7, 0x14, 0x86, 0xb0, 0xbb, 0x79, 0xb8, 0x34, 0x65, 0x9d, 0xfd, 0x34, 0xf2,
+  0x4f, 0x12, 0x33, 0xd9, 0x0a, 0xb6, 0x4a, 0x53, 0xc2, 0xde, 0x7d, 0x5e, 0x5b, 0xc3, 0x86, 0x6e,
+  0xa4, 0x73, 0xa4, 0x8f, 0x23, 0x4b, 0xfe, 0xb6, 0x4f, 0x94, 0x59, 0x4e, 0x90, 0x22, 0xde, 0x74,
+  0xa2, 0x4c, 0x75, 0x05, 0x17, 0x8c, 0x05, 0xf7, 0x35, 0x17, 0xba, 0x64, 0xaf, 0x87, 0x03, 0xb4,
+  0xb2, 0xc6, 0x11, 0x52, 0xd1, 0x43, 0x50, 0xbf, 0x65, 0x12, 0x6c, 0xf2, 0x1a, 0x3d, 0x2f, 0x5a,
+  0x7c, 0x2a, 0xb5, 0x6e, 0x46, 0x24, 0x28, 0x73, 0xcc, 0x5a, 0x28, 0x01, 0x17, 0x26, 0x23, 0x56,
+  0xf0, 0x3e, 0xe6, 0x59, 0x8b, 0x43, 0x09, 0xc9, 0x7c, 0xbf, 0xc0, 0xfe, 0x24, 0x1c, 0x3f, 0xce,
+  0x6e, 0x52, 0x4d, 0x61, 0xb0, 0x18, 0x76, 0x4b, 0xc5, 0x87, 0x22, 0x9b, 0x89, 0xb0, 0xd6, 0xa0,
+  0x7b, 0x63, 0x1e, 0xf8, 0x83, 0x52, 0xaf, 0xe6, 0xc1, 0x96, 0x96, 0x98, 0x29, 0xe9, 0x27, 0x90,
+  0x97, 0x37, 0xf6, 0xfd, 0xbc, 0x5b, 0xeb, 0x26, 0x2a, 0x61, 0xf4, 0x62, 0x18, 0xc7, 0xd1, 0xf4,
+  0x0c, 0x63, 0x93, 0xcf, 0x2d, 0x24, 0x87, 0x8d, 0x25, 0x60, 0x9c, 0xb3, 0x2e, 0x71, 0x5e, 0xf8,
+  0x4e, 0xd1, 0x53, 0x2c, 0x95, 0xa5, 0x5b, 0x22, 0xfa, 0x46, 0xfc, 0x37, 0x0e, 0x95, 0x01, 0xb1,
+  0x8a, 0x26, 0x23, 0x74, 0x75, 0xff, 0x83, 0xc1, 0x30, 0xdd, 0x29, 0xe5, 0xbd, 0x22, 0x5d, 0xdb,
+  0x5e, 0xff, 0xd2, 0xbb, 0xe3, 0x69, 0x3c, 0x35, 0xeb, 0x07, 0x00, 0x83, 0xc4, 0xde, 0x66, 0x01,
+  0x00, 0x00,
+};
+#endif
+
+#if ENABLE_PROFILER
+// profile.js: 1369 bytes, 590 gzipped
+static const uint8_t WEB_ASSET_PROFILE_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x54, 0x4d, 0x6f, 0x1a, 0x31,
+  0x10, 0xbd, 0xf3, 0x2b, 0xa6, 0xea, 0xc1, 0xb6, 0x4a, 0x9c, 0xd0, 0x5b, 0xba, 0x6a, 0x0e, 0xad,
+  0x52, 0x35, 0x52, 0xbf, 0xa4, 0xe4, 0x86, 0x10, 0x32, 0xeb, 0x59, 0x58, 0x64, 0x6c, 0x6a, 0x1b,
+  0x42, 0x14, 0xe5, 0xbf, 0x77, 0x6c, 0x6f, 0x16, 0x50, 0x1b, 0x5a, 0xf5, 0x82, 0x77, 0xe7, 0xe3,
+  0xbd, 0x37, 0x6f, 0xbc, 0x34, 0x1b, 0x5b, 0xc7, 0xd6, 0x59, 0xa8, 0xd1, 0x18, 0xee, 0xdd, 0xfd,
+  0x10, 0x22, 0xee, 0xa2, 0x80, 0xc7, 0x01, 0x40, 0xed, 0x6c, 0x88, 0x10, 0x35, 0xbc, 0x07, 0xed,
+  0xea, 0xcd, 0x0a, 0x6d, 0x94, 0xb5, 0x47, 0x15, 0xf1, 0xda, 0x60, 0x7a, 0xe3, 0x2c, 0x6a, 0x26,
+  0x2a, 0x2a, 0x8d, 0x5a, 0xb6, 0xd6, 0xa2, 0xbf, 0xa3, 0x66, 0x2a, 0x4f, 0x18, 0x29, 0x4c, 0x80,
+  0x52, 0xad, 0xd7, 0x68, 0xf5, 0xc7, 0x45, 0x6b, 0x34, 0x8f, 0x9a, 0xaa, 0x9f, 0x06, 0x83, 0xe6,
+  0x99, 0xd6, 0x53, 0x0a, 0x3d, 0xd7, 0x2a, 0xaa, 0xc2, 0xd9, 0x13, 0xcd, 0x31, 0x76, 0x2c, 0x1f,
+  0x1e, 0x6e, 0x34, 0x67, 0xf7, 0xad, 0xd5, 0xee, 0x9e, 0x89, 0x23, 0x9e, 0xd4, 0x27, 0x4b, 0xa6,
+  0x3a, 0xd5, 0x1c, 0xa2, 0x32, 0xe6, 0x2c, 0x2e, 0x3c, 0x86, 0x85, 0x33, 0xfa, 0x4f, 0x28, 0xb9,
+  0x64, 0xda, 0x97, 0x4c, 0x37, 0xe1, 0x5f, 0x10, 0x1d, 0x1d, 0x27, 0xd0, 0x52, 0xba, 0x1a, 0xf4,
+  0x56, 0x52, 0x74, 0x8e, 0xe1, 0xd0, 0xce, 0x9f, 0x1b, 0xf4, 0x0f, 0xb7, 0x68, 0xb0, 0x8e, 0xce,
+  0x73, 0xf6, 0xba, 0xab, 0x88, 0x33, 0xa7, 0x1f, 0x8a, 0xb3, 0x25, 0x52, 0x18, 0x3e, 0xdf, 0x7d,
+  0xfd, 0x42, 0xdd, 0x8c, 0x65, 0x69, 0x1d, 0x4f, 0xca, 0x36, 0xce, 0x5f, 0xab, 0x7a, 0xc1, 0x09,
+  0xfb, 0x2a, 0xdb, 0xf8, 0xcc, 0x48, 0x0b, 0x38, 0xb5, 0x3d, 0x5f, 0x38, 0x00, 0xda, 0x06, 0x78,
+  0x90, 0xeb, 0xcb, 0x4b, 0xb8, 0x7a, 0xd1, 0x0f, 0x91, 0xd7, 0x59, 0x1b, 0x15, 0xc2, 0x37, 0xb5,
+  0xc2, 0x24, 0x24, 0x18, 0x5a, 0x49, 0x41, 0x18, 0x07, 0x69, 0x29, 0x3a, 0x84, 0x20, 0x6b, 0xb7,
+  0xb1, 0x31, 0x3d, 0xac, 0x5a, 0x9b, 0x0e, 0xb5, 0x9d, 0xa7, 0x83, 0xd0, 0x73, 0x50, 0xed, 0xba,
+  0x63, 0x8a, 0x5b, 0xf4, 0x93, 0x5e, 0xfc, 0x36, 0x89, 0xdf, 0xdf, 0xc3, 0xad, 0xe8, 0xb4, 0x75,
+  0x33, 0x1e, 0xde, 0x23, 0x2a, 0xc8, 0xc9, 0x27, 0x71, 0xec, 0xae, 0x31, 0x7f, 0x73, 0x37, 0x55,
+  0x1c, 0xbb, 0x4b, 0x91, 0x13, 0xee, 0xa6, 0x6c, 0xef, 0x6e, 0xfc, 0x5f, 0x7b, 0xf7, 0x53, 0x11,
+  0x88, 0xa4, 0x71, 0xa6, 0xab, 0x00, 0xe7, 0x30, 0xba, 0xb8, 0xb8, 0x10, 0x32, 0xba, 0x4f, 0xed,
+  0x0e, 0x35, 0x1f, 0x09, 0x78, 0x03, 0x0c, 0xc2, 0xef, 0x4d, 0xd4, 0x93, 0xaf, 0x52, 0x5a, 0x42,
+  0x75, 0x40, 0xbf, 0x56, 0x3e, 0xa6, 0x81, 0xbf, 0xcf, 0x96, 0x34, 0xa2, 0x24, 0x52, 0xdf, 0x62,
+  0x48, 0x14, 0xc5, 0x33, 0x91, 0x6b, 0x01, 0x64, 0x70, 0x3e, 0x72, 0xae, 0x86, 0x30, 0x13, 0x69,
+  0x84, 0xd9, 0x78, 0x34, 0x81, 0x33, 0x50, 0x74, 0xf4, 0x25, 0x2b, 0xb5, 0xe6, 0x7c, 0x5c, 0x56,
+  0xb8, 0x09, 0x93, 0x5c, 0x97, 0xde, 0xb2, 0x26, 0x46, 0xbf, 0x7b, 0xee, 0x5e, 0x57, 0xe6, 0x97,
+  0x4b, 0xd7, 0x5a, 0xce, 0x86, 0xc0, 0x0e, 0x16, 0x96, 0x6c, 0x7b, 0x69, 0x61, 0xc7, 0xdf, 0x7f,
+  0x93, 0x2e, 0x18, 0x2f, 0x1f, 0x7f, 0x83, 0x91, 0x6c, 0x66, 0xe7, 0x6b, 0xef, 0x9a, 0xd6, 0xa0,
+  0x5c, 0x06, 0x67, 0x59, 0x51, 0x28, 0xe3, 0x02, 0x2d, 0xf7, 0x49, 0x95, 0xcf, 0x71, 0x2e, 0x8e,
+  0x12, 0xf9, 0x7f, 0xa4, 0x8b, 0xd4, 0x2a, 0xc1, 0x60, 0xbe, 0x4e, 0xe4, 0x93, 0x23, 0x24, 0xf4,
+  0x3e, 0xdd, 0x80, 0x1f, 0x05, 0xb8, 0x10, 0x41, 0xa3, 0xe8, 0x59, 0xbf, 0x23, 0xe9, 0x28, 0x8a,
+  0xae, 0x5e, 0x4e, 0x35, 0x08, 0x18, 0x6f, 0x6c, 0x44, 0xbf, 0x55, 0x86, 0xf3, 0xec, 0xc6, 0x63,
+  0xfe, 0x4a, 0x5e, 0xf5, 0xdb, 0x5e, 0xb4, 0x5a, 0xa3, 0x15, 0xfb, 0x19, 0x2a, 0x78, 0x1a, 0xc2,
+  0xdb, 0xb4, 0xd3, 0x6a, 0xf0, 0x0b, 0x87, 0xf7, 0x4e, 0xe3, 0x59, 0x05, 0x00, 0x00,
+};
+#endif
+
+// status.html: 5143 bytes, 1681 gzipped
+static const uint8_t WEB_ASSET_STATUS_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x58, 0x59, 0x6f, 0xe3, 0x36,
+  0x10, 0x7e, 0xdf, 0x5f, 0xc1, 0x2a, 0xc8, 0x7a, 0x83, 0xae, 0x64, 0x49, 0x3e, 0xe3, 0x0b, 0xd8,
+  0x38, 0x49, 0x53, 0x20, 0x57, 0x1b, 0x6f, 0x8a, 0x3e, 0x05, 0xb4, 0x44, 0x4b, 0xec, 0xea, 0x2a,
+  0x45, 0xd9, 0x4e, 0xd0, 0x1f, 0xdf, 0x21, 0x29, 0xc9, 0x96, 0x23, 0xe7, 0xd8, 0xb6, 0x6f, 0x45,
+  0x0e, 0x51, 0xe4, 0x5c, 0x9c, 0xf9, 0x38, 0x33, 0xd4, 0xe8, 0x87, 0xd3, 0x9b, 0xe9, 0xec, 0xf7,
+  0xdb, 0x33, 0xe4, 0xf3, 0x30, 0x98, 0x7c, 0x18, 0x15, 0x0f, 0x82, 0xdd, 0xc9, 0x07, 0x84, 0x46,
+  0x21, 0xe1, 0x18, 0x39, 0x3e, 0x66, 0x29, 0xe1, 0x63, 0xed, 0xeb, 0xec, 0x5c, 0xef, 0x6b, 0x9b,
+  0x85, 0x08, 0x87, 0x64, 0xac, 0x2d, 0x29, 0x59, 0x25, 0x31, 0xe3, 0x1a, 0x72, 0xe2, 0x88, 0x93,
+  0x08, 0x08, 0x57, 0xd4, 0xe5, 0xfe, 0xd8, 0x25, 0x4b, 0xea, 0x10, 0x5d, 0xbe, 0x7c, 0x46, 0x34,
+  0xa2, 0x9c, 0xe2, 0x40, 0x4f, 0x1d, 0x1c, 0x90, 0xb1, 0xa5, 0xc4, 0x70, 0xca, 0x03, 0x32, 0x39,
+  0xc1, 0xe1, 0x3c, 0x43, 0x97, 0xd4, 0xf3, 0x39, 0xba, 0xe3, 0x98, 0x67, 0xe9, 0xa8, 0xa9, 0x56,
+  0x04, 0x4d, 0x40, 0xa3, 0x6f, 0x88, 0x91, 0x60, 0xac, 0x51, 0x50, 0xa0, 0x21, 0x9f, 0x91, 0xc5,
+  0x58, 0x73, 0x31, 0xc7, 0x03, 0x1a, 0x62, 0x8f, 0x34, 0xd3, 0xa5, 0xf7, 0xe3, 0x3a, 0x0c, 0x3e,
+  0x1f, 0xb6, 0xa6, 0x30, 0x44, 0x30, 0x8c, 0xd2, 0x71, 0xc3, 0xe7, 0x3c, 0x19, 0x34, 0x9b, 0xab,
+  0xd5, 0xca, 0x58, 0xb5, 0x8c, 0x98, 0x79, 0x4d, 0xdb, 0x34, 0x4d, 0x41, 0xdc, 0x40, 0xc2, 0xe4,
+  0x93, 0x78, 0x3d, 0x6e, 0x98, 0xc8, 0x44, 0x96, 0x29, 0xff, 0x1a, 0x87, 0xad, 0x33, 0x90, 0x90,
+  0x60, 0xee, 0xa3, 0x05, 0x0d, 0x82, 0x71, 0xe3, 0xd0, 0x6e, 0xb5, 0x7a, 0x7d, 0x67, 0x61, 0x36,
+  0x90, 0x3b, 0x6e, 0x5c, 0x75, 0x80, 0x78, 0x6a, 0xf7, 0x8c, 0x63, 0xc9, 0x83, 0x2c, 0x31, 0x82,
+  0x67, 0xdb, 0x74, 0xe0, 0xa5, 0x0d, 0x2f, 0x7d, 0xc3, 0x46, 0xb0, 0xde, 0x47, 0xb6, 0x89, 0x5a,
+  0x6d, 0xa3, 0x7f, 0xdf, 0xef, 0xc0, 0x92, 0x2d, 0x26, 0x60, 0xa5, 0x23, 0x7e, 0xfc, 0x96, 0xe9,
+  0x88, 0x09, 0x13, 0x75, 0x74, 0x39, 0xa9, 0x77, 0x96, 0xba, 0x65, 0x1a, 0xb6, 0x63, 0x59, 0x46,
+  0x5f, 0xef, 0x01, 0xab, 0x6e, 0x1d, 0x83, 0x2c, 0x78, 0x0a, 0x11, 0xd3, 0xe3, 0x5c, 0x51, 0xcf,
+  0x36, 0x2c, 0xc1, 0x05, 0x36, 0x3c, 0x09, 0x4b, 0x7a, 0x1d, 0x5f, 0x37, 0x0d, 0xeb, 0xbe, 0x0b,
+  0xfa, 0x1c, 0xdd, 0x32, 0xba, 0x08, 0xde, 0xf4, 0x16, 0x88, 0x04, 0x61, 0xba, 0xb0, 0x06, 0x9e,
+  0x29, 0x4c, 0xb4, 0x04, 0x99, 0x98, 0x80, 0xa7, 0x7d, 0xdf, 0xeb, 0x5c, 0xd8, 0x9d, 0xfb, 0xae,
+  0x6d, 0xb4, 0x1d, 0xfd, 0x18, 0xe6, 0x3b, 0x30, 0x6f, 0x75, 0x74, 0xab, 0x0b, 0x63, 0x78, 0x82,
+  0xf5, 0xed, 0xa9, 0xda, 0x5b, 0x5f, 0x6d, 0x45, 0xa9, 0x4c, 0xdb, 0xf9, 0x5c, 0xbb, 0xd8, 0xaf,
+  0x05, 0x82, 0x3b, 0xc2, 0x4e, 0xcb, 0x00, 0xf6, 0x8e, 0x20, 0x6e, 0xdf, 0x0b, 0xa3, 0xac, 0xce,
+  0xfb, 0x6d, 0x7a, 0x6a, 0x34, 0x95, 0xf3, 0x45, 0x74, 0x60, 0xa4, 0xed, 0xc4, 0x3d, 0xe5, 0x8f,
+  0x01, 0x49, 0x7d, 0x42, 0x78, 0x11, 0xfd, 0x66, 0x0a, 0x30, 0xa1, 0x8e, 0x7c, 0x64, 0xa9, 0xd1,
+  0xb5, 0xba, 0x8e, 0xd9, 0xb3, 0xb1, 0xe1, 0xa4, 0x29, 0x30, 0x8f, 0x9a, 0x0a, 0xc0, 0xa3, 0x79,
+  0xec, 0x3e, 0x4a, 0x59, 0x2e, 0x5d, 0x22, 0x27, 0xc0, 0x69, 0x3a, 0xd6, 0x82, 0xd8, 0x8b, 0x1f,
+  0x24, 0xba, 0x1e, 0x56, 0x0c, 0x27, 0x09, 0x61, 0x52, 0x1d, 0x10, 0x09, 0xf0, 0x6c, 0x11, 0x69,
+  0x39, 0x92, 0xb4, 0xfd, 0x48, 0xd2, 0x4a, 0x24, 0x69, 0x5b, 0x48, 0xd2, 0x14, 0x7e, 0xb4, 0x03,
+  0x85, 0x1e, 0x0d, 0xa9, 0xe3, 0xa0, 0x75, 0x60, 0xe8, 0x13, 0x81, 0x72, 0x39, 0x56, 0x5a, 0x41,
+  0xaf, 0x84, 0x9c, 0x3b, 0xd6, 0xfe, 0x47, 0xd8, 0x7f, 0x87, 0x30, 0xad, 0x99, 0x07, 0x59, 0x84,
+  0x2d, 0x1f, 0xfa, 0x56, 0x25, 0xf3, 0x4c, 0x21, 0x7b, 0xb1, 0x38, 0x08, 0x08, 0x03, 0xfc, 0x58,
+  0x12, 0x36, 0x4d, 0xc0, 0xcd, 0xe4, 0xc3, 0x0e, 0x80, 0x14, 0xe6, 0x1e, 0x3c, 0x46, 0xdd, 0x02,
+  0x39, 0x62, 0x95, 0xba, 0x22, 0xef, 0x2d, 0xa8, 0xae, 0xd6, 0x75, 0x98, 0xd3, 0xaa, 0x2c, 0x22,
+  0x3f, 0x46, 0xc4, 0xe1, 0xc4, 0xdd, 0xc4, 0x3e, 0x05, 0x95, 0x91, 0x37, 0xf9, 0x8d, 0x9e, 0xd3,
+  0x32, 0xf5, 0xe5, 0x73, 0x25, 0x49, 0x82, 0xa3, 0x5d, 0xe9, 0xa5, 0x64, 0x91, 0x06, 0xb5, 0xc9,
+  0xf4, 0xe6, 0xfa, 0xfa, 0x6c, 0x3a, 0x3b, 0x3b, 0x05, 0x66, 0xa0, 0x2e, 0xb6, 0x2a, 0xad, 0x17,
+  0xc3, 0xaa, 0x95, 0xe1, 0x9f, 0x9c, 0xbf, 0x60, 0xa5, 0x4b, 0xd3, 0xfd, 0x86, 0x5e, 0xfd, 0x32,
+  0x9b, 0xbd, 0x6a, 0xe8, 0x96, 0x82, 0x1d, 0x43, 0x4f, 0x7f, 0xbe, 0xab, 0xb5, 0x15, 0xb8, 0xe7,
+  0x6c, 0x32, 0x4a, 0x43, 0x1c, 0x04, 0x93, 0x11, 0x2e, 0x4e, 0xb9, 0x10, 0xa4, 0x21, 0x8e, 0x99,
+  0x27, 0xca, 0xcf, 0xc3, 0x3c, 0xc0, 0xd1, 0x37, 0x0d, 0xc9, 0x74, 0x30, 0xd6, 0x9c, 0x38, 0x88,
+  0xd9, 0x00, 0x2d, 0x31, 0xfb, 0xa4, 0xeb, 0x9c, 0xac, 0xb9, 0x2e, 0x67, 0xf4, 0x39, 0x13, 0xe1,
+  0x3c, 0x1a, 0x6a, 0x93, 0x7b, 0x38, 0x9c, 0x48, 0x5a, 0x7c, 0x41, 0x53, 0x1e, 0xb3, 0xc7, 0x51,
+  0x13, 0x4f, 0x40, 0xad, 0xd4, 0x52, 0xf5, 0xd1, 0x56, 0xa8, 0x7d, 0x7b, 0x72, 0xcb, 0x28, 0x54,
+  0x32, 0x56, 0x6e, 0x14, 0xa6, 0xde, 0x06, 0x82, 0xca, 0xaa, 0x36, 0x29, 0xbc, 0xf6, 0xd3, 0xf4,
+  0xe6, 0xf4, 0x4c, 0x4a, 0x23, 0xa5, 0xd7, 0x36, 0xee, 0xf2, 0x9c, 0xd8, 0x25, 0xd2, 0x5f, 0x64,
+  0xc7, 0x5d, 0xd7, 0xcd, 0x2f, 0xb9, 0x97, 0xb6, 0x82, 0xf9, 0x92, 0x22, 0x69, 0x38, 0xba, 0x65,
+  0xb1, 0xc7, 0x48, 0x9a, 0xd6, 0xe8, 0x4a, 0x04, 0x81, 0x0e, 0x49, 0xcf, 0x81, 0x42, 0xbd, 0xa3,
+  0xcd, 0x44, 0x87, 0xef, 0xd3, 0x36, 0xcd, 0x18, 0x03, 0x31, 0xe8, 0x12, 0x3f, 0x8a, 0x43, 0xf3,
+  0x4c, 0x59, 0x20, 0xe6, 0xf5, 0x28, 0x0b, 0x77, 0x15, 0xbd, 0x4f, 0xcd, 0x8c, 0x86, 0x04, 0xfd,
+  0x4a, 0x42, 0x0c, 0x2d, 0x44, 0xe4, 0xed, 0xdd, 0x14, 0x07, 0xb2, 0x1d, 0x45, 0xba, 0x3e, 0x90,
+  0xbf, 0xef, 0xd3, 0x77, 0x1d, 0x3f, 0x3d, 0x05, 0x04, 0xcd, 0x48, 0x98, 0xd4, 0x28, 0x8b, 0xe4,
+  0x2a, 0x00, 0x2e, 0x4c, 0x76, 0xb7, 0x65, 0x98, 0xa8, 0x89, 0xc4, 0xff, 0x8f, 0x2e, 0xf1, 0x86,
+  0xd3, 0xf7, 0x69, 0x3d, 0x21, 0xee, 0x3e, 0x95, 0x73, 0xe2, 0xfe, 0xfb, 0xfa, 0x14, 0x54, 0x00,
+  0x93, 0x5e, 0x1d, 0x26, 0x53, 0x31, 0xff, 0x4f, 0xd1, 0xa8, 0xb2, 0x1a, 0xf5, 0x22, 0x1c, 0xd4,
+  0xa8, 0x50, 0xe9, 0x4c, 0xae, 0xbe, 0xae, 0x68, 0x33, 0x28, 0xb2, 0x98, 0x1f, 0xd6, 0x66, 0x2f,
+  0xc2, 0x58, 0xcc, 0xca, 0x1c, 0x01, 0xb9, 0x2c, 0x01, 0x14, 0x0e, 0x50, 0x14, 0x47, 0x64, 0x58,
+  0x16, 0xfa, 0x2d, 0x0f, 0xc0, 0x29, 0xbf, 0x20, 0x38, 0x80, 0x0a, 0xfc, 0xe9, 0xe2, 0xea, 0xee,
+  0xa8, 0x9a, 0xd4, 0x46, 0x59, 0x50, 0xea, 0x0a, 0x20, 0x85, 0x94, 0xca, 0xca, 0x09, 0xb0, 0x30,
+  0x0b, 0xea, 0x0d, 0xc4, 0xb5, 0x06, 0xbe, 0xcd, 0xb4, 0x2f, 0x57, 0x77, 0x3b, 0x96, 0x6c, 0x4b,
+  0xcd, 0xa0, 0x95, 0xde, 0x64, 0xd6, 0xcd, 0xcc, 0x64, 0x4f, 0x3a, 0x13, 0xb0, 0x22, 0x0c, 0xb4,
+  0x33, 0xb2, 0xc9, 0x84, 0xcf, 0x73, 0x9a, 0xe8, 0xf3, 0x21, 0x89, 0x62, 0x56, 0x97, 0xd2, 0xd4,
+  0x22, 0xc3, 0x91, 0x47, 0xd2, 0x4d, 0x55, 0x98, 0x67, 0x9c, 0xc7, 0x51, 0x41, 0x23, 0x57, 0x11,
+  0x76, 0x38, 0x5d, 0x02, 0x76, 0x44, 0x2c, 0x15, 0xc3, 0x58, 0xeb, 0x42, 0x57, 0x34, 0x81, 0xb2,
+  0x1f, 0xd2, 0x68, 0xd4, 0x54, 0x4c, 0x2f, 0xc9, 0xa8, 0x32, 0xdb, 0x96, 0x64, 0xef, 0x22, 0xff,
+  0xfd, 0xbc, 0x5d, 0xb3, 0xdd, 0x17, 0xcc, 0x3d, 0x98, 0x7d, 0x4c, 0xab, 0xfc, 0xdb, 0x28, 0x76,
+  0x70, 0xb4, 0xc4, 0xa9, 0x0a, 0xb6, 0xf2, 0x90, 0x2e, 0x77, 0xbc, 0xe9, 0xd8, 0x6c, 0xdb, 0x14,
+  0x0e, 0x56, 0x84, 0xfb, 0xfc, 0x13, 0x10, 0x8f, 0x44, 0xdb, 0x55, 0x53, 0x80, 0xbd, 0x5a, 0xaf,
+  0x0e, 0x16, 0x8b, 0xbe, 0xd3, 0xb6, 0x21, 0xe2, 0x1f, 0x0f, 0x8e, 0xbb, 0x2d, 0x7b, 0x88, 0x54,
+  0xbe, 0xd9, 0x29, 0x87, 0x75, 0x9c, 0xaa, 0x9f, 0xdc, 0xe2, 0x84, 0x9c, 0x51, 0xc7, 0x96, 0x9b,
+  0x14, 0x66, 0xb2, 0x82, 0x9f, 0x62, 0x68, 0x9d, 0xdd, 0x41, 0x5e, 0x46, 0x3f, 0xa3, 0xd4, 0xc7,
+  0xae, 0x78, 0x87, 0x58, 0x34, 0x43, 0xbc, 0xae, 0x6d, 0x19, 0xaa, 0xf8, 0x39, 0x5b, 0xc3, 0x31,
+  0x81, 0x63, 0x8a, 0x6e, 0x32, 0x9e, 0x64, 0xfc, 0x3d, 0x05, 0x51, 0x96, 0x01, 0xe1, 0xc0, 0xef,
+  0x6d, 0x38, 0x4a, 0xdd, 0xaa, 0x49, 0xfb, 0x74, 0x4b, 0xa3, 0xad, 0x4e, 0x43, 0x89, 0x4e, 0x68,
+  0x04, 0xb9, 0x3e, 0xdf, 0xc8, 0xd1, 0xfe, 0xbe, 0x64, 0xdb, 0x90, 0xbd, 0x29, 0xa7, 0xa6, 0x1f,
+  0x29, 0x7a, 0x1f, 0x28, 0xd3, 0x83, 0x52, 0xfa, 0x33, 0xb9, 0x21, 0x2c, 0xbf, 0x26, 0xf5, 0xaf,
+  0x72, 0x5f, 0x97, 0xb1, 0x47, 0x9d, 0x17, 0xa4, 0x05, 0x62, 0x7d, 0xb3, 0xab, 0x67, 0xfc, 0xb2,
+  0x73, 0xad, 0xe5, 0x9f, 0x8b, 0x15, 0xfd, 0x0d, 0x36, 0xd5, 0x75, 0x42, 0x3b, 0x91, 0x83, 0xc2,
+  0xf3, 0x9d, 0x71, 0xbb, 0x3c, 0x3b, 0xcd, 0xdb, 0x27, 0x74, 0x82, 0xd9, 0xb3, 0xb8, 0x81, 0xe0,
+  0x4a, 0xd4, 0xa0, 0x90, 0x55, 0x57, 0x9d, 0x38, 0x83, 0x06, 0xa5, 0x6c, 0x15, 0x10, 0xc8, 0x4b,
+  0x5f, 0x0a, 0x6d, 0x69, 0xe9, 0xab, 0x81, 0xcd, 0x37, 0xd7, 0x58, 0x52, 0xc6, 0x33, 0x1c, 0xe8,
+  0x73, 0xcc, 0x74, 0xf1, 0xe5, 0x02, 0xda, 0x0b, 0xc2, 0x1a, 0xf9, 0x99, 0x6b, 0x84, 0x70, 0x5a,
+  0x68, 0xa4, 0xf3, 0x38, 0x19, 0xc0, 0x1d, 0x2c, 0x59, 0x0f, 0x1b, 0x85, 0x80, 0x7a, 0x11, 0x25,
+  0x63, 0x99, 0xd7, 0x17, 0x01, 0x59, 0x0f, 0xd5, 0xdd, 0x4f, 0x88, 0x30, 0x0f, 0x87, 0x79, 0x2e,
+  0x19, 0xc0, 0xdd, 0x0b, 0x04, 0xa2, 0x39, 0x76, 0xbe, 0x79, 0x0c, 0xf6, 0x09, 0x87, 0xf1, 0xc0,
+  0xb6, 0xe1, 0x3c, 0xcf, 0x63, 0xe6, 0x42, 0xc7, 0xc4, 0xb0, 0x4b, 0xb3, 0x74, 0x80, 0x3a, 0x82,
+  0x2a, 0x5e, 0x12, 0xb6, 0x08, 0xe2, 0xd5, 0x00, 0xf9, 0xd4, 0x75, 0x49, 0x54, 0x50, 0x81, 0xcc,
+  0x64, 0x8d, 0xd2, 0x38, 0xa0, 0x2e, 0x3a, 0x68, 0xb7, 0xdb, 0x15, 0x03, 0x37, 0x99, 0xad, 0x9a,
+  0xe6, 0xea, 0xcf, 0xf7, 0x15, 0x8e, 0x60, 0x17, 0xc5, 0x05, 0xa8, 0xee, 0x74, 0xab, 0xb4, 0xa9,
+  0x0b, 0x6b, 0xa1, 0x0b, 0x91, 0x28, 0x53, 0x33, 0x8e, 0xe2, 0x29, 0x4a, 0x42, 0x91, 0x90, 0x25,
+  0x05, 0x8f, 0x72, 0x14, 0xc6, 0x10, 0xe8, 0x59, 0xc6, 0xa2, 0xfc, 0x0c, 0xdf, 0x5c, 0xef, 0xe4,
+  0xe1, 0x7a, 0xa6, 0xc5, 0xa2, 0x0c, 0xa5, 0x18, 0x57, 0x24, 0x9c, 0x9f, 0xbf, 0x45, 0x04, 0xce,
+  0x78, 0xbc, 0x29, 0x93, 0xe2, 0x65, 0x72, 0x47, 0x38, 0xe2, 0x31, 0xfa, 0xf2, 0x75, 0x76, 0xb3,
+  0x2d, 0x61, 0xdb, 0x1f, 0xac, 0x48, 0xbb, 0x85, 0x9f, 0xcd, 0x32, 0x30, 0x0a, 0x0d, 0xa5, 0xdb,
+  0xd5, 0xd5, 0x23, 0x5f, 0x93, 0x49, 0xfa, 0x68, 0x88, 0x14, 0x70, 0x20, 0xc6, 0x8c, 0x84, 0xc8,
+  0x54, 0x85, 0xfd, 0x25, 0x6f, 0xe6, 0x1b, 0x28, 0xef, 0x3c, 0xe0, 0xd1, 0x05, 0xf5, 0xb4, 0x2a,
+  0x2d, 0x5c, 0xf1, 0x7c, 0x59, 0x5c, 0x4f, 0xe5, 0x37, 0x35, 0x04, 0xdb, 0xe0, 0xd0, 0x0b, 0xa7,
+  0xe2, 0x42, 0xb3, 0xdd, 0x7c, 0x88, 0x71, 0xea, 0x30, 0x9a, 0x70, 0x94, 0x32, 0xe7, 0xd9, 0x77,
+  0x92, 0x5e, 0xcb, 0x6e, 0xdb, 0x0b, 0xd3, 0x36, 0xfe, 0x90, 0xcd, 0x82, 0xa2, 0x14, 0xdf, 0x4b,
+  0xd4, 0x87, 0x12, 0x88, 0xbc, 0xfc, 0xfe, 0xf7, 0x37, 0x25, 0x3e, 0xbd, 0xdf, 0x17, 0x14, 0x00,
+  0x00,
+};
+
+// mqtt.html: 567 bytes, 394 gzipped
+static const uint8_t WEB_ASSET_MQTT_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x52, 0x4d, 0x6f, 0xdc, 0x20,
+  0x14, 0xbc, 0xef, 0xaf, 0x78, 0xf5, 0xa1, 0xb4, 0x52, 0x6c, 0xba, 0x6d, 0x9a, 0xb6, 0x2a, 0xe6,
+  0xd0, 0x2f, 0xe5, 0xd0, 0xa8, 0x89, 0xb2, 0x39, 0xf4, 0xc8, 0xc2, 0xf3, 0x42, 0x17, 0x83, 0x03,
+  0x6f, 0xb3, 0xf1, 0xbf, 0x0f, 0xb6, 0x37, 0x6a, 0xd5, 0x03, 0x48, 0x0c, 0xa3, 0x79, 0x33, 0x03,
+  0xe2, 0xc5, 0xb7, 0x5f, 0x5f, 0x37, 0xbf, 0xaf, 0xbf, 0x83, 0xa5, 0xde, 0x4b, 0x71, 0xda, 0x51,
+  0x19, 0x29, 0xc8, 0x91, 0x47, 0x79, 0x75, 0xb3, 0xd9, 0xc0, 0xa5, 0xcb, 0x14, 0xd3, 0x28, 0xf8,
+  0x82, 0xad, 0x44, 0x8f, 0xa4, 0x40, 0x5b, 0x95, 0x32, 0x52, 0x5b, 0xdd, 0x6d, 0x7e, 0xd4, 0x1f,
+  0xab, 0x67, 0x38, 0xa8, 0x1e, 0x5b, 0xf6, 0xe0, 0xf0, 0x38, 0xc4, 0x44, 0x0c, 0x74, 0x0c, 0x84,
+  0x81, 0x5a, 0x76, 0x74, 0x86, 0x6c, 0x6b, 0xf0, 0xc1, 0x69, 0xac, 0xe7, 0xc3, 0x19, 0xb8, 0xe0,
+  0xc8, 0x29, 0x5f, 0x67, 0xad, 0x3c, 0xb6, 0x6b, 0x56, 0x44, 0xbc, 0x0b, 0x7b, 0x48, 0xe8, 0xdb,
+  0x2a, 0xd3, 0xe8, 0x31, 0x5b, 0x44, 0xaa, 0xc0, 0x26, 0xec, 0xda, 0x8a, 0x67, 0x52, 0xe4, 0x34,
+  0xef, 0xef, 0x89, 0x9a, 0xad, 0x59, 0x9f, 0xbf, 0xef, 0xba, 0xb7, 0x8d, 0xce, 0x79, 0x9a, 0xce,
+  0x17, 0xdf, 0xdb, 0x68, 0xc6, 0x92, 0x61, 0xbd, 0x58, 0xbf, 0xc2, 0x9c, 0xd5, 0x0e, 0xff, 0x46,
+  0x28, 0x17, 0x2b, 0x31, 0xc8, 0x5b, 0x1b, 0x8f, 0x2e, 0xec, 0x40, 0xe4, 0x41, 0x05, 0x70, 0xa6,
+  0x65, 0xb9, 0x20, 0x81, 0xc9, 0x37, 0x82, 0x4f, 0x90, 0x84, 0xd8, 0x01, 0x59, 0x04, 0xaf, 0x32,
+  0xfd, 0xc3, 0xea, 0xd5, 0x23, 0x93, 0xf5, 0x33, 0xa7, 0x5f, 0xd4, 0x33, 0xbc, 0x8a, 0xde, 0x60,
+  0x21, 0x76, 0x2e, 0x65, 0x7a, 0xdd, 0x94, 0x14, 0x6a, 0x8b, 0xa5, 0x4a, 0x17, 0x86, 0x03, 0x01,
+  0x8d, 0x43, 0xa9, 0x44, 0x5b, 0xd4, 0xfb, 0x6d, 0x7c, 0x64, 0xb3, 0x90, 0x75, 0x3b, 0xeb, 0xcb,
+  0xa2, 0x3a, 0x06, 0x3f, 0x32, 0x59, 0x1c, 0x9e, 0x00, 0x34, 0x30, 0x41, 0x82, 0x9f, 0x34, 0xf8,
+  0x50, 0x1c, 0xab, 0xa5, 0x01, 0xc6, 0x99, 0x7c, 0xe9, 0xd5, 0xfd, 0x21, 0x7e, 0x86, 0x2f, 0x4a,
+  0xef, 0x81, 0x22, 0xdc, 0x96, 0x4e, 0x0e, 0x59, 0x70, 0x55, 0xb2, 0xa7, 0x79, 0x95, 0x80, 0x09,
+  0xe7, 0x29, 0x3e, 0xee, 0x98, 0xfc, 0x19, 0x95, 0x29, 0x59, 0x9b, 0xa6, 0x29, 0x5a, 0x69, 0x7a,
+  0xbf, 0xac, 0x93, 0x1b, 0x08, 0x72, 0xd2, 0xff, 0x75, 0xba, 0x7e, 0x77, 0xf1, 0xa9, 0xfb, 0x70,
+  0xde, 0x35, 0x7f, 0x4a, 0xa5, 0x25, 0xe5, 0xcc, 0x9b, 0xba, 0x5d, 0x5a, 0xe5, 0xf3, 0x07, 0x59,
+  0x3d, 0x01, 0x31, 0xe2, 0xa4, 0x07, 0x37, 0x02, 0x00, 0x00,
+};
+
+#if ENABLE_PROFILER
+// profile.html: 977 bytes, 545 gzipped
+static const uint8_t WEB_ASSET_PROFILE_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x53, 0xc1, 0x52, 0xdb, 0x30,
+  0x10, 0xbd, 0xe7, 0x2b, 0xb6, 0x39, 0xe0, 0x76, 0x06, 0xc7, 0x50, 0x60, 0x20, 0x45, 0xf6, 0x0c,
+  0xb4, 0xe5, 0x54, 0xda, 0x4c, 0x49, 0x0f, 0x3d, 0x65, 0x14, 0x79, 0x13, 0x0b, 0x64, 0xc9, 0x48,
+  0x9b, 0xa4, 0xfc, 0x7d, 0x57, 0x72, 0x08, 0x69, 0xe9, 0xa5, 0x07, 0xdb, 0xbb, 0x2b, 0xed, 0xee,
+  0xdb, 0xf7, 0xd6, 0xe2, 0xcd, 0xa7, 0x6f, 0x1f, 0xa7, 0x3f, 0x27, 0x9f, 0xa1, 0xa1, 0xd6, 0x54,
+  0x62, 0xfb, 0x46, 0x59, 0x57, 0x82, 0x34, 0x19, 0xac, 0xbe, 0x38, 0xd7, 0xc1, 0xc4, 0xbb, 0x85,
+  0x36, 0x28, 0x8a, 0x3e, 0x36, 0x10, 0x2d, 0x92, 0x04, 0xd5, 0x48, 0x1f, 0x90, 0xca, 0xe1, 0x8f,
+  0xe9, 0x4d, 0x7e, 0x31, 0x7c, 0x0e, 0x5b, 0xd9, 0x62, 0x99, 0xad, 0x35, 0x6e, 0x3a, 0xe7, 0x29,
+  0x03, 0xe5, 0x2c, 0xa1, 0xa5, 0x32, 0xdb, 0xe8, 0x9a, 0x9a, 0xb2, 0xc6, 0xb5, 0x56, 0x98, 0x27,
+  0xe7, 0x10, 0xb4, 0xd5, 0xa4, 0xa5, 0xc9, 0x83, 0x92, 0x06, 0xcb, 0xe3, 0x8c, 0x8b, 0x18, 0x6d,
+  0x1f, 0xc0, 0xa3, 0x29, 0x87, 0x81, 0x9e, 0x0c, 0x86, 0x06, 0x91, 0x86, 0xd0, 0x78, 0x5c, 0x94,
+  0xc3, 0x22, 0x90, 0x24, 0xad, 0x8a, 0xae, 0x07, 0x34, 0x3a, 0x1f, 0x2f, 0x4e, 0x16, 0x67, 0xa7,
+  0x8b, 0x91, 0x0a, 0x21, 0x02, 0x28, 0x7a, 0xe8, 0x73, 0x57, 0x3f, 0xf1, 0x18, 0xc7, 0x7f, 0xa1,
+  0xe7, 0xc0, 0x40, 0x74, 0xd5, 0x04, 0x7d, 0xce, 0x75, 0x96, 0x08, 0xa4, 0x5b, 0x6d, 0x97, 0x01,
+  0xdc, 0x1a, 0x3d, 0x50, 0x83, 0x60, 0x64, 0x20, 0x10, 0xa1, 0x93, 0x16, 0x74, 0x1d, 0x11, 0xdb,
+  0xda, 0x6d, 0xb2, 0x2a, 0x17, 0x45, 0x8c, 0x55, 0xe0, 0x57, 0x36, 0x44, 0xd0, 0xd0, 0x6a, 0xe5,
+  0x5d, 0x40, 0x9e, 0xad, 0x0e, 0xa3, 0xc1, 0x57, 0x0c, 0x84, 0x35, 0xa4, 0xa2, 0x01, 0xde, 0xb6,
+  0x8f, 0x44, 0xb3, 0x2e, 0x92, 0x73, 0x08, 0x06, 0xeb, 0xd9, 0xaa, 0xab, 0x25, 0xb1, 0x1d, 0xc1,
+  0xaf, 0xc2, 0xec, 0x3e, 0x38, 0xfb, 0x0e, 0xa4, 0x47, 0x90, 0x26, 0x38, 0xe6, 0x67, 0x65, 0x63,
+  0x36, 0x57, 0x8d, 0x10, 0xb6, 0xc8, 0x1a, 0x49, 0xc0, 0x9c, 0x70, 0x7a, 0x8c, 0xb6, 0x23, 0x51,
+  0x74, 0x0c, 0x5e, 0xf6, 0x3c, 0x64, 0x45, 0x56, 0x1d, 0x18, 0xf9, 0xb8, 0x72, 0x97, 0x70, 0x2d,
+  0xd5, 0x03, 0x90, 0x83, 0xbb, 0x54, 0x5c, 0x14, 0x92, 0xc7, 0xf7, 0xe9, 0x19, 0x08, 0x92, 0x73,
+  0x83, 0x69, 0x92, 0x1e, 0x1a, 0xd3, 0x0b, 0x20, 0x68, 0xab, 0x2f, 0xdf, 0xa2, 0xa6, 0xba, 0x8b,
+  0x27, 0xac, 0x6c, 0x93, 0xbc, 0xef, 0x3c, 0xe0, 0xce, 0xb9, 0xd5, 0x76, 0x67, 0x5f, 0xad, 0x97,
+  0x3b, 0xbb, 0x1b, 0x8f, 0x5f, 0xee, 0xc8, 0x5f, 0xfb, 0x36, 0x20, 0x53, 0xd9, 0x07, 0x8a, 0xd8,
+  0xa0, 0xe8, 0x9b, 0xa5, 0xb6, 0xbd, 0x2a, 0x45, 0xff, 0x65, 0xad, 0x12, 0x3a, 0x36, 0x9a, 0xf7,
+  0x11, 0x84, 0x31, 0xdc, 0x98, 0xcd, 0xa8, 0xd0, 0x8b, 0x02, 0x21, 0x1e, 0xe4, 0xe4, 0xf8, 0x93,
+  0x55, 0x47, 0xcf, 0x32, 0x68, 0x42, 0xcf, 0x7b, 0xe0, 0x6c, 0x80, 0x60, 0xdc, 0x26, 0x89, 0xc7,
+  0x09, 0xaf, 0xd2, 0x98, 0xac, 0xd0, 0x38, 0x53, 0xef, 0x29, 0x78, 0x90, 0x94, 0xbb, 0xe4, 0x44,
+  0x6d, 0x15, 0xc2, 0xdc, 0x39, 0x1a, 0xc1, 0xad, 0x63, 0xd9, 0x3d, 0x2a, 0x5e, 0xd3, 0x0f, 0x3d,
+  0xd1, 0x7f, 0x30, 0xc7, 0xd0, 0xfe, 0xc5, 0xdc, 0xd5, 0x1e, 0x6f, 0xd3, 0x88, 0x70, 0xe7, 0x5d,
+  0x7b, 0x94, 0x0f, 0xbc, 0x39, 0xf6, 0x3f, 0x99, 0x08, 0xca, 0xeb, 0x8e, 0x20, 0x78, 0xf5, 0x7a,
+  0xd5, 0xe7, 0x47, 0x17, 0x67, 0xe3, 0x93, 0xd3, 0xf3, 0xd1, 0x3d, 0x6f, 0x3a, 0x4f, 0x93, 0xae,
+  0xc6, 0xe4, 0x6d, 0xb1, 0xf4, 0xeb, 0x0e, 0x7e, 0x03, 0xe2, 0x9d, 0x72, 0x9e, 0xd1, 0x03, 0x00,
+  0x00,
+};
+#endif
+
+static const WebAsset WEB_ASSETS[] = {
+  { "/static/status.616c072a.css", "text/css", "\"387839fb90f4f87b\"", true, WEB_ASSET_STATUS_CSS, sizeof(WEB_ASSET_STATUS_CSS), 3889 },
+  { "/static/status.73242f02.js", "application/javascript", "\"0516afcb17364017\"", true, WEB_ASSET_STATUS_JS, sizeof(WEB_ASSET_STATUS_JS), 15008 },
+  { "/static/config.4fe89941.css", "text/css", "\"4aa8463a506f2c34\"", true, WEB_ASSET_CONFIG_CSS, sizeof(WEB_ASSET_CONFIG_CSS), 1660 },
+  { "/static/config.806c12f4.js", "application/javascript", "\"65b3779840a1ce29\"", true, WEB_ASSET_CONFIG_JS, sizeof(WEB_ASSET_CONFIG_JS), 1038 },
+  { "/static/mqtt.bd145ff2.css", "text/css", "\"43c28d6f968cd78c\"", true, WEB_ASSET_MQTT_CSS, sizeof(WEB_ASSET_MQTT_CSS), 502 },
+  { "/static/mqtt.1369f74f.js", "application/javascript", "\"630f4215c81fb483\"", true, WEB_ASSET_MQTT_JS, sizeof(WEB_ASSET_MQTT_JS), 1762 },
+#if ENABLE_PROFILER
+  { "/static/profile.79f3f54f.css", "text/css", "\"f1b9c926c42eced0\"", true, WEB_ASSET_PROFILE_CSS, sizeof(WEB_ASSET_PROFILE_CSS), 358 },
+#endif
+#if ENABLE_PROFILER
+  { "/static/profile.b0859347.js", "application/javascript", "\"24683f4a9e882f31\"", true, WEB_ASSET_PROFILE_JS, sizeof(WEB_ASSET_PROFILE_JS), 1369 },
+#endif
+  { "/", "text/html", "\"0d72edce26b8ee9c\"", false, WEB_ASSET_STATUS_HTML, sizeof(WEB_ASSET_STATUS_HTML), 5143 },
+  { "/mqtt", "text/html", "\"c0e91f9b596d5c6b\"", false, WEB_ASSET_MQTT_HTML, sizeof(WEB_ASSET_MQTT_HTML), 567 },
+#if ENABLE_PROFILER
+  { "/profile", "text/html", "\"ee7c84dc3f2f1895\"", false, WEB_ASSET_PROFILE_HTML, sizeof(WEB_ASSET_PROFILE_HTML), 977 },
+#endif
+};
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif
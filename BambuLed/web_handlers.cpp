@@ -3,333 +3,36 @@
 #include "light_controller.h"
 #include "led_controller.h"
 #include "mqtt_handler.h"
+#include "web_assets.h" // Generated by tools/build_web_assets.py
+#include "chunked_response.h"
+#include "status_cache.h"
 #include <ArduinoJson.h>
-#include <WebSocketsServer.h> // <-- Added for WebSockets
-
-// --- External Declarations ---
-extern WebSocketsServer webSocket; // From BambuLedNew.ino
-// No need to extern mqtt_history, it's included via mqtt_handler.h
+#include "ws_broadcaster.h" // <-- Added for WebSockets
+#include "sse_broadcaster.h"
+#include "history_store.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "boot_timing.h"
+#include "state_store.h"
+#include "led_plan.h"
+#include "rules.h"
+#include "json_pool.h"
+#include "printer_commands.h"
+#include "logger.h"
+#include "hms.h"
+#include "ams.h"
+// The MQTT history comes in via mqtt_handler.h (mqtt_history.h)
 
 
 // --- PROGMEM HTML Page Definitions ---
 
-// --- PAGE_ROOT (Main Status Page) ---
-const char PAGE_ROOT[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta charset="UTF-K">
-  <meta name="viewport" content="width=device-width, initial-scale=1">
-  <title>Bambu Light Status</title>
-  <link rel="icon" href="data:image/svg+xml,%3Csvg xmlns='http://www.w3.org/2000/svg' viewBox='0 0 100 100'%3E%3Cpath fill='%23378cf0' d='M50 0C27.9 0 10 17.9 10 40c0 14.9 8.2 27.8 20 34.8V85c0 2.8 2.2 5 5 5h30c2.8 0 5-2.2 5-5v-10.2c11.8-7 20-19.9 20-34.8C90 17.9 72.1 0 50 0zM50 75h-0.1V67.8c-1.6 0.1-3.2 0.2-4.9 0.2s-3.3-0.1-4.9-0.2V75H25V62.4c-9.1-5.9-15-16.1-15-27.4C10 17.8 27.8 0 50 0s40 17.8 40 40c0 11.3-5.9 21.5-15 27.4V75h-15V67.8c-1.6 0.1-3.2 0.2-4.9 0.2s-3.3-0.1-4.9-0.2V75z'/%3E%3C/svg%3E">
-  <style>
-    :root {
-      --bg-color: #1a1a1b;
-      --card-color: #2c2c2e;
-      --border-color: #444;
-      --text-color: #e0e0e0;
-      --text-color-muted: #aaa;
-      --text-color-bright: #ffffff;
-      --primary-color: #378cf0;
-      --green-color: #28a745;
-      --red-color: #dc3545;
-      --grey-color: #6c757d;
-    }
-    body { 
-      font-family: -apple-system, BlinkMacSystemFont, "Segoe UI", Roboto, "Helvetica Neue", Arial, sans-serif;
-      margin: 0; 
-      padding: 1rem;
-      background-color: var(--bg-color); 
-      color: var(--text-color); 
-      max-width: 900px;
-      margin: 0 auto;
-    }
-    .logo_title_wrapper {
-      display: flex;
-      align-items: center;
-      gap: 15px;
-      margin-bottom: 1rem;
-      color: var(--text-color-bright);
-      border-bottom: 2px solid var(--primary-color);
-      padding-bottom: 1rem;
-    }
-    .logo {
-      flex-shrink: 0;
-    }
-    h1 {
-      margin: 0;
-      font-size: 1.75rem;
-    }
-    h2 { 
-      color: var(--text-color-bright);
-      border-bottom: 1px solid var(--border-color);
-      padding-bottom: 8px;
-      margin-top: 2rem;
-    }
-    .status_grid {
-      display: grid;
-      grid-template-columns: repeat(auto-fit, minmax(200px, 1fr));
-      gap: 1rem;
-    }
-    .status { 
-      padding: 15px; 
-      margin-bottom: 0;
-      border-radius: 8px; 
-      transition: background-color 0.5s, border-color 0.5s; 
-      background-color: var(--card-color); 
-      border: 1px solid var(--border-color); 
-    }
-    .status strong {
-      display: block;
-      font-size: 0.9rem;
-      color: var(--text-color-muted);
-      margin-bottom: 5px;
-      text-transform: uppercase;
-    }
-    span.data { 
-      font-weight: 600; 
-      font-size: 1.1rem;
-      color: var(--text-color-bright);
-    }
-    .connected { background-color: #1a3a24; color: #8cda9b; border-color: #336d3f; }
-    .disconnected { background-color: #401f22; color: #f0989f; border-color: #7c333a; }
-    .warning { background-color: #423821; color: #f0d061; border-color: #7e6c33; }
-    .light-on { background-color: #1c314a; color: #9cc2ef; border-color: #335d88; }
-    .error { background-color: #401f22; color: #f0989f; border-color: #7c333a; font-weight: bold; }
-    
-    .button-group {
-      display: flex;
-      gap: 10px;
-      flex-wrap: wrap;
-    }
-    button, .button { 
-      background-color: var(--primary-color); 
-      color: var(--text-color-bright); 
-      padding: 10px 15px; 
-      border: none; 
-      border-radius: 5px; 
-      cursor: pointer; 
-      font-size: 1rem;
-      font-weight: 500;
-      text-decoration: none;
-      transition: background-color 0.2s, transform 0.1s;
-    }
-    button:hover, .button:hover {
-      opacity: 0.85;
-    }
-    button:active, .button:active {
-      transform: scale(0.98);
-    }
-    button.off, .button.off { background-color: var(--grey-color); }
-    button.auto, .button.auto { background-color: var(--green-color); }
-    button.danger, .button.danger { background-color: var(--red-color); }
-
-    .vled {
-      transition: background-color 0.5s, opacity 0.5s;
-    }
-    small {
-      color: var(--text-color-muted);
-      font-size: 0.9rem;
-    }
-  </style>
-</head>
-<body>
-  <div class="logo_title_wrapper">
-    <svg class="logo" xmlns="http://www.w3.org/2000/svg" viewBox="0 0 100 100" fill="#378cf0" width="50" height="50">
-      <path d="M50 0C27.9 0 10 17.9 10 40c0 14.9 8.2 27.8 20 34.8V85c0 2.8 2.2 5 5 5h30c2.8 0 5-2.2 5-5v-10.2c11.8-7 20-19.9 20-34.8C90 17.9 72.1 0 50 0zM50 75h-0.1V67.8c-1.6 0.1-3.2 0.2-4.9 0.2s-3.3-0.1-4.9-0.2V75H25V62.4c-9.1-5.9-15-16.1-15-27.4C10 17.8 27.8 0 50 0s40 17.8 40 40c0 11.3-5.9 21.5-15 27.4V75h-15V67.8c-1.6 0.1-3.2 0.2-4.9 0.2s-3.3-0.1-4.9-0.2V75z"/>
-    </svg>
-    <h1>Bambu Light Controller</h1>
-  </div>
-
-  <div class="status_grid">
-    <div id="wifi-status-div" class="status {{WIFI_STATUS_CLASS}}">
-      <strong>WiFi Status</strong>
-      <span class="data">{{WIFI_STATUS}}</span>
-    </div>
-    
-    <div id="mqtt-status-div" class="status disconnected">
-      <strong>MQTT Status</strong>
-      <span id="mqtt-status" class="data">DISCONNECTED</span>
-      <br><small><a href="/mqtt" target="_blank" style="color: var(--text-color-bright);">View MQTT History</a></small>
-    </div>
-  </div>
-
-  <h2>Printer Status</h2>
-  <div class="status_grid">
-    <div class="status"><strong>GCODE State</strong><span id="gcode-state" class="data">N/A</span></div>
-    <div class="status"><strong>Print Progress</strong><span id="print-percent" class="data">0 %</span></div>
-    <div class="status"><strong>Current Layer</strong><span id="layer-num" class="data">0</span></div>
-    <div class="status"><strong>Time Remaining</strong><span id="print-time" class="data">--:--:--</span></div>
-    <div class="status"><strong>Nozzle Temp</strong><span id="nozzle-temp" class="data">0.0 / 0.0 &deg;C</span></div>
-    <div class="status"><strong>Bed Temp</strong><span id="bed-temp" class="data">0.0 / 0.0 &deg;C</span></div>
-    <div class="status"><strong>Print Stage</strong><span id="stage" class="data">N/A</span></div>
-    <div class="status"><strong>WiFi Signal</strong><span id="wifi-signal" class="data">N/A</span></div>
-  </div>
-
-  <h2>External Outputs</h2>
-  <div class="status_grid">
-    <div id="light-status-div" class="status disconnected">
-      <strong>External Light (Pin {{LIGHT_PIN}})</strong>
-      <span id="light-status" class="data">N/A</span>
-      <br><small><strong>Mode:</strong> <span id="light-mode" class="data">N/A</span>
-      | <strong>Logic:</strong> {{LIGHT_LOGIC}}
-      | <strong>Bambu:</strong> <span id="bambu-light-mode" class="data">N/A</span></small>
-    </div>
-
-    <div id="led-status-div" class="status disconnected">
-      <strong>LED Status Bar (Pin {{LED_PIN}} / {{LED_COUNT}} LEDs)</strong>
-      <span id="led-status" class="data">N/A</span>
-      <div id='virtual-bar-container' style='margin-top: 10px;'>
-        <div id='virtual-bar' style='display: flex; width: 100%; height: 20px; background: #222; border-radius: 5px; overflow: hidden; border: 1px solid #444;'>
-          {{VIRTUAL_LEDS}}
-        </div>
-      </div>
-    </div>
-  </div>
-
-  <h2>Manual Control</h2>
-  <div class="button-group" id="button-controls">
-    <button id="btn-light-on">Turn Light ON</button>
-    <button id="btn-light-off" class="off">Turn Light OFF</button>
-    <button id="btn-light-auto" class="auto">Set to AUTO</button>
-  </div>
-
-  <hr style="border: 0; border-top: 1px solid var(--border-color); margin: 2rem 0;">
-  
-  <div class="button-group">
-    <a href="/config" class="button">Change Device Settings</a>
-  </div>
-  
-  <script>
-    let ws;
-    
-    function formatTime(s) {
-      if (s <= 0) return '--:--:--';
-      let h = Math.floor(s / 3600); s %= 3600;
-      let m = Math.floor(s / 60); s %= 60;
-      let m_str = m < 10 ? '0' + m : m;
-      let s_str = s < 10 ? '0' + s : s;
-      return h > 0 ? h + ':' + m_str + ':' + s_str : m_str + ':' + s_str;
-    }
-
-    function updateUI(data) {
-      try {
-        document.getElementById('mqtt-status').innerText = data.mqtt_connected ? 'CONNECTED' : 'DISCONNECTED';
-        document.getElementById('mqtt-status-div').className = 'status ' + (data.mqtt_connected ? 'connected' : 'disconnected');
-        
-        document.getElementById('gcode-state').innerText = data.gcode_state;
-        document.getElementById('print-percent').innerText = data.print_percentage + ' %';
-        document.getElementById('layer-num').innerText = data.layer_num;
-        document.getElementById('stage').innerText = data.stage;
-        document.getElementById('print-time').innerText = formatTime(data.time_remaining);
-        document.getElementById('nozzle-temp').innerHTML = data.nozzle_temp.toFixed(1) + ' / ' + data.nozzle_target_temp.toFixed(1) + ' &deg;C';
-        document.getElementById('bed-temp').innerHTML = data.bed_temp.toFixed(1) + ' / ' + data.bed_target_temp.toFixed(1) + ' &deg;C';
-        document.getElementById('wifi-signal').innerText = data.wifi_signal;
-        
-        document.getElementById('light-status').innerText = data.light_is_on ? ('ON (' + data.chamber_bright + '%)') : 'OFF';
-        document.getElementById('light-status-div').className = 'status ' + (data.light_is_on ? 'light-on' : 'disconnected');
-        document.getElementById('light-mode').innerText = data.manual_control ? 'MANUAL' : ('AUTO' + data.light_mode_extra);
-        document.getElementById('bambu-light-mode').innerText = data.bambu_light_mode;
-        
-        document.getElementById('led-status').innerText = data.led_status_str;
-        document.getElementById('led-status-div').className = 'status ' + data.led_status_class;
-
-        let color = data.led_color_val.toString(16).padStart(6, '0');
-        let brightness = data.led_bright_val;
-        let opacity = (brightness / 255).toFixed(2);
-        let vleds = document.querySelectorAll('#virtual-bar .vled');
-        let numLeds = vleds.length;
-        
-        if (data.is_printing && data.print_percentage > 0 && numLeds > 0) {
-          let leds_to_light = Math.ceil((data.print_percentage / 100) * numLeds);
-          for (let i = 0; i < numLeds; i++) {
-            if (i < leds_to_light) {
-              vleds[i].style.backgroundColor = '#' + color;
-              vleds[i].style.opacity = opacity;
-            } else {
-              vleds[i].style.backgroundColor = '#000';
-              vleds[i].style.opacity = '1.0';
-            }
-          }
-        } else {
-          vleds.forEach(led => {
-            led.style.backgroundColor = '#' + color;
-            led.style.opacity = opacity;
-          });
-        }
-      } catch (e) {
-        console.error('Error updating UI:', e);
-      }
-    }
-
-    function connectWebSocket() {
-      console.log('Connecting WebSocket...');
-      ws = new WebSocket('ws://' + window.location.hostname + ':81/');
-
-      ws.onopen = function() {
-        console.log('WebSocket connected.');
-      };
-
-      ws.onmessage = function(evt) {
-        // New message from server!
-        const data = JSON.parse(evt.data);
-        updateUI(data); // Update the page
-      };
-
-      ws.onclose = function() {
-        console.log('WebSocket disconnected. Reconnecting in 3s...');
-        // Try to reconnect every 3 seconds
-        setTimeout(connectWebSocket, 3000);
-      };
-
-      ws.onerror = function(err) {
-        console.error('WebSocket Error:', err);
-        ws.close();
-      };
-    }
-    
-    document.addEventListener('DOMContentLoaded', () => {
-      connectWebSocket();
-      
-      // Add click handlers for WebSocket control
-      document.getElementById('btn-light-on').addEventListener('click', () => {
-        if(ws) ws.send('LIGHT_ON');
-      });
-      document.getElementById('btn-light-off').addEventListener('click', () => {
-        if(ws) ws.send('LIGHT_OFF');
-      });
-      document.getElementById('btn-light-auto').addEventListener('click', () => {
-        if(ws) ws.send('LIGHT_AUTO');
-      });
-    });
-  </script>
-</body>
-</html>
-)rawliteral";
-
-
 // --- PAGE_CONFIG (Configuration Page) ---
 const char PAGE_CONFIG[] PROGMEM = R"rawliteral(
 <!DOCTYPE html><html><head>
 <meta name='viewport' content='width=device-width, initial-scale=1'>
-<title>Bambu Light Config</title><style>
-body{font-family:-apple-system, BlinkMacSystemFont, "Segoe UI", Roboto, "Helvetica Neue", Arial, sans-serif;margin:20px;background:#1a1a1b;color:#e0e0e0;max-width: 900px; margin: 0 auto; padding: 1rem;}
-h1,h2,h3{color:#fff;} h2{border-bottom:2px solid #378cf0;padding-bottom:5px; margin-top: 2rem;}
-form{background:#2c2c2e;padding:20px;border-radius:8px;box-shadow:0 2px 5px rgba(0,0,0,0.1);}
-div{margin-bottom:15px;} label{display:block;margin-bottom:5px;font-weight:bold;color:#ccc;}
-input[type='text'],input[type='number'],input[type='password'],select{width:98%;max-width: 98%;padding:8px;border:1px solid #555;border-radius:4px;font-family:Arial,sans-serif;font-size:1em;background-color:#3a3a3c;color:#e0e0e0;}
-input[type='checkbox']{margin-right:10px;vertical-align:middle;}
-label[for='invert'], label[for='chamber_timeout'], label[for='led_finish_timeout'] { display:inline-block;font-weight:normal; }
-button, .button{background-color:#378cf0;color:#ffffff;padding:12px 20px;border:none;border-radius:5px;cursor:pointer;font-size:16px; text-decoration: none; display: inline-block; margin-top: 10px;}
-button:hover{opacity: 0.85;}
-.color-input{width:100px;padding:8px;vertical-align:middle;margin-left:10px;border:1px solid #555;}
-.grid{display:grid;grid-template-columns:repeat(auto-fit, minmax(200px, 1fr));grid-gap:20px;}
-.card{background:#3a3a3c;padding:15px;border-radius:5px;border:1px solid #555;}
-small{color:#aaa;}
-a{color:#58a6ff;}
-.color-swatch{width: 20px; height: 20px; display: inline-block; vertical-align: middle; margin-left: 10px; border: 1px solid #555; border-radius: 4px; background-color: #000;}
-.danger{background-color:#dc3545;}
-</style></head><body><h1>Bambu Light Controller Settings</h1>
+<title>Bambu Light Config</title>
+<link rel='stylesheet' href='{{CONFIG_CSS}}'>
+</head><body><h1>Bambu Light Controller Settings</h1>
 <p><small>To change Wi-Fi, use the 'Factory Reset' pin (GPIO 16) on boot.</small></p>
 <form action='/config' method='POST'>
 <h2>Printer Settings</h2>
@@ -352,6 +55,7 @@ a{color:#58a6ff;}
 <div class='grid'>
 <div class='card'><div><label for='numleds'>Number of WS2812B LEDs (Max {{MAX_LEDS}})</label><input type='number' id='numleds' name='numleds' min='0' max='{{MAX_LEDS}}' value='{{NUM_LEDS}}'></div></div>
 <div class='card'><div><label for='led_color_order'>LED Color Order</label>{{LED_ORDER_DROPDOWN}}</div></div>
+<div class='card'><div><label for='ams_leds'>AMS Tray LEDs (end of strip, 0 = off)</label><input type='number' id='ams_leds' name='ams_leds' min='0' max='{{MAX_LEDS}}' value='{{AMS_LEDS}}'></div></div>
 </div>
 <div><small>LED Data Pin is hardcoded to GPIO {{LED_PIN}} for FastLED.</small></div>
 <div><input type='checkbox' id='led_finish_timeout' name='led_finish_timeout' value='1' {{LED_TIMEOUT_CHECK}}><label for='led_finish_timeout'>Enable 2-Min Finish Timeout (LEDs return to Idle)</label></div>
@@ -384,7 +88,29 @@ a{color:#58a6ff;}
 <div><label for='finish_color'>Color (RRGGBB) <span id='finish_color_swatch' class='color-swatch'></span></label><input type='text' id='finish_color' name='finish_color' value='{{FINISH_COLOR}}' oninput='updatePreview(); try { document.getElementById("finish_color_picker").value = "#" + this.value; } catch(e) {}'><input type='color' class='color-input' id='finish_color_picker' value='#{{FINISH_COLOR}}' onchange='document.getElementById("finish_color").value = this.value.substring(1).toUpperCase(); updatePreview();'></div>
 <div><label for='finish_bright'>Brightness (0-255)</label><input type='number' id='finish_bright' name='finish_bright' min='0' max='255' value='{{FINISH_BRIGHT}}' oninput='updatePreview()'></div></div>
 </div>
-<br><div><button type='submit'>Save and Reboot</button></div>
+<h2>Rules</h2>
+<div class='card'><div><label for='rules'>One rule per line (max {{RULES_MAX}} characters)</label><textarea id='rules' name='rules' rows='6' maxlength='{{RULES_MAX}}' style='width:100%;font-family:monospace;'>{{RULES}}</textarea></div>
+<small>Example: <code>when state == RUNNING and layer &lt;= 1 then light 100, leds 0000FF 80</code>. Fields: state, light_mode, percent, layer, stage, remaining, bed, bed_target, nozzle, nozzle_target, error. Actions: light on|off|0-100, leds RRGGBB [0-255]|off, notify text (last, may contain commas). The last matching rule wins. Current matches: <a href='/rules.json'>/rules.json</a>.</small></div>
+<h2>Home Automation MQTT</h2>
+<div class='grid'>
+<div class='card'><div><label for='bridge_host'>Broker Host (empty = off)</label><input type='text' id='bridge_host' name='bridge_host' maxlength='63' value='{{BRIDGE_HOST}}'></div>
+<div><label for='bridge_port'>Port</label><input type='number' id='bridge_port' name='bridge_port' min='1' max='65535' value='{{BRIDGE_PORT}}'></div>
+<div><label for='bridge_user'>Username</label><input type='text' id='bridge_user' name='bridge_user' maxlength='31' value='{{BRIDGE_USER}}'></div>
+<div><label for='bridge_pass'>Password</label><input type='password' id='bridge_pass' name='bridge_pass' maxlength='39' value='{{BRIDGE_PASS}}'></div></div>
+<div class='card'><div><label for='bridge_prefix'>Topic Prefix</label><input type='text' id='bridge_prefix' name='bridge_prefix' maxlength='23' value='{{BRIDGE_PREFIX}}'></div>
+<div><label for='bridge_rate'>Max Publishes per Second (1-{{MAX_BRIDGE_RATE}})</label><input type='number' id='bridge_rate' name='bridge_rate' min='1' max='{{MAX_BRIDGE_RATE}}' value='{{BRIDGE_RATE}}'></div>
+<div><label for='bridge_deadband'>Temperature Deadband (&deg;C)</label><input type='number' id='bridge_deadband' name='bridge_deadband' min='0' max='50' step='0.1' value='{{BRIDGE_DEADBAND}}'></div>
+<div><input type='checkbox' id='bridge_discovery' name='bridge_discovery' value='1' {{BRIDGE_DISCOVERY_CHECK}}><label for='bridge_discovery'>Home Assistant Discovery</label></div></div>
+</div>
+<small>Publishes retained topics &lt;prefix&gt;/&lt;serial&gt;/&lt;field&gt; when values change.</small>
+<h2>Web Interface</h2>
+<div class='grid'>
+<div class='card'><div><label for='ws_rate'>Max Live Updates per Second (1-{{MAX_WS_RATE}})</label><input type='number' id='ws_rate' name='ws_rate' min='1' max='{{MAX_WS_RATE}}' value='{{WS_RATE}}'></div>
+<small>Changes arriving faster than this are merged; each client only receives the latest status.</small></div>
+<div class='card'><div><input type='checkbox' id='printer_control' name='printer_control' value='1' {{PRINTER_CONTROL_CHECK}}><label for='printer_control'>Allow Pause, Resume and Stop</label></div>
+<small>Lets <code>/printer/command</code> and WebSocket clients pause, resume or stop the print. Anyone on the network can then do so.</small></div>
+</div>
+<br><div><button type='submit'>Save and Apply</button></div>
 </form>
 <h2>Backup & Restore</h2>
 <div class='grid'>
@@ -403,55 +129,11 @@ a{color:#58a6ff;}
 </div>
 </div>
 <br><p><a href='/'>&laquo; Back to Status Page</a></p>
-<script>
-function updatePreview() {
-  try {
-    let state = document.querySelector('input[name="preview_state"]:checked').value;
-    let color = document.getElementById(state + '_color').value;
-    if (!color.match(/^[0-9a-fA-F]{6}$/)) { color = '000000'; }
-    let bright = parseInt(document.getElementById(state + '_bright').value, 10);
-    if (isNaN(bright) || bright < 0 || bright > 255) { bright = 0; }
-    let opacity = (bright / 255).toFixed(2);
-    let vleds = document.querySelectorAll('.vled');
-    vleds.forEach(led => {
-      led.style.backgroundColor = '#' + color;
-      led.style.opacity = opacity;
-    });
-    let states = ['idle', 'print', 'pause', 'error', 'finish'];
-    states.forEach(s => {
-      let c = document.getElementById(s + '_color').value;
-      if (!c.match(/^[0-9a-fA-F]{6}$/)) { c = '000000'; }
-      document.getElementById(s + '_color_swatch').style.backgroundColor = '#' + c;
-    });
-  } catch (e) { console.error('Preview update failed:', e); }
-}
-document.addEventListener('DOMContentLoaded', updatePreview);
-</script>
+<script src='{{CONFIG_JS}}'></script>
 </body></html>
 )rawliteral";
 
 
-// --- PAGE_MQTT (MQTT Log Page) ---
-const char PAGE_MQTT[] PROGMEM = R"rawliteral(
-<!DOCTYPE html><html><head><title>MQTT History</title>
-<meta name='viewport' content='width=device-width, initial-scale=1'>
-<style>
-body{font-family:monospace;margin:20px;background:#1a1a1b;color:#e0e0e0;max-width: 900px; margin: 0 auto; padding: 1rem;}
-h1{color:#fff;font-family:Arial,sans-serif;}
-p{font-family:Arial,sans-serif;}
-pre{white-space:pre-wrap;word-wrap:break-word;font-size:0.9em;background:#2c2c2e;padding:10px;border-radius:5px;border:1px solid #444;}
-a{color:#58a6ff;text-decoration:none;font-family:Arial,sans-serif;}
-.highlight{
-  color: #f0d061;
-  font-weight: bold;
-}
-</style></head><body><h1>MQTT Message History</h1>
-<p>Showing the last {{MSG_COUNT}} of {{MAX_COUNT}} messages (oldest first).</p>
-<a href='/'>&laquo; Back to Status</a><br><br>
-<pre>{{MQTT_LOGS}}</pre>
-</body></html>
-)rawliteral";
-
 // --- PAGE_RESTORE (Config Restore Page) ---
 const char PAGE_RESTORE[] PROGMEM = R"rawliteral(
 <!DOCTYPE html><html><head><title>Restore Config</title>
@@ -469,11 +151,97 @@ a{color:#58a6ff;}
 </form><br><br><a href='/config'>&laquo; Back to Settings</a></body></html>
 )rawliteral";
 
+const char PAGE_RESTORE_DONE[] PROGMEM =
+    "<!DOCTYPE html><html><head><title>Restore Complete</title>"
+    "<meta http-equiv='refresh' content='3;url=/'><style>body{font-family:Arial,sans-serif;background:#1a1a1b;color:#e0e0e0;}</style></head>"
+    "<body><h2>Restore Complete.</h2>"
+    "<p>Device is rebooting to load new configuration. You will be redirected in 3 seconds...</p></body></html>";
+
+const char PAGE_RESTORE_FAILED[] PROGMEM =
+    "<!DOCTYPE html><html><head><title>Restore Failed</title>"
+    "<style>body{font-family:Arial,sans-serif;margin:20px;background:#1a1a1b;color:#e0e0e0;} a{color:#58a6ff;}</style></head>"
+    "<body><h2>Restore Failed.</h2>"
+    "<p>The file upload failed. This may be due to an invalid filename (must be 'config.json') or a file system error.</p>"
+    "<a href='/restore'>Try again</a> | <a href='/'>Back to Status</a></body></html>";
+
+
+// --- Static Asset Serving ---
+// The status page shell, CSS and JS live in web/ and are gzipped at build time
+// into web_assets.h. Only the gzip body is in flash, so clients that do not
+// list gzip in Accept-Encoding (curl without --compressed, some proxies) get a
+// 406 instead of a body they cannot read. Repeat loads only cost a 304 when
+// the ETag still matches. /metrics counts bytes sent against the uncompressed
+// size, and the handler time.
+
+// True if the Accept-Encoding value allows gzip: a "gzip" or "*" entry
+// without q=0
+static bool acceptsGzip(const String& header) {
+  const char* p = header.c_str();
+  while (*p) {
+    while (*p == ' ' || *p == ',') p++;
+    const char* name = p;
+    while (*p && *p != ',' && *p != ';' && *p != ' ') p++;
+    size_t len = p - name;
+    bool match = (len == 4 && strncasecmp(name, "gzip", 4) == 0) || (len == 1 && *name == '*');
+    float q = 1.0f;
+    while (*p && *p != ',') {
+      if ((p[0] == 'q' || p[0] == 'Q') && p[1] == '=') q = atof(p + 2);
+      p++;
+    }
+    if (match) return q > 0.0f;
+  }
+  return false;
+}
+
+static void sendWebAsset(const WebAsset& asset) {
+  uint32_t start = micros();
+  server.sendHeader("ETag", asset.etag);
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (asset.immutable) {
+    server.sendHeader("Cache-Control", "public, max-age=31536000, immutable");
+  } else {
+    server.sendHeader("Cache-Control", "no-cache");
+  }
+
+  if (server.header("If-None-Match") == asset.etag) {
+    server.send(304);
+    metricsCount(metrics.web_asset_not_modified);
+  } else if (!acceptsGzip(server.header("Accept-Encoding"))) {
+    server.send(406, "text/plain", "This resource is only available gzip-encoded (Accept-Encoding: gzip).");
+    metricsCount(metrics.web_asset_not_acceptable);
+  } else {
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, asset.content_type, (PGM_P)asset.gz_data, asset.gz_length);
+    metricsCount(metrics.web_asset_sent);
+    metricsCount(metrics.web_asset_bytes_sent, asset.gz_length);
+    metricsCount(metrics.web_asset_bytes_uncompressed, asset.raw_length);
+  }
+  web_asset_histogram.observe(micros() - start);
+}
+
+static const WebAsset* findWebAsset(const char* uri) {
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    if (strcmp(WEB_ASSETS[i].uri, uri) == 0) return &WEB_ASSETS[i];
+  }
+  return nullptr;
+}
 
 // --- Function Implementations ---
 
 void setupWebServer() {
   Serial.println("Setting up Web Server...");
+
+  // Request headers the handlers need to see (WebServer drops all others)
+  static const char* headerKeys[] = {"If-None-Match", "Last-Event-ID", "Accept-Encoding", "Origin", "Host"};
+  server.collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+
+  // Page shells have their own handlers below
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset& asset = WEB_ASSETS[i];
+    if (!asset.immutable) continue;
+    server.on(asset.uri, HTTP_GET, [&asset]() { sendWebAsset(asset); });
+  }
+
   server.on("/", handleRoot);
   server.on("/status.json", handleStatusJson); // Kept for API/legacy
   server.on("/light/on", handleLightOn); // Kept for API/legacy
@@ -481,13 +249,26 @@ void setupWebServer() {
   server.on("/light/auto", handleLightAuto); // Kept for API/legacy
   server.on("/config", handleConfig);
   server.on("/mqtt", handleMqttJson);
+  server.on("/mqtt/history.json", HTTP_GET, handleMqttHistoryJson);
+  server.on("/events", HTTP_GET, handleEvents);
+  server.on("/history.json", HTTP_GET, handleHistoryJson);
+  server.on("/metrics", HTTP_GET, handleMetrics);
+  server.on("/rules.json", HTTP_GET, handleRulesJson);
+  server.on("/printer/command", handlePrinterCommand);
+  server.on("/printer/commands.json", HTTP_GET, handlePrinterCommandsJson);
+  server.on("/log.json", HTTP_GET, handleLogJson);
+#if ENABLE_PROFILER
+  server.on("/profile", HTTP_GET, handleProfilePage);
+  server.on("/profile.json", HTTP_GET, handleProfileJson);
+#endif
+#if ENABLE_WEBSOCKET
+  server.on("/ws/stats.json", HTTP_GET, handleWsStatsJson);
+#endif
   server.on("/backup", HTTP_GET, handleBackup);
   server.on("/restore", HTTP_GET, handleRestorePage);
   server.on("/restore", HTTP_POST, handleRestoreReboot);
   server.onFileUpload(handleRestoreUpload);
   server.begin();
-  Serial.print("Status page available at http://");
-  Serial.println(WiFi.localIP());
 }
 
 bool connectWiFi(bool forceReset) {
@@ -549,36 +330,43 @@ bool connectWiFi(bool forceReset) {
 }
 
 void handleRoot() {
-  String html = FPSTR(PAGE_ROOT);
-
-  // --- Fill in placeholders ---
-  String wifi_status_str = (WiFi.status() == WL_CONNECTED) ? "CONNECTED (" + WiFi.SSID() + " / " + WiFi.localIP().toString() + ")" : "DISCONNECTED";
-  html.replace("{{WIFI_STATUS_CLASS}}", (WiFi.status() == WL_CONNECTED ? "connected" : "disconnected"));
-  html.replace("{{WIFI_STATUS}}", wifi_status_str);
-
-  html.replace("{{LIGHT_PIN}}", String(config.chamber_light_pin));
-  html.replace("{{LIGHT_LOGIC}}", (config.invert_output ? "Active LOW" : "Active HIGH"));
-  
-  html.replace("{{LED_PIN}}", String(LED_DATA_PIN));
-  html.replace("{{LED_COUNT}}", String(config.num_leds));
-  
-  String vled_html = "";
-  for(int i=0; i < config.num_leds && i < MAX_LEDS; i++) {
-    vled_html += "<div class='vled' style='flex-grow: 1; height: 100%;'></div>";
+  // The page shell is static; device details are filled in from the status JSON
+  const WebAsset* asset = findWebAsset("/");
+  if (asset) {
+    sendWebAsset(*asset);
+  } else {
+    server.send(500, "text/plain", "Status page asset missing.");
   }
-  if (config.num_leds == 0) {
-    vled_html = "<div style='flex-grow: 1; height: 100%; text-align: center; color: #888; padding-top: 5px; font-size: 0.9em;'>LEDs disabled</div>";
+}
+
+// --- Status values shared by the JSON and binary encoders ---
+// LED values come from the LED plan (led_plan.h). Label tables are indexed by
+// the codes in status_cache.h; web/status.js carries the same tables for
+// binary clients.
+static const char* const LIGHT_EXTRA_LABELS[] = {
+  "",
+  " (Finish light ON - timing out...)",
+  " (Finish light OFF - timeout complete)"
+};
+
+static uint8_t getLightExtra() {
+  if (!manual_light_control && config.chamber_light_finish_timeout && finishTime > 0) {
+    if (millis() - finishTime < FINISH_LIGHT_TIMEOUT) {
+      return LIGHT_EXTRA_FINISH_ON;
+    }
+    return LIGHT_EXTRA_FINISH_OFF;
   }
-  html.replace("{{VIRTUAL_LEDS}}", vled_html);
-  
-  server.send(200, "text/html", html);
+  return LIGHT_EXTRA_NONE;
 }
 
 // --- New function to create the JSON (Suggestion 3) ---
-void createStatusJson(DynamicJsonDocument& doc) {
+void createStatusJson(JsonDocument& doc) {
+  doc["version"] = getStatusVersion();
+  doc["details_version"] = getStatusDetailsVersion();
   doc["mqtt_connected"] = client.connected();
 
   doc["gcode_state"] = current_gcode_state;
+  doc["state_stale"] = printer_state_stale;
   doc["print_percentage"] = current_print_percentage;
   doc["time_remaining"] = current_time_remaining;
   doc["layer_num"] = current_layer;
@@ -589,145 +377,357 @@ void createStatusJson(DynamicJsonDocument& doc) {
   doc["bed_target_temp"] = current_bed_target_temp;
   doc["wifi_signal"] = current_wifi_signal;
 
+  // Device details (static page shell fills these in)
+  // Non-const buffers: ArduinoJson copies them into the (static) document
+  IPAddress localIp = WiFi.localIP();
+  char ip[16];
+  snprintf(ip, sizeof(ip), "%u.%u.%u.%u", localIp[0], localIp[1], localIp[2], localIp[3]);
+  doc["wifi_ssid"] = wifi_ssid;
+  doc["ip"] = ip;
+  doc["light_pin"] = config.chamber_light_pin;
+  doc["invert_output"] = config.invert_output;
+  doc["led_pin"] = LED_DATA_PIN;
+  doc["num_leds"] = config.num_leds;
+
   doc["light_is_on"] = external_light_is_on;
-  doc["chamber_bright"] = config.chamber_pwm_brightness;
+  // Rules can run the light below the configured brightness
+  doc["chamber_bright"] = external_light_is_on ? getChamberLightLevel() : config.chamber_pwm_brightness;
   doc["manual_control"] = manual_light_control;
   doc["bambu_light_mode"] = current_light_mode;
   
-  String light_mode_extra = "";
-  if (!manual_light_control && config.chamber_light_finish_timeout && finishTime > 0) {
-    if (millis() - finishTime < FINISH_LIGHT_TIMEOUT) {
-      light_mode_extra = " (Finish light ON - timing out...)";
-    } else {
-      light_mode_extra = " (Finish light OFF - timeout complete)";
-    }
+  uint8_t light_extra = getLightExtra();
+  doc["light_mode_extra"] = LIGHT_EXTRA_LABELS[light_extra];
+
+  const LedPlan& led = getLedPlan();
+  doc["led_color_val"] = led.color;
+  doc["led_bright_val"] = led.bright;
+  doc["is_printing"] = (led.effect == LED_EFFECT_PROGRESS);
+
+  if (led.status == LED_STATUS_PRINTING) {
+    char status_str[32];
+    snprintf(status_str, sizeof(status_str), "%s (%d%%)", led.label, current_print_percentage);
+    doc["led_status_str"] = status_str;
+  } else {
+    doc["led_status_str"] = led.label;
   }
-  doc["light_mode_extra"] = light_mode_extra;
-
-  uint32_t current_color_val = config.led_color_idle;
-  int current_bright_val = config.led_bright_idle;
-  bool is_printing = false;
-
-  if (current_error_state) {
-      current_color_val = config.led_color_error;
-      current_bright_val = config.led_bright_error;
-  } else if (current_gcode_state == "PAUSED") {
-      current_color_val = config.led_color_pause;
-      current_bright_val = config.led_bright_pause;
-  } else if (current_gcode_state == "FINISH") {
-      bool timeout_enabled = config.led_finish_timeout;
-      bool timer_active = (finishTime > 0 && (millis() - finishTime < FINISH_LIGHT_TIMEOUT));
-      if (!timeout_enabled || timer_active) {
-          current_color_val = config.led_color_finish;
-          current_bright_val = config.led_bright_finish;
-      } else {
-          // If timeout is done, use idle color
-          current_color_val = config.led_color_idle;
-          current_bright_val = config.led_bright_idle;
+  doc["led_status_class"] = led.css_class;
+
+  // Latest printer command (printer_commands.h)
+  const PrinterCommand* cmd = lastPrinterCommand();
+  if (cmd) {
+    JsonObject command = doc.createNestedObject("printer_command");
+    command["seq"] = cmd->seq;
+    command["command"] = PRINTER_COMMAND_NAMES[cmd->type];
+    command["state"] = PRINTER_COMMAND_STATE_NAMES[cmd->state];
+    if (cmd->state == PRINTER_CMD_DONE || cmd->state == PRINTER_CMD_FAILED) command["rtt_ms"] = cmd->rtt_us / 1000;
+  }
+
+  // Active HMS codes, most severe first. Descriptions are flash strings, which
+  // the document stores by pointer.
+  JsonArray hms = doc.createNestedArray("hms");
+  for (uint8_t i = 0; i < hmsCount(); i++) {
+    const HmsEntry& e = hmsAt(i);
+    char code[20];
+    formatHmsCode(e, code, sizeof(code));
+    JsonObject item = hms.createNestedObject();
+    item["code"] = code;
+    item["severity"] = hmsSeverityName(hmsSeverity(e.code));
+    item["module"] = hmsModuleName(e.attr);
+    if (e.description) item["description"] = e.description;
+  }
+  if (hmsReported() > hmsCount()) doc["hms_more"] = hmsReported() - hmsCount();
+
+  // AMS units and trays; empty slots are null. The model is static, so its
+  // strings are passed as const char* and stored by pointer.
+  bool anyAms = false;
+  for (uint8_t u = 0; u < AMS_MAX_UNITS; u++) anyAms |= amsUnit(u).present;
+  if (anyAms) {
+    JsonObject ams = doc.createNestedObject("ams");
+    ams["version"] = amsVersion();
+    if (amsTrayNow() != AMS_TRAY_NONE) ams["tray_now"] = amsTrayNow();
+    JsonArray units = ams.createNestedArray("units");
+    for (uint8_t u = 0; u < AMS_MAX_UNITS; u++) {
+      const AmsUnit& unit = amsUnit(u);
+      if (!unit.present) continue;
+      JsonObject item = units.createNestedObject();
+      item["id"] = u;
+      if (unit.humidity >= 0) item["humidity"] = unit.humidity;
+      item["temp"] = unit.temp;
+      JsonArray trays = item.createNestedArray("trays");
+      for (const AmsTray& tray : unit.trays) {
+        if (!tray.loaded) {
+          trays.add(nullptr);
+          continue;
+        }
+        JsonObject t = trays.createNestedObject();
+        t["color"] = (const char*)tray.color_hex;
+        t["type"] = (const char*)tray.type;
+        if (tray.remain >= 0) t["remain"] = tray.remain;
       }
-  } else if (current_print_percentage > 0 && current_gcode_state != "IDLE") {
-      current_color_val = config.led_color_print;
-      current_bright_val = config.led_bright_print;
-      is_printing = true;
-  }
-  doc["led_color_val"] = current_color_val;
-  doc["led_bright_val"] = current_bright_val;
-  doc["is_printing"] = is_printing;
-
-  String led_status_str;
-  String led_status_class;
-  if (config.num_leds == 0) {
-    led_status_str = "Disabled";
-    led_status_class = "disconnected";
-  }
-  else if (current_error_state) {
-    led_status_str = "Error (Blinking Red)";
-    led_status_class = "error";
-  }
-  else if (current_gcode_state == "PAUSED") {
-    led_status_str = "Paused (Pulsing Orange)";
-    led_status_class = "warning";
-  }
-  else if (current_gcode_state == "FINISH") {
-    bool timeout_enabled = config.led_finish_timeout;
-    bool timer_active = (finishTime > 0 && (millis() - finishTime < FINISH_LIGHT_TIMEOUT));
-    if (!timeout_enabled || timer_active) {
-        led_status_str = "Print Finished (Green)";
-        if(timeout_enabled) led_status_str += " (Timing out...)";
-        led_status_class = "connected";
-    } else {
-        led_status_str = "Idle (Finish Timeout)";
-        led_status_class = "light-on";
     }
   }
-  else if (current_print_percentage > 0) {
-    led_status_str = "Printing Progress (" + String(current_print_percentage) + "%)";
-    led_status_class = "warning";
-  }
-  else {
-    led_status_str = "Idle/Off";
-    led_status_class = "light-on";
+
+  // Milliseconds since power-on per startup phase; phases not reached are omitted
+  JsonObject boot = doc.createNestedObject("boot");
+  for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+    uint32_t ms = bootMarkMs((BootPhase)i);
+    if (ms) boot[bootPhaseName((BootPhase)i)] = ms;
   }
-  doc["led_status_str"] = led_status_str;
-  doc["led_status_class"] = led_status_class;
+}
+
+void encodeStatusFrame(StatusFrame& frame) {
+  memset(&frame, 0, sizeof(frame));
+  frame.magic = STATUS_FRAME_MAGIC;
+  frame.frame_version = STATUS_FRAME_VERSION;
+  frame.status_version = getStatusVersion();
+
+  const LedPlan& led = getLedPlan();
+
+  uint16_t flags = 0;
+  if (client.connected()) flags |= STATUS_FLAG_MQTT_CONNECTED;
+  if (external_light_is_on) flags |= STATUS_FLAG_LIGHT_ON;
+  if (manual_light_control) flags |= STATUS_FLAG_MANUAL_CONTROL;
+  if (led.effect == LED_EFFECT_PROGRESS) flags |= STATUS_FLAG_IS_PRINTING;
+  if (config.invert_output) flags |= STATUS_FLAG_INVERT_OUTPUT;
+  if (printer_state_stale) flags |= STATUS_FLAG_STATE_STALE;
+  frame.flags = flags;
+
+  frame.gcode_state = gcodeStateCode(current_gcode_state.c_str());
+  frame.print_percentage = constrain(current_print_percentage, 0, 100);
+  frame.stage = current_stage;
+  frame.layer_num = constrain(current_layer, 0, 65535);
+  frame.time_remaining = current_time_remaining;
+  frame.nozzle_temp_x10 = lroundf(current_nozzle_temp * 10);
+  frame.nozzle_target_x10 = lroundf(current_nozzle_target_temp * 10);
+  frame.bed_temp_x10 = lroundf(current_bed_temp * 10);
+  frame.bed_target_x10 = lroundf(current_bed_target_temp * 10);
+  // Printer reports e.g. "-45dBm"; anything unparsable becomes 0
+  frame.wifi_signal_dbm = constrain(atoi(current_wifi_signal.c_str()), -128, 0);
+
+  frame.bambu_light_mode = lightModeCode(current_light_mode.c_str());
+  frame.chamber_bright = external_light_is_on ? getChamberLightLevel() : config.chamber_pwm_brightness;
+  frame.light_extra = getLightExtra();
+  frame.led_status = led.status;
+  frame.led_bright = led.bright;
+  frame.led_color[0] = (led.color >> 16) & 0xFF;
+  frame.led_color[1] = (led.color >> 8) & 0xFF;
+  frame.led_color[2] = led.color & 0xFF;
+
+  frame.light_pin = config.chamber_light_pin;
+  frame.led_pin = LED_DATA_PIN;
+  frame.num_leds = config.num_leds;
+  frame.details_version = getStatusDetailsVersion();
 }
 
 // --- New function to broadcast to WebSockets (Suggestion 3) ---
 void broadcastWebSocketStatus() {
-  DynamicJsonDocument doc(1024);
-  createStatusJson(doc); // Create the JSON
-  
-  String json_output;
-  serializeJson(doc, json_output);
-  
-  // Send it to ALL connected web clients
-  webSocket.broadcastTXT(json_output);
+  // Each client gets the latest status as soon as its rate limit allows;
+  // anything still pending is picked up again from loop()
+#if ENABLE_WEBSOCKET
+  serviceWebSocketClients();
+#endif
+  serviceSseClients();
 }
 
+#if ENABLE_WEBSOCKET
+void handleWsStatsJson() {
+  ChunkedResponse out(server);
+  out.begin(200, "application/json");
+  out.printf("{\"status_version\":%u,\"max_rate_hz\":%d,",
+             (unsigned)getStatusVersion(), config.ws_max_rate_hz);
+  size_t json_len, frame_len;
+  getStatusJson(&json_len);
+  getStatusFrame(&frame_len);
+  out.printf("\"encode\":{\"json_bytes\":%u,\"json_us\":%u,\"binary_bytes\":%u,\"binary_us\":%u},\"clients\":[",
+             (unsigned)json_len, (unsigned)getStatusJsonEncodeUs(),
+             (unsigned)frame_len, (unsigned)getStatusFrameEncodeUs());
+  bool first = true;
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    const WsClientStats& c = getWsClientStats(num);
+    if (!c.connected) continue;
+    IPAddress ip = webSocket.remoteIP(num);
+    out.printf("%s{\"id\":%u,\"ip\":\"%d.%d.%d.%d\",\"binary\":%s,\"slow\":%s,\"interval_ms\":%u,",
+               first ? "" : ",", num, ip[0], ip[1], ip[2], ip[3], c.binary ? "true" : "false",
+               c.slow ? "true" : "false", (unsigned)c.interval_ms);
+    out.printf("\"pending\":%s,\"frames_sent\":%u,\"frames_coalesced\":%u,\"bytes_sent\":%u,",
+               c.sent_version != getStatusVersion() ? "true" : "false",
+               (unsigned)c.frames_sent, (unsigned)c.frames_coalesced, (unsigned)c.bytes_sent);
+    out.printf("\"last_send_us\":%u,\"max_send_us\":%u,\"slow_sends\":%u,\"send_failures\":%u}",
+               (unsigned)c.last_send_us, (unsigned)c.max_send_us, (unsigned)c.slow_sends, (unsigned)c.total_failures);
+    first = false;
+  }
+  out.print("]}");
+  out.end();
+}
+#endif
+
 // --- Updated HTTP handler (Suggestion 3) ---
 void handleStatusJson() {
-  DynamicJsonDocument doc(1024);
-  createStatusJson(doc); // Call the new function
-  
-  String json_output;
-  serializeJson(doc, json_output);
-  server.send(200, "application/json", json_output);
+  char etag[32];
+  getStatusEtag(etag, sizeof(etag));
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "no-cache");
+
+  // Pollers get a 304 until the state version moves on
+  if (server.header("If-None-Match") == etag) {
+    server.send(304);
+    return;
+  }
+
+  size_t len;
+  const char* json = getStatusJson(&len);
+  server.send_P(200, "application/json", json, len);
 }
 
 void handleMqttJson() {
-  Serial.println("Web Request: /mqtt (View JSON History)");
-  
-  String html = FPSTR(PAGE_MQTT);
-  html.replace("{{MSG_COUNT}}", String(mqtt_history.size()));
-  html.replace("{{MAX_COUNT}}", String(MAX_HISTORY_SIZE));
-  
-  String log_html = "";
-  if(mqtt_history.empty()) {
-    log_html = "No data received yet.";
+  LOG_DEBUG("Web Request: /mqtt (View JSON History)");
+
+  // Static shell; the log itself is paged in from /mqtt/history.json
+  const WebAsset* asset = findWebAsset("/mqtt");
+  if (asset) {
+    sendWebAsset(*asset);
   } else {
-    // --- Updated for Highlighted Log ---
-    for(const auto& entry : mqtt_history) {
-      String msg = entry.message;
-      msg.replace("<", "&lt;");
-      msg.replace(">", "&gt;");
-      if(entry.highlight) {
-        log_html += "<span class='highlight'>" + msg + "</span>\n";
-      } else {
-        log_html += msg + "\n";
-      }
+    server.send(500, "text/plain", "MQTT history page asset missing.");
+  }
+}
+
+#if ENABLE_PROFILER
+void handleProfilePage() {
+  const WebAsset* asset = findWebAsset("/profile");
+  if (asset) {
+    sendWebAsset(*asset);
+  } else {
+    server.send(500, "text/plain", "Profile page asset missing.");
+  }
+}
+#endif
+
+// --- Cursor API for the MQTT history ---
+// GET /mqtt/history.json?after=<seq>&limit=N[&highlight_only=1][&format=ndjson]
+// Entries are streamed straight out of the history arena, so peak memory per request
+// is one ChunkedResponse buffer no matter how large the stored messages are.
+void handleMqttHistoryJson() {
+  uint32_t after = server.hasArg("after") ? strtoul(server.arg("after").c_str(), NULL, 10) : 0;
+  int limit = server.hasArg("limit") ? server.arg("limit").toInt() : MQTT_HISTORY_PAGE_DEFAULT;
+  limit = constrain(limit, 1, MQTT_HISTORY_PAGE_MAX);
+  bool highlightOnly = server.arg("highlight_only") == "1";
+  bool ndjson = server.arg("format") == "ndjson";
+
+  // A cursor from before a reboot is ahead of the counter; start over
+  bool gap = false;
+  if (after >= mqtt_history_next_seq) {
+    after = 0;
+    gap = true;
+  }
+
+  // Sequence numbers are contiguous, so the cursor maps straight to an index
+  uint32_t firstSeq = mqttHistoryCount() == 0 ? mqtt_history_next_seq : mqttHistoryAt(0).seq;
+  if (after != 0 && after + 1 < firstSeq) gap = true; // Entries were evicted
+  size_t index = (after + 1 <= firstSeq) ? 0 : (after + 1 - firstSeq);
+
+  ChunkedResponse out(server);
+  out.begin(200, ndjson ? "application/x-ndjson" : "application/json");
+  if (!ndjson) {
+    out.printf("{\"first\":%u,\"last\":%u,\"max\":%d,\"gap\":%s,\"entries\":[",
+               (unsigned)firstSeq, (unsigned)(mqtt_history_next_seq - 1), MAX_HISTORY_SIZE,
+               gap ? "true" : "false");
+  }
+
+  uint32_t next = (after < firstSeq) ? firstSeq - 1 : after;
+  int sent = 0;
+  for (; index < mqttHistoryCount() && sent < limit; index++) {
+    MqttLogEntry entry = mqttHistoryAt(index);
+    next = entry.seq;
+    if (highlightOnly && !entry.highlight) continue;
+
+    if (!ndjson && sent > 0) out.write(",", 1);
+    out.printf("{\"seq\":%u,\"hl\":%s,\"msg\":", (unsigned)entry.seq, entry.highlight ? "true" : "false");
+    out.printJsonString(entry.message);
+    out.write(ndjson ? "}\n" : "}", ndjson ? 2 : 1);
+    sent++;
+  }
+
+  if (!ndjson) {
+    bool more = index < mqttHistoryCount();
+    out.printf("],\"next\":%u,\"more\":%s}", (unsigned)next, more ? "true" : "false");
+  }
+  out.end();
+}
+
+// --- Temperature / progress history ---
+// GET /history.json?range=<seconds>[&tier=0..2]
+// Picks the finest tier that covers the range (or the requested one) and
+// streams its most recent slots, oldest first. Values are scaled integers
+// (see "scale"); tier 0 rows hold one value per channel, coarser tiers hold
+// avg,min,max per channel. Slots without data are null.
+static void printHistoryValue(ChunkedResponse& out, int16_t value) {
+  if (value == HISTORY_NO_DATA) out.print("null");
+  else out.printf("%d", value);
+}
+
+void handleHistoryJson() {
+  if (!historyAvailable()) {
+    server.send(503, "text/plain", "History not available.");
+    return;
+  }
+
+  uint32_t range = server.hasArg("range") ? strtoul(server.arg("range").c_str(), NULL, 10) : 600;
+  if (range == 0) range = 600;
+  uint8_t tier = 0;
+  if (server.hasArg("tier")) {
+    tier = constrain(server.arg("tier").toInt(), 0, HISTORY_TIER_COUNT - 1);
+  } else {
+    while (tier + 1 < HISTORY_TIER_COUNT &&
+           (uint32_t)HISTORY_TIERS[tier].step_s * HISTORY_TIERS[tier].slots < range) {
+      tier++;
     }
   }
-  html.replace("{{MQTT_LOGS}}", log_html);
 
-  server.send(200, "text/html", html);
+  const HistoryTierSpec& spec = HISTORY_TIERS[tier];
+  uint32_t wanted = (range + spec.step_s - 1) / spec.step_s;
+  uint16_t count = historyCount(tier);
+  uint16_t first = wanted < count ? count - wanted : 0;
+  bool aggregated = tier > 0;
+
+  ChunkedResponse out(server);
+  out.begin(200, "application/json");
+  out.printf("{\"tier\":%u,\"step\":%u,\"end_age\":%u,\"count\":%u,\"fields\":\"%s\",\"channels\":[",
+             tier, spec.step_s, (unsigned)(historyUptime() - historyTierEnd(tier)),
+             (unsigned)(count - first), aggregated ? "avg,min,max" : "avg");
+  for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) {
+    out.printf("%s\"%s\"", ch ? "," : "", HISTORY_CHANNEL_NAMES[ch]);
+  }
+  out.print("],\"scale\":[");
+  for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) {
+    out.printf("%s%u", ch ? "," : "", HISTORY_CHANNEL_SCALE[ch]);
+  }
+  out.print("],\"rows\":[");
+
+  for (uint16_t i = first; i < count; i++) {
+    const HistorySample* row = historySlot(tier, i);
+    out.print(i == first ? "[" : ",[");
+    for (uint8_t ch = 0; ch < HIST_CHANNEL_COUNT; ch++) {
+      if (ch) out.write(",", 1);
+      printHistoryValue(out, row[ch].avg);
+      if (aggregated) {
+        out.write(",", 1);
+        printHistoryValue(out, row[ch].min);
+        out.write(",", 1);
+        printHistoryValue(out, row[ch].max);
+      }
+    }
+    out.write("]", 1);
+  }
+  out.print("]}");
+  out.end();
 }
 
 void handleLightOn() {
-  Serial.println("Web Request: /light/on");
+  LOG_INFO("Web Request: /light/on");
   manual_light_control = true;
   setChamberLightState(true);
   
-  if (server.client().remoteIP().toString() != "") {
+  if ((uint32_t)server.client().remoteIP() != 0) {
     // Request came from HTTP
     server.sendHeader("Location", "/");
     server.send(302, "text/plain", "");
@@ -736,11 +736,11 @@ void handleLightOn() {
 }
 
 void handleLightOff() {
-  Serial.println("Web Request: /light/off");
+  LOG_INFO("Web Request: /light/off");
   manual_light_control = true;
   setChamberLightState(false);
   
-  if (server.client().remoteIP().toString() != "") {
+  if ((uint32_t)server.client().remoteIP() != 0) {
     server.sendHeader("Location", "/");
     server.send(302, "text/plain", "");
   }
@@ -748,38 +748,97 @@ void handleLightOff() {
 }
 
 void handleLightAuto() {
-  Serial.println("Web Request: /light/auto");
+  LOG_INFO("Web Request: /light/auto");
   manual_light_control = false;
-  bool lightShouldBeOn = (current_light_mode == "on" || current_light_mode == "flashing");
-  bool finalLightState = lightShouldBeOn;
+  updateAutomaticLight();
+  markStatusChanged(); // manual_control is part of the status
 
-  if (config.chamber_light_finish_timeout && finishTime > 0) {
-      if (millis() - finishTime < FINISH_LIGHT_TIMEOUT) {
-          finalLightState = true;
-      } else {
-          finalLightState = false;
-      }
-  }
-  setChamberLightState(finalLightState);
-
-  if (server.client().remoteIP().toString() != "") {
+  if ((uint32_t)server.client().remoteIP() != 0) {
     server.sendHeader("Location", "/");
     server.send(302, "text/plain", "");
   }
   // This will be broadcast by the WebSocket handler in the .ino
 }
 
+// Writes the value for one {{NAME}} placeholder of PAGE_CONFIG
+static void printConfigField(ChunkedResponse& out, const char* name) {
+  auto is = [name](const char* key) { return strcmp(name, key) == 0; };
+  auto check = [&out](bool on) { if (on) out.print("checked"); };
+  auto color = [&out](uint32_t rgb) { out.printf("%06X", (unsigned)(rgb & 0xFFFFFF)); };
+
+  if (is("CONFIG_CSS")) out.print(WEB_ASSET_CONFIG_CSS_URI);
+  else if (is("CONFIG_JS")) out.print(WEB_ASSET_CONFIG_JS_URI);
+  else if (is("BBL_IP")) out.printHtml(config.bbl_ip);
+  else if (is("BBL_SERIAL")) out.printHtml(config.bbl_serial);
+  else if (is("BBL_CODE")) out.printHtml(config.bbl_access_code);
+  else if (is("NTP_SERVER")) out.printHtml(config.ntp_server);
+  else if (is("TZ_DROPDOWN")) printTimezoneDropdown(out, config.timezone);
+  else if (is("LIGHT_PIN")) out.printf("%d", config.chamber_light_pin);
+  else if (is("CHAMBER_BRIGHT")) out.printf("%d", config.chamber_pwm_brightness);
+  else if (is("INVERT_CHECK")) check(config.invert_output);
+  else if (is("CHAMBER_TIMEOUT_CHECK")) check(config.chamber_light_finish_timeout);
+  else if (is("MAX_LEDS")) out.printf("%d", MAX_LEDS);
+  else if (is("NUM_LEDS")) out.printf("%d", config.num_leds);
+  else if (is("AMS_LEDS")) out.printf("%d", config.ams_leds);
+  else if (is("LED_ORDER_DROPDOWN")) printLedOrderDropdown(out, config.led_color_order);
+  else if (is("LED_PIN")) out.printf("%d", LED_DATA_PIN);
+  else if (is("LED_TIMEOUT_CHECK")) check(config.led_finish_timeout);
+  else if (is("VLED_PREVIEW")) {
+    if (config.num_leds == 0) {
+      out.print("<div style='flex-grow: 1; height: 100%; text-align: center; color: #888; padding-top: 5px; font-size: 0.9em;'>LEDs disabled</div>");
+    }
+    for (int i = 0; i < config.num_leds && i < MAX_LEDS; i++) {
+      out.print("<div class='vled' style='flex-grow: 1; height: 100%;'></div>");
+    }
+  }
+  else if (is("IDLE_COLOR")) color(config.led_color_idle);
+  else if (is("IDLE_BRIGHT")) out.printf("%d", config.led_bright_idle);
+  else if (is("PRINT_COLOR")) color(config.led_color_print);
+  else if (is("PRINT_BRIGHT")) out.printf("%d", config.led_bright_print);
+  else if (is("PAUSE_COLOR")) color(config.led_color_pause);
+  else if (is("PAUSE_BRIGHT")) out.printf("%d", config.led_bright_pause);
+  else if (is("ERROR_COLOR")) color(config.led_color_error);
+  else if (is("ERROR_BRIGHT")) out.printf("%d", config.led_bright_error);
+  else if (is("FINISH_COLOR")) color(config.led_color_finish);
+  else if (is("FINISH_BRIGHT")) out.printf("%d", config.led_bright_finish);
+  else if (is("MAX_WS_RATE")) out.printf("%d", MAX_WS_RATE_HZ);
+  else if (is("WS_RATE")) out.printf("%d", config.ws_max_rate_hz);
+  else if (is("BRIDGE_HOST")) out.printHtml(config.bridge_host);
+  else if (is("BRIDGE_PORT")) out.printf("%u", (unsigned)config.bridge_port);
+  else if (is("BRIDGE_USER")) out.printHtml(config.bridge_user);
+  else if (is("BRIDGE_PASS")) out.printHtml(config.bridge_pass);
+  else if (is("BRIDGE_PREFIX")) out.printHtml(config.bridge_prefix);
+  else if (is("MAX_BRIDGE_RATE")) out.printf("%d", MAX_BRIDGE_RATE_HZ);
+  else if (is("BRIDGE_RATE")) out.printf("%d", config.bridge_max_rate_hz);
+  else if (is("BRIDGE_DEADBAND")) out.printf("%.1f", config.bridge_temp_deadband);
+  else if (is("BRIDGE_DISCOVERY_CHECK")) check(config.bridge_discovery);
+  else if (is("PRINTER_CONTROL_CHECK")) check(config.printer_control);
+  else if (is("RULES_MAX")) out.printf("%d", RULES_TEXT_MAX - 1);
+  else if (is("RULES")) out.printHtml(config.rules);
+}
+
+// Streams PAGE_CONFIG, filling each {{NAME}} on the way out instead of
+// building the page in a String
+static void printConfigPage(ChunkedResponse& out) {
+  const char* p = PAGE_CONFIG;
+  const char* open;
+  while ((open = strstr(p, "{{")) != nullptr) {
+    const char* close = strstr(open + 2, "}}");
+    if (!close) break;
+    out.write(p, open - p);
+    char name[32];
+    size_t len = min((size_t)(close - open - 2), sizeof(name) - 1);
+    memcpy(name, open + 2, len);
+    name[len] = '\0';
+    printConfigField(out, name);
+    p = close + 2;
+  }
+  out.print(p);
+}
+
 void handleConfig() {
   if (server.method() == HTTP_POST) {
-    Serial.println("Web Request: POST /config - Saving settings...");
-    
-    // --- DEBUGGING ---
-    Serial.println("--- FORM ARGUMENTS RECEIVED ---");
-    for (uint8_t i = 0; i < server.args(); i++) {
-      Serial.printf("ARG[%d]: %s = %s\n", i, server.argName(i).c_str(), server.arg(i).c_str());
-    }
-    Serial.println("---------------------------------");
-    // --- END DEBUGGING ---
+    LOG_INFO("Web Request: POST /config - Saving settings...");
 
     Config tempConfig = config;
 
@@ -795,7 +854,7 @@ void handleConfig() {
       if (isValidGpioPin(tempLightPin)) {
           tempConfig.chamber_light_pin = tempLightPin;
       } else {
-          Serial.printf("ERROR: Invalid GPIO pin %d submitted. Retaining previous pin.\n", tempLightPin);
+          LOG_WARN("Invalid GPIO pin %d submitted. Retaining previous pin.", tempLightPin);
       }
     }
     tempConfig.invert_output = server.hasArg("invert");
@@ -803,31 +862,21 @@ void handleConfig() {
     tempConfig.chamber_light_finish_timeout = server.hasArg("chamber_timeout");
 
 
-    // --- MODIFIED FOR DEBUGGING ---
+    // An empty or out-of-range LED count keeps the previous value
     if (server.hasArg("numleds")) {
-      Serial.println("Found 'numleds' argument.");
       String numLedsStr = server.arg("numleds");
-      Serial.printf("'numleds' value as string: '%s'\n", numLedsStr.c_str());
       int tempNumLeds = numLedsStr.toInt();
-      Serial.printf("'numleds' value as int: %d\n", tempNumLeds);
-      
       if (numLedsStr.length() > 0 && tempNumLeds >= 0 && tempNumLeds <= MAX_LEDS) {
-          Serial.printf("Setting num_leds to %d\n", tempNumLeds);
           tempConfig.num_leds = tempNumLeds;
-      } else if (numLedsStr.length() == 0) {
-          Serial.println("WARNING: 'numleds' was empty string. Retaining previous value.");
-          // Do nothing, retain config.num_leds
       } else {
-          Serial.printf("WARNING: Invalid LED count (%d). Retaining previous value.\n", tempNumLeds);
-          // Do nothing, retain config.num_leds
+          LOG_WARN("Invalid LED count '%s'. Retaining previous value.", numLedsStr.c_str());
       }
     } else {
-      Serial.println("WARNING: 'numleds' argument was NOT found. Retaining previous value.");
-      // Do nothing, retain config.num_leds
+      LOG_WARN("'numleds' argument was not found. Retaining previous value.");
     }
-    // --- END MODIFICATION ---
 
     tempConfig.led_finish_timeout = server.hasArg("led_finish_timeout");
+    if (server.hasArg("ams_leds")) tempConfig.ams_leds = constrain(server.arg("ams_leds").toInt(), 0, MAX_LEDS);
     if (server.hasArg("led_color_order")) strlcpy(tempConfig.led_color_order, server.arg("led_color_order").c_str(), sizeof(tempConfig.led_color_order));
 
     if (server.hasArg("idle_color")) tempConfig.led_color_idle = strtoul(server.arg("idle_color").c_str(), NULL, 16);
@@ -842,87 +891,86 @@ void handleConfig() {
     if (server.hasArg("error_bright")) tempConfig.led_bright_error = constrain(server.arg("error_bright").toInt(), 0, 255);
     if (server.hasArg("finish_bright")) tempConfig.led_bright_finish = constrain(server.arg("finish_bright").toInt(), 0, 255);
 
-    config = tempConfig;
-    Serial.printf("Saving config with num_leds = %d\n", config.num_leds);
-    saveConfig();
-
-    String html = "<!DOCTYPE html><html><head><title>Saving...</title>";
-    html += "<meta http-equiv='refresh' content='3;url=/'><style>body{font-family:Arial,sans-serif;background:#1a1a1b;color:#e0e0e0;}</style></head>";
-    html += "<body><h2>Configuration Saved.</h2>";
-    html += "<p>Device is rebooting to apply settings. You will be redirected in 3 seconds...</p></body></html>";
-    server.send(200, "text/html", html);
-    delay(1000);
-    ESP.restart();
-  }
-  else {
-    Serial.println("Web Request: GET /config - Showing settings page...");
-    Serial.printf("Current config.num_leds = %d\n", config.num_leds);
-    
-    String html = FPSTR(PAGE_CONFIG);
-
-    html.replace("{{BBL_IP}}", String(config.bbl_ip));
-    html.replace("{{BBL_SERIAL}}", String(config.bbl_serial));
-    html.replace("{{BBL_CODE}}", String(config.bbl_access_code));
-    html.replace("{{NTP_SERVER}}", String(config.ntp_server));
-    html.replace("{{TZ_DROPDOWN}}", getTimezoneDropdown(String(config.timezone)));
-    html.replace("{{LIGHT_PIN}}", String(config.chamber_light_pin));
-    html.replace("{{CHAMBER_BRIGHT}}", String(config.chamber_pwm_brightness));
-    html.replace("{{INVERT_CHECK}}", (config.invert_output ? "checked" : ""));
-    html.replace("{{CHAMBER_TIMEOUT_CHECK}}", (config.chamber_light_finish_timeout ? "checked" : ""));
-    html.replace("{{MAX_LEDS}}", String(MAX_LEDS));
-    html.replace("{{NUM_LEDS}}", String(config.num_leds));
-    html.replace("{{LED_ORDER_DROPDOWN}}", getLedOrderDropdown(String(config.led_color_order)));
-    html.replace("{{LED_PIN}}", String(LED_DATA_PIN));
-    html.replace("{{LED_TIMEOUT_CHECK}}", (config.led_finish_timeout ? "checked" : ""));
-
-    String vled_preview_html = "";
-    for(int i=0; i < config.num_leds && i < MAX_LEDS; i++) {
-      vled_preview_html += "<div class='vled' style='flex-grow: 1; height: 100%;'></div>";
+    if (server.hasArg("ws_rate")) tempConfig.ws_max_rate_hz = constrain(server.arg("ws_rate").toInt(), 1, MAX_WS_RATE_HZ);
+
+    if (server.hasArg("bridge_host")) strlcpy(tempConfig.bridge_host, server.arg("bridge_host").c_str(), sizeof(tempConfig.bridge_host));
+    if (server.hasArg("bridge_port")) tempConfig.bridge_port = constrain(server.arg("bridge_port").toInt(), 1, 65535);
+    if (server.hasArg("bridge_user")) strlcpy(tempConfig.bridge_user, server.arg("bridge_user").c_str(), sizeof(tempConfig.bridge_user));
+    if (server.hasArg("bridge_pass")) strlcpy(tempConfig.bridge_pass, server.arg("bridge_pass").c_str(), sizeof(tempConfig.bridge_pass));
+    if (server.hasArg("bridge_prefix") && server.arg("bridge_prefix").length()) {
+      strlcpy(tempConfig.bridge_prefix, server.arg("bridge_prefix").c_str(), sizeof(tempConfig.bridge_prefix));
     }
-    if (config.num_leds == 0) {
-       vled_preview_html = "<div style='flex-grow: 1; height: 100%; text-align: center; color: #888; padding-top: 5px; font-size: 0.9em;'>LEDs disabled</div>";
+    if (server.hasArg("bridge_rate")) tempConfig.bridge_max_rate_hz = constrain(server.arg("bridge_rate").toInt(), 1, MAX_BRIDGE_RATE_HZ);
+    if (server.hasArg("bridge_deadband")) tempConfig.bridge_temp_deadband = constrain(server.arg("bridge_deadband").toFloat(), 0.0f, 50.0f);
+    tempConfig.bridge_discovery = server.hasArg("bridge_discovery");
+    tempConfig.printer_control = server.hasArg("printer_control");
+
+    // Rules that don't compile are rejected; the previous rules stay active
+    char rulesError[RULE_ERROR_MAX] = "";
+    if (server.hasArg("rules")) {
+      static RuleTable checked; // ~1 KB, kept off the stack
+      String rulesText = server.arg("rules");
+      if (rulesText.length() >= RULES_TEXT_MAX) {
+        snprintf(rulesError, sizeof(rulesError), "longer than %d characters", RULES_TEXT_MAX - 1);
+      } else if (compileRules(rulesText.c_str(), checked, rulesError)) {
+        strlcpy(tempConfig.rules, rulesText.c_str(), sizeof(tempConfig.rules));
+      }
+      if (rulesError[0]) LOG_WARN("Rules rejected: %s", rulesError);
     }
-    html.replace("{{VLED_PREVIEW}}", vled_preview_html);
-    
-    char hexColor[7];
-    snprintf(hexColor, 7, "%06X", config.led_color_idle);
-    html.replace("{{IDLE_COLOR}}", String(hexColor));
-    html.replace("{{IDLE_BRIGHT}}", String(config.led_bright_idle));
-    
-    snprintf(hexColor, 7, "%06X", config.led_color_print);
-    html.replace("{{PRINT_COLOR}}", String(hexColor));
-    html.replace("{{PRINT_BRIGHT}}", String(config.led_bright_print));
 
-    snprintf(hexColor, 7, "%06X", config.led_color_pause);
-    html.replace("{{PAUSE_COLOR}}", String(hexColor));
-    html.replace("{{PAUSE_BRIGHT}}", String(config.led_bright_pause));
-    
-    snprintf(hexColor, 7, "%06X", config.led_color_error);
-    html.replace("{{ERROR_COLOR}}", String(hexColor));
-    html.replace("{{ERROR_BRIGHT}}", String(config.led_bright_error));
-    
-    snprintf(hexColor, 7, "%06X", config.led_color_finish);
-    html.replace("{{FINISH_COLOR}}", String(hexColor));
-    html.replace("{{FINISH_BRIGHT}}", String(config.led_bright_finish));
+    Config previous = config;
+    config = tempConfig;
+    LOG_DEBUG("Saving config with num_leds = %d", config.num_leds);
+    char applied[96];
+    {
+      // LittleFS writes and re-initializing the drivers (MQTT, LEDs, SNTP)
+      // allocate inside the libraries
+      HEAP_GUARD_EXEMPT();
+      saveConfig();
+      applyConfigChanges(previous, applied, sizeof(applied));
+    }
 
-    server.send(200, "text/html", html);
+    ChunkedResponse out(server);
+    out.begin(200, "text/html");
+    out.print("<!DOCTYPE html><html><head><title>Saved</title>");
+    // Give time to read a rules error, then go back to fix it
+    bool rulesRejected = rulesError[0] != '\0';
+    out.print(rulesRejected ? "<meta http-equiv='refresh' content='10;url=/config'>" : "<meta http-equiv='refresh' content='3;url=/'>");
+    out.print("<style>body{font-family:Arial,sans-serif;background:#1a1a1b;color:#e0e0e0;}</style></head>");
+    out.print("<body><h2>Configuration Saved.</h2>");
+    if (applied[0]) out.printf("<p>Re-initialized: %s.</p>", applied);
+    if (rulesRejected) {
+      out.print("<p>Rules not changed: ");
+      out.printHtml(rulesError);
+      out.print("</p>");
+    }
+    out.print(rulesRejected ? "<p>Other settings are active now. Returning to settings in 10 seconds...</p></body></html>"
+                            : "<p>Settings are active now. You will be redirected in 3 seconds...</p></body></html>");
+    out.end();
+  }
+  else {
+    LOG_DEBUG("Web Request: GET /config - Showing settings page...");
+    ChunkedResponse out(server);
+    out.begin(200, "text/html");
+    printConfigPage(out);
+    out.end();
   }
 }
 
 void handleBackup() {
-  Serial.println("Web Request: /backup");
-  if (!LittleFS.exists("/config.json")) {
-    server.send(404, "text/plain", "Config file not found.");
-    return;
-  }
-  File configFile = LittleFS.open("/config.json", "r");
+  LOG_INFO("Web Request: /backup");
+  // The stored config is binary; backups stay JSON so they can be edited
+  JsonLease doc;
+  configToJson(config, *doc);
   server.sendHeader("Content-Disposition", "attachment; filename=\"config.json\"");
-  server.streamFile(configFile, "application/json");
-  configFile.close();
+  ChunkedResponse out(server);
+  out.begin(200, "application/json");
+  serializeJsonPretty(*doc, out);
+  out.end();
 }
 
 void handleRestorePage() {
-  Serial.println("Web Request: GET /restore");
+  LOG_DEBUG("Web Request: GET /restore");
   server.send_P(200, "text/html", PAGE_RESTORE);
 }
 
@@ -934,17 +982,18 @@ void handleRestoreUpload() {
 
   if (upload.status == UPLOAD_FILE_START) {
     if (upload.filename != "config.json") {
-      Serial.printf("Invalid restore filename: %s. Aborting.\n", upload.filename.c_str());
+      LOG_WARN("Invalid restore filename: %s. Aborting.", upload.filename.c_str());
       restoreSuccess = false; 
       return;
     }
     
-    Serial.printf("Restore Start: %s\n", upload.filename.c_str());
-    restoreFile = LittleFS.open("/config.json", "w");
+    LOG_INFO("Restore Start: %s", upload.filename.c_str());
+    // Imported into the binary store by loadConfig() on the next boot
+    restoreFile = LittleFS.open(CONFIG_JSON_PATH, "w");
     if (restoreFile) {
       restoreSuccess = true;
     } else {
-      Serial.println("Failed to open /config.json for restore.");
+      LOG_ERROR("Failed to open /config.json for restore.");
       restoreSuccess = false;
     }
   } else if (upload.status == UPLOAD_FILE_WRITE) {
@@ -954,11 +1003,11 @@ void handleRestoreUpload() {
   } else if (upload.status == UPLOAD_FILE_END) {
     if (restoreSuccess && restoreFile) {
       restoreFile.close();
-      Serial.printf("Restore End: %u bytes total\n", upload.totalSize);
+      LOG_INFO("Restore End: %u bytes total", (unsigned)upload.totalSize);
     } else {
       if(restoreFile) restoreFile.close();
       if(restoreSuccess) {
-         Serial.println("Restore failed during write/end.");
+         LOG_ERROR("Restore failed during write/end.");
          restoreSuccess = false;
       }
     }
@@ -967,20 +1016,12 @@ void handleRestoreUpload() {
 
 void handleRestoreReboot() {
   if (restoreSuccess) {
-    String html = "<!DOCTYPE html><html><head><title>Restore Complete</title>";
-    html += "<meta http-equiv='refresh' content='3;url=/'><style>body{font-family:Arial,sans-serif;background:#1a1a1b;color:#e0e0e0;}</style></head>";
-    html += "<body><h2>Restore Complete.</h2>";
-    html += "<p>Device is rebooting to load new configuration. You will be redirected in 3 seconds...</p></body></html>";
-    server.send(200, "text/html", html);
+    server.send_P(200, "text/html", PAGE_RESTORE_DONE);
     delay(1000);
+    logFlush(); // Queued lines would be lost
     ESP.restart();
   } else {
-    String html = "<!DOCTYPE html><html><head><title>Restore Failed</title>";
-    html += "<style>body{font-family:Arial,sans-serif;margin:20px;background:#1a1a1b;color:#e0e0e0;} a{color:#58a6ff;}</style></head>";
-    html += "<body><h2>Restore Failed.</h2>";
-    html += "<p>The file upload failed. This may be due to an invalid filename (must be 'config.json') or a file system error.</p>";
-    html += "<a href='/restore'>Try again</a> | <a href='/'>Back to Status</a></body></html>";
-    server.send(400, "text/html", html);
+    server.send_P(400, "text/html", PAGE_RESTORE_FAILED);
   }
   restoreSuccess = false;
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #ifndef WEB_HANDLERS_H
 #define WEB_HANDLERS_H
 
-#include <WebServer.h>
+#include "guarded_web_server.h"
 #include <WiFiManager.h>
 #include <FS.h>
 #include <LittleFS.h>
@@ -9,9 +9,10 @@
 #include <FastLED.h>
 #include <ArduinoJson.h> // <-- Include for DynamicJsonDocument
 #include "config.h"
+#include "status_cache.h"
 
 // External declarations from main file
-extern WebServer server;
+extern GuardedWebServer server;
 extern WiFiManager wm;
 extern PubSubClient client;
 extern bool manual_light_control;
@@ -28,6 +29,7 @@ extern int current_time_remaining;
 extern int current_layer;
 extern int current_stage;
 extern String current_wifi_signal;
+extern char wifi_ssid[33]; // Copied once connected, WiFi.SSID() allocates
 extern unsigned long finishTime;
 extern const unsigned long FINISH_LIGHT_TIMEOUT;
 extern File restoreFile;
@@ -66,6 +68,11 @@ bool connectWiFi(bool forceReset);
 void handleRoot();
 void handleStatusJson();
 void handleMqttJson();
+void handleMqttHistoryJson();
+void handleHistoryJson();
+#if ENABLE_PROFILER
+void handleProfilePage();
+#endif
 void handleLightOn();
 void handleLightOff();
 void handleLightAuto();
@@ -76,7 +83,11 @@ void handleRestoreUpload();
 void handleRestoreReboot();
 
 // --- Declarations for WebSocket functions ---
-void createStatusJson(DynamicJsonDocument& doc);
+void createStatusJson(JsonDocument& doc);
+void encodeStatusFrame(StatusFrame& frame);
 void broadcastWebSocketStatus();
+#if ENABLE_WEBSOCKET
+void handleWsStatsJson();
+#endif
 
 #endif
\ No newline at end of file
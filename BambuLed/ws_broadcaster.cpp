@@ -0,0 +1,114 @@
+#include "ws_broadcaster.h"
+#include "status_cache.h"
+#include "metrics.h"
+#include "heap_guard.h"
+#include "logger.h"
+
+#if ENABLE_WEBSOCKET
+
+static WsClientStats ws_clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+
+static uint32_t baseIntervalMs() {
+  int rate = constrain(config.ws_max_rate_hz, 1, MAX_WS_RATE_HZ);
+  return 1000 / rate;
+}
+
+static void sendStatusToClient(uint8_t num) {
+  WsClientStats& c = ws_clients[num];
+  uint32_t version = getStatusVersion();
+
+  if (c.sent_version != 0 && version > c.sent_version + 1) {
+    c.frames_coalesced += version - c.sent_version - 1;
+  }
+
+  size_t len;
+  bool ok;
+  uint32_t start = micros();
+  if (c.binary) {
+    const uint8_t* frame = getStatusFrame(&len);
+    HEAP_GUARD_EXEMPT(); // The library builds the frame header on the heap
+    ok = webSocket.sendBIN(num, frame, len);
+  } else {
+    const char* json = getStatusJson(&len);
+    HEAP_GUARD_EXEMPT();
+    ok = webSocket.sendTXT(num, json, len);
+  }
+  uint32_t elapsed = micros() - start;
+
+  c.last_send_ms = millis();
+  c.last_send_us = elapsed;
+  if (elapsed > c.max_send_us) c.max_send_us = elapsed;
+
+  if (!ok) {
+    c.failures++;
+    c.total_failures++;
+    if (c.failures >= WS_MAX_SEND_FAILURES) {
+      LOG_WARN("[%u] WebSocket client not accepting data, disconnecting.", num);
+      webSocket.disconnect(num);
+    }
+    return;
+  }
+
+  c.failures = 0;
+  c.sent_version = version;
+  c.frames_sent++;
+  c.bytes_sent += len;
+  metricsCount(metrics.ws_frames_sent);
+  metricsCount(metrics.ws_bytes_sent, len);
+
+  // A blocking write means the client is behind: space its frames out more.
+  // Fast writes let the interval decay back to the configured rate.
+  uint32_t base = baseIntervalMs();
+  if (elapsed > WS_SLOW_SEND_US) {
+    c.slow_sends++;
+    c.interval_ms = min(max(c.interval_ms, base) * 2, WS_MAX_BACKOFF_MS);
+    if (!c.slow) LOG_INFO("[%u] WebSocket client is slow (%u us send), backing off.", num, (unsigned)elapsed);
+    c.slow = true;
+  } else if (c.interval_ms > base) {
+    c.interval_ms = max(c.interval_ms / 2, base);
+    if (c.interval_ms == base) c.slow = false;
+  } else {
+    c.interval_ms = base;
+    c.slow = false;
+  }
+}
+
+void wsClientConnected(uint8_t num) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+  ws_clients[num] = WsClientStats();
+  ws_clients[num].connected = true;
+  ws_clients[num].interval_ms = baseIntervalMs();
+  // New clients get the current status straight away
+  sendStatusToClient(num);
+}
+
+void wsClientDisconnected(uint8_t num) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+  ws_clients[num].connected = false;
+}
+
+void wsSetClientBinary(uint8_t num, bool binary) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !ws_clients[num].connected) return;
+  if (ws_clients[num].binary == binary) return;
+  ws_clients[num].binary = binary;
+  // Resend the current status in the new format
+  ws_clients[num].sent_version = 0;
+  sendStatusToClient(num);
+}
+
+void serviceWebSocketClients() {
+  uint32_t version = getStatusVersion();
+  uint32_t now = millis();
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    WsClientStats& c = ws_clients[num];
+    if (!c.connected || c.sent_version == version) continue;
+    if (now - c.last_send_ms < c.interval_ms) continue; // Stays pending, newer versions replace it
+    sendStatusToClient(num);
+  }
+}
+
+const WsClientStats& getWsClientStats(uint8_t num) {
+  return ws_clients[num];
+}
+
+#endif // ENABLE_WEBSOCKET
@@ -0,0 +1,49 @@
+#ifndef WS_BROADCASTER_H
+#define WS_BROADCASTER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#if ENABLE_WEBSOCKET
+#include <WebSocketsServer.h>
+
+// Per-client delivery of status frames on the WebSocket server.
+// Nothing is ever queued: each client remembers the status version it last
+// received, and when it is due for a frame it gets the *current* status.
+// Intermediate versions are simply skipped (latest value wins).
+
+// A send taking longer than this means the client's TCP window is full
+const uint32_t WS_SLOW_SEND_US = 20000;
+// Slow clients are backed off up to this interval between frames
+const uint32_t WS_MAX_BACKOFF_MS = 2000;
+// Consecutive failed sends before a client is dropped
+const uint8_t WS_MAX_SEND_FAILURES = 3;
+
+struct WsClientStats {
+  bool connected;
+  bool binary;               // Client asked for the compact StatusFrame
+  bool slow;                 // Currently backed off
+  uint32_t sent_version;     // Status version last delivered
+  uint32_t last_send_ms;
+  uint32_t interval_ms;      // Current minimum spacing (rate limit + backoff)
+  uint32_t frames_sent;
+  uint32_t frames_coalesced; // Versions replaced before they were sent
+  uint32_t bytes_sent;
+  uint32_t last_send_us;
+  uint32_t max_send_us;
+  uint32_t slow_sends;
+  uint8_t  failures;         // Consecutive failed sends
+  uint32_t total_failures;
+};
+
+extern WebSocketsServer webSocket;
+
+void wsClientConnected(uint8_t num);
+void wsClientDisconnected(uint8_t num);
+void wsSetClientBinary(uint8_t num, bool binary); // "PROTO:BIN" / "PROTO:JSON"
+void serviceWebSocketClients(); // Called from loop()
+const WsClientStats& getWsClientStats(uint8_t num);
+
+#endif // ENABLE_WEBSOCKET
+
+#endif
@@ -0,0 +1,145 @@
+// Worst-case latency fuzzing of the printer report parser (mqttCallback()).
+// See mqtt_parse_fuzz.h for the knobs and README.md for how to run it.
+#include "mqtt_parse_fuzz.h"
+#include <Arduino.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "host_hal.h"
+#include "mqtt_handler.h"
+
+void setup();
+
+struct SlowInput {
+  uint32_t us;
+  uint64_t hash;
+  std::string path;
+};
+
+static std::string slow_dir = "mqtt-slow";
+static size_t keep_count = 16;
+static bool keep_slowest = true;
+static uint32_t max_us = 0;     // 0: no limit
+static int64_t max_bytes = -1;  // -1: no limit
+
+static std::vector<SlowInput> slowest;  // Slowest first
+static FuzzSample last = {0, 0};
+static FuzzSample worst_time = {0, 0};
+static FuzzSample worst_peak = {0, 0};
+static size_t worst_time_size = 0;
+static size_t worst_peak_size = 0;
+static uint64_t inputs = 0;
+static uint64_t total_us = 0;
+
+static uint64_t fnv1a(const uint8_t* data, size_t size) {
+  uint64_t h = 1469598103934665603ULL;
+  for (size_t i = 0; i < size; i++) {
+    h ^= data[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+// Keeps the input on disk while it is among the keep_count slowest seen
+static void keepIfSlow(const uint8_t* data, size_t size, uint32_t us) {
+  if (!keep_slowest || keep_count == 0) return;
+  if (slowest.size() == keep_count && us <= slowest.back().us) return;
+  uint64_t hash = fnv1a(data, size);
+  for (const SlowInput& s : slowest) {
+    if (s.hash == hash) return;
+  }
+
+  char name[64];
+  snprintf(name, sizeof(name), "/slow-%08u-%016llx", (unsigned)us, (unsigned long long)hash);
+  std::string path = slow_dir + name;
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return;
+  fwrite(data, 1, size, f);
+  fclose(f);
+
+  if (slowest.size() == keep_count) {
+    remove(slowest.back().path.c_str());
+    slowest.pop_back();
+  }
+  auto pos = std::find_if(slowest.begin(), slowest.end(), [us](const SlowInput& s) { return s.us < us; });
+  slowest.insert(pos, {us, hash, path});
+}
+
+static void printSummary() {
+  if (inputs == 0) return;
+  fprintf(stderr,
+          "--- mqttCallback() over %llu inputs ---\n"
+          "mean time:         %.1f us\n"
+          "worst time:        %u us (%zu byte input)\n"
+          "worst heap peak:   %lld bytes (%zu byte input)\n",
+          (unsigned long long)inputs, (double)total_us / inputs, (unsigned)worst_time.us, worst_time_size,
+          (long long)worst_peak.peak_bytes, worst_peak_size);
+  if (!slowest.empty()) {
+    fprintf(stderr, "slowest inputs kept in %s/:\n", slow_dir.c_str());
+    for (const SlowInput& s : slowest) fprintf(stderr, "  %8u us  %s\n", (unsigned)s.us, s.path.c_str());
+  }
+}
+
+const FuzzSample& fuzzLastSample() {
+  return last;
+}
+
+void fuzzSetKeepSlowest(bool keep) {
+  keep_slowest = keep;
+}
+
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv) {
+  const char* v;
+  if ((v = getenv("BAMBULED_FUZZ_SLOW_DIR")) && *v) slow_dir = v;
+  if ((v = getenv("BAMBULED_FUZZ_KEEP"))) keep_count = strtoul(v, nullptr, 10);
+  if ((v = getenv("BAMBULED_FUZZ_MAX_US"))) max_us = strtoul(v, nullptr, 10);
+  if ((v = getenv("BAMBULED_FUZZ_MAX_BYTES"))) max_bytes = strtoll(v, nullptr, 10);
+  if (keep_slowest) mkdir(slow_dir.c_str(), 0755);
+
+  // The firmware runs as it does on the device, just quietly: setup() brings
+  // up the config, LEDs and servers the report handlers update
+  host::serialSetEnabled(false);
+  setup();
+  atexit(printSummary);
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  // PubSubClient hands over its own (writable) buffer
+  std::vector<uint8_t> payload(data, data + size);
+  payload.push_back(0);
+  std::string topic = mqtt_topic_status.c_str();
+
+  host::heapResetPeak();
+  int64_t base = host::heapInUse();
+  auto start = std::chrono::steady_clock::now();
+  mqttCallback(&topic[0], payload.data(), (unsigned int)size);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  last.us = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+  last.peak_bytes = host::heapPeak() - base;
+  inputs++;
+  total_us += last.us;
+  if (last.us > worst_time.us) {
+    worst_time = last;
+    worst_time_size = size;
+  }
+  if (last.peak_bytes > worst_peak.peak_bytes) {
+    worst_peak = last;
+    worst_peak_size = size;
+  }
+  keepIfSlow(data, size, last.us);
+
+  if (max_us && last.us > max_us) {
+    fprintf(stderr, "mqttCallback() took %u us, budget %u us\n", (unsigned)last.us, (unsigned)max_us);
+    abort();
+  }
+  if (max_bytes >= 0 && last.peak_bytes > max_bytes) {
+    fprintf(stderr, "mqttCallback() heap peak %lld bytes, budget %lld\n", (long long)last.peak_bytes,
+            (long long)max_bytes);
+    abort();
+  }
+  return 0;
+}
@@ -0,0 +1,31 @@
+// libFuzzer entry points for mqttCallback(), also driven by replay_main.cpp.
+//
+// Each input is delivered as one printer report. Its wall time and the heap
+// high-water mark above the pre-call level are recorded; the slowest inputs
+// are kept as files so they can be added to fuzz/corpus as regressions. The
+// worst cases are printed to stderr on exit.
+//
+// Environment:
+//   BAMBULED_FUZZ_SLOW_DIR   Where the slowest inputs are kept (default mqtt-slow)
+//   BAMBULED_FUZZ_KEEP       How many of them (default 16)
+//   BAMBULED_FUZZ_MAX_US     Abort on an input slower than this (default: off)
+//   BAMBULED_FUZZ_MAX_BYTES  Abort on an input with a higher heap peak; 0 allows
+//                            no allocation at all (default: off)
+#ifndef MQTT_PARSE_FUZZ_H
+#define MQTT_PARSE_FUZZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct FuzzSample {
+  uint32_t us;         // Host wall time of mqttCallback()
+  int64_t peak_bytes;  // Heap high-water mark above the level before the call
+};
+
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv);
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+const FuzzSample& fuzzLastSample();
+void fuzzSetKeepSlowest(bool keep);  // Call before LLVMFuzzerInitialize()
+
+#endif
@@ -0,0 +1,159 @@
+// Runs corpus files through the fuzz harness without libFuzzer, so the
+// regression corpus can be checked with any compiler (and from ctest).
+//
+//   mqtt_parse_replay [--max-us N] [--max-bytes N] [--keep-slowest]
+//                     [--mutate N [--seed S]] PATH...
+//
+// PATH is a file or a directory of inputs. Prints time and heap peak per
+// input; exits 1 if any input is over a budget.
+//
+// --mutate runs N random mutations of the inputs instead of the inputs
+// themselves and prints only the summary: a slow-input search for machines
+// without clang and libFuzzer. It is repeatable for a given seed.
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "mqtt_parse_fuzz.h"
+
+static void collect(const std::string& path, std::vector<std::string>* files) {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) {
+    fprintf(stderr, "Cannot read %s\n", path.c_str());
+    return;
+  }
+  if (!S_ISDIR(st.st_mode)) {
+    files->push_back(path);
+    return;
+  }
+  DIR* dir = opendir(path.c_str());
+  if (!dir) return;
+  std::vector<std::string> entries;
+  while (struct dirent* e = readdir(dir)) {
+    if (e->d_name[0] != '.') entries.push_back(path + "/" + e->d_name);
+  }
+  closedir(dir);
+  std::sort(entries.begin(), entries.end());
+  for (const auto& entry : entries) collect(entry, files);
+}
+
+// Same limit as -max_len in the libFuzzer example in README.md
+static const size_t MUTATE_MAX_LEN = 16512;
+
+// Tokens that make the parser work: nesting, escapes and long numbers
+static const char* const MUTATE_TOKENS[] = {"{", "}", "[", "]", "\"", ":", ",", "\\", "\\u00e9",
+                                            "\\ud83d\\ude00", "1e308", "-0.000001", "null", "\"print\"",
+                                            "\"command\":\"push_status\""};
+
+static void mutate(std::string* data, const std::vector<std::string>& inputs, std::mt19937& rng) {
+  auto pick = [&rng](size_t n) { return n ? (size_t)(rng() % n) : 0; };
+  int steps = 1 + pick(8);
+  for (int i = 0; i < steps; i++) {
+    size_t pos = pick(data->size() + 1);
+    switch (pick(6)) {
+      case 0:  // Overwrite a byte
+        if (!data->empty()) (*data)[pick(data->size())] = (char)rng();
+        break;
+      case 1:  // Insert a token
+        data->insert(pos, MUTATE_TOKENS[pick(sizeof(MUTATE_TOKENS) / sizeof(MUTATE_TOKENS[0]))]);
+        break;
+      case 2:  // Delete a range
+        data->erase(pos, 1 + pick(64));
+        break;
+      case 3: {  // Repeat a short range, e.g. into deep nesting or a long string
+        size_t len = 1 + pick(16);
+        std::string chunk = data->substr(pos, len);
+        size_t times = 1 + pick(512);
+        for (size_t t = 0; t < times && data->size() < MUTATE_MAX_LEN; t++) data->insert(pos, chunk);
+        break;
+      }
+      case 4: {  // Splice in part of another input
+        const std::string& other = inputs[pick(inputs.size())];
+        size_t from = pick(other.size());
+        data->insert(pos, other, from, 1 + pick(other.size() - from));
+        break;
+      }
+      default:  // Replace a digit run with a long number
+        if (pos < data->size() && isdigit((unsigned char)(*data)[pos])) data->insert(pos, 1 + pick(300), '9');
+        break;
+    }
+  }
+  if (data->size() > MUTATE_MAX_LEN) data->resize(MUTATE_MAX_LEN);
+}
+
+static std::string readInput(const std::string& file) {
+  std::ifstream in(file, std::ios::binary);
+  std::stringstream buf;
+  buf << in.rdbuf();
+  return buf.str();
+}
+
+int main(int argc, char** argv) {
+  uint32_t max_us = 0;
+  int64_t max_bytes = -1;  // -1: no limit
+  bool keep = false;
+  uint64_t mutations = 0;
+  uint32_t seed = 1;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "--max-us" && i + 1 < argc) {
+      max_us = strtoul(argv[++i], nullptr, 10);
+    } else if (a == "--max-bytes" && i + 1 < argc) {
+      max_bytes = strtoll(argv[++i], nullptr, 10);
+    } else if (a == "--keep-slowest") {
+      keep = true;
+    } else if (a == "--mutate" && i + 1 < argc) {
+      mutations = strtoull(argv[++i], nullptr, 10);
+    } else if (a == "--seed" && i + 1 < argc) {
+      seed = strtoul(argv[++i], nullptr, 10);
+    } else if (a[0] == '-') {
+      fprintf(stderr,
+              "usage: mqtt_parse_replay [--max-us N] [--max-bytes N] [--keep-slowest]\n"
+              "                         [--mutate N [--seed S]] PATH...\n");
+      return 2;
+    } else {
+      collect(a, &files);
+    }
+  }
+  if (files.empty()) {
+    fprintf(stderr, "No inputs\n");
+    return 2;
+  }
+
+  fuzzSetKeepSlowest(keep);
+  LLVMFuzzerInitialize(&argc, &argv);
+
+  int over = 0;
+  if (mutations) {
+    std::vector<std::string> inputs;
+    for (const auto& file : files) inputs.push_back(readInput(file));
+    std::mt19937 rng(seed);
+    for (uint64_t n = 0; n < mutations; n++) {
+      std::string data = inputs[rng() % inputs.size()];
+      mutate(&data, inputs, rng);
+      LLVMFuzzerTestOneInput((const uint8_t*)data.data(), data.size());
+      const FuzzSample& s = fuzzLastSample();
+      if ((max_us && s.us > max_us) || (max_bytes >= 0 && s.peak_bytes > max_bytes)) over++;
+    }
+    if (over) fprintf(stderr, "%d of %llu mutations over budget\n", over, (unsigned long long)mutations);
+    return over ? 1 : 0;
+  }
+
+  for (const auto& file : files) {
+    std::string data = readInput(file);
+
+    LLVMFuzzerTestOneInput((const uint8_t*)data.data(), data.size());
+    const FuzzSample& s = fuzzLastSample();
+    bool bad = (max_us && s.us > max_us) || (max_bytes >= 0 && s.peak_bytes > max_bytes);
+    if (bad) over++;
+    fprintf(stderr, "%8u us %8lld B %8zu in  %s%s\n", (unsigned)s.us, (long long)s.peak_bytes, data.size(),
+            file.c_str(), bad ? "  OVER BUDGET" : "");
+  }
+  if (over) fprintf(stderr, "%d of %zu inputs over budget\n", over, files.size());
+  return over ? 1 : 0;
+}
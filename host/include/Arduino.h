@@ -0,0 +1,265 @@
+// Host stand-in for the ESP32 Arduino core: just enough of Arduino.h for the
+// firmware in BambuLed/ to build and run as a Linux process. Time comes from
+// the host clock (host_hal.h), Serial goes to stdout.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <time.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define ARDUINO 10819
+#define ESP32 1
+
+// No separate flash address space on the host
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(x) (x)
+#define F(x) (x)
+#define FPSTR(x) (x)
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define pgm_read_byte(a) (*(const uint8_t*)(a))
+#define pgm_read_word(a) (*(const uint16_t*)(a))
+#define pgm_read_dword(a) (*(const uint32_t*)(a))
+#define pgm_read_ptr(a) (*(void* const*)(a))
+
+// RTC memory is plain RAM: it "survives" as long as the process does
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define RTC_DATA_ATTR
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#if defined(__GLIBC__) && (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char* dst, const char* src, size_t size);
+size_t strlcat(char* dst, const char* src, size_t size);
+#endif
+
+// --- Time ---
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::min;
+using std::max;
+
+// --- GPIO / PWM ---
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+bool ledcDetach(uint8_t pin);
+
+// --- System ---
+uint32_t esp_random();
+bool psramFound();
+void* ps_malloc(size_t size);
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1,
+                const char* server2 = nullptr, const char* server3 = nullptr);
+
+// --- String ---
+class String {
+public:
+  String(const char* s = "") : _s(s ? s : "") {}
+  String(const String& s) = default;
+  String(const std::string& s) : _s(s) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int v, unsigned char base = 10);
+  explicit String(unsigned int v, unsigned char base = 10);
+  explicit String(long v, unsigned char base = 10);
+  explicit String(unsigned long v, unsigned char base = 10);
+  explicit String(float v, unsigned int decimalPlaces = 2);
+  explicit String(double v, unsigned int decimalPlaces = 2);
+
+  String& operator=(const String& s) = default;
+  String& operator=(const char* s) { _s = s ? s : ""; return *this; }
+
+  bool concat(const String& s) { _s += s._s; return true; }
+  bool concat(const char* s) { if (s) _s += s; return true; }
+  bool concat(const char* s, unsigned int len) { if (s) _s.append(s, len); return true; }
+  bool concat(char c) { _s += c; return true; }
+  bool concat(int v) { return concat(String(v)); }
+  bool concat(unsigned int v) { return concat(String(v)); }
+  bool concat(long v) { return concat(String(v)); }
+  bool concat(unsigned long v) { return concat(String(v)); }
+  bool concat(float v) { return concat(String(v)); }
+  bool concat(double v) { return concat(String(v)); }
+  template <typename T> String& operator+=(const T& v) { concat(v); return *this; }
+
+  bool operator==(const String& s) const { return _s == s._s; }
+  bool operator==(const char* s) const { return _s == (s ? s : ""); }
+  bool operator!=(const String& s) const { return !(*this == s); }
+  bool operator!=(const char* s) const { return !(*this == s); }
+  bool operator<(const String& s) const { return _s < s._s; }
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.length(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+  bool isEmpty() const { return _s.empty(); }
+  char charAt(unsigned int i) const { return i < _s.length() ? _s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return _s[i]; }
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const char* s, unsigned int from = 0) const;
+  int indexOf(const String& s, unsigned int from = 0) const { return indexOf(s.c_str(), from); }
+  int lastIndexOf(char c) const;
+  bool startsWith(const char* s) const { return _s.compare(0, strlen(s), s) == 0; }
+  bool startsWith(const String& s) const { return startsWith(s.c_str()); }
+  bool endsWith(const char* s) const;
+  bool endsWith(const String& s) const { return endsWith(s.c_str()); }
+  bool equals(const char* s) const { return *this == s; }
+  bool equals(const String& s) const { return *this == s; }
+  bool equalsIgnoreCase(const String& s) const;
+  String substring(unsigned int from) const { return substring(from, _s.length()); }
+  String substring(unsigned int from, unsigned int to) const;
+  void replace(const String& find, const String& with);
+  void replace(const char* find, const char* with) { replace(String(find), String(with)); }
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+  void trim();
+  void toUpperCase();
+  void toLowerCase();
+  long toInt() const { return atol(_s.c_str()); }
+  float toFloat() const { return (float)atof(_s.c_str()); }
+  double toDouble() const { return atof(_s.c_str()); }
+
+private:
+  std::string _s;
+};
+
+// ArduinoJson looks for this type when Arduino String support is enabled
+class StringSumHelper : public String {
+public:
+  StringSumHelper(const String& s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String& a, const String& b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, const char* b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const char* a, const String& b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, char b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, int b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, unsigned int b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, long b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, unsigned long b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, float b) { String r(a); r.concat(b); return r; }
+inline StringSumHelper operator+(const String& a, double b) { String r(a); r.concat(b); return r; }
+
+// --- IPAddress ---
+class IPAddress {
+public:
+  IPAddress() : _addr{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr{a, b, c, d} {}
+  uint8_t operator[](int i) const { return _addr[i & 3]; }
+  uint8_t& operator[](int i) { return _addr[i & 3]; }
+  operator uint32_t() const { uint32_t v; memcpy(&v, _addr, 4); return v; }
+  bool operator==(const IPAddress& o) const { return memcmp(_addr, o._addr, 4) == 0; }
+  String toString() const;
+  bool fromString(const char* text);
+
+private:
+  uint8_t _addr[4];
+};
+
+// --- Print / Stream ---
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size);
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+  size_t write(const char* buf, size_t size) { return write((const uint8_t*)buf, size); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = 10) { return print((long)v, base); }
+  size_t print(unsigned int v, int base = 10) { return print((unsigned long)v, base); }
+  size_t print(long v, int base = 10);
+  size_t print(unsigned long v, int base = 10);
+  size_t print(double v, int digits = 2);
+  size_t print(const IPAddress& ip) { return print(ip.toString()); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+  size_t println(double v, int digits) { size_t n = print(v, digits); return n + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() { return -1; }
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+  String readString();
+
+protected:
+  unsigned long _timeout = 1000;
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  operator bool() const { return true; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buf, size_t size) override;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int availableForWrite() override { return 128; }
+  void flush() override { fflush(stdout); }
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+// --- ESP ---
+class EspClass {
+public:
+  void restart();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getHeapSize();
+  uint32_t getPsramSize();
+  uint32_t getFreePsram();
+  uint32_t getMinFreePsram();
+  uint32_t getMaxAllocPsram();
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint64_t getEfuseMac() { return 0x0000A1B2C3D4E5F6ULL; }
+  uint32_t getCycleCount() { return (uint32_t)(micros() * 240); }
+  const char* getSdkVersion() { return "host"; }
+};
+extern EspClass ESP;
+
+#include "esp_system.h"
+#include "esp_timer.h"
+
+#endif
@@ -0,0 +1,32 @@
+// Host stand-in for ArduinoOTA: callbacks are stored, no update ever arrives
+#ifndef HOST_ARDUINOOTA_H
+#define HOST_ARDUINOOTA_H
+
+#include <Arduino.h>
+#include <functional>
+
+typedef enum { OTA_AUTH_ERROR, OTA_BEGIN_ERROR, OTA_CONNECT_ERROR, OTA_RECEIVE_ERROR, OTA_END_ERROR } ota_error_t;
+
+class ArduinoOTAClass {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+  typedef std::function<void(unsigned int, unsigned int)> THandlerFunction_Progress;
+  typedef std::function<void(ota_error_t)> THandlerFunction_Error;
+
+  ArduinoOTAClass& setHostname(const char* hostname) { (void)hostname; return *this; }
+  ArduinoOTAClass& setPassword(const char* password) { (void)password; return *this; }
+  ArduinoOTAClass& onStart(THandlerFunction fn) { _start = fn; return *this; }
+  ArduinoOTAClass& onEnd(THandlerFunction fn) { _end = fn; return *this; }
+  ArduinoOTAClass& onProgress(THandlerFunction_Progress fn) { _progress = fn; return *this; }
+  ArduinoOTAClass& onError(THandlerFunction_Error fn) { _error = fn; return *this; }
+  void begin() {}
+  void handle() {}
+
+private:
+  THandlerFunction _start, _end;
+  THandlerFunction_Progress _progress;
+  THandlerFunction_Error _error;
+};
+extern ArduinoOTAClass ArduinoOTA;
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_DNSSERVER_H
+#define HOST_DNSSERVER_H
+
+#include <Arduino.h>
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_ESPMDNS_H
+#define HOST_ESPMDNS_H
+
+#include <Arduino.h>
+
+#endif
@@ -0,0 +1,57 @@
+// Host stand-in for the Arduino FS API, backed by the in-memory filesystem in
+// host/src/fs.cpp.
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+#include <memory>
+
+namespace fs {
+
+struct FileImpl;
+
+class File : public Stream {
+public:
+  File() {}
+  explicit File(std::shared_ptr<FileImpl> impl) : _impl(impl) {}
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t read(uint8_t* buf, size_t size);
+  bool seek(uint32_t pos);
+  size_t position() const;
+  size_t size() const;
+  void flush() override {}
+  void close();
+  const char* name() const;
+  const char* path() const;
+  bool isDirectory() const;
+  File openNextFile();
+  operator bool() const { return (bool)_impl; }
+
+private:
+  std::shared_ptr<FileImpl> _impl;
+};
+
+class FS {
+public:
+  File open(const char* path, const char* mode = "r", bool create = false);
+  File open(const String& path, const char* mode = "r", bool create = false) { return open(path.c_str(), mode, create); }
+  bool exists(const char* path);
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path);
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* from, const char* to);
+  bool mkdir(const char* path) { (void)path; return true; }
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif
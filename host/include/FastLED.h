@@ -0,0 +1,71 @@
+// Host stand-in for FastLED. show() captures the frame (after brightness)
+// for host::ledFrame() instead of driving a strip.
+#ifndef HOST_FASTLED_H
+#define HOST_FASTLED_H
+
+#include <Arduino.h>
+
+struct CRGB {
+  union {
+    struct { uint8_t r, g, b; };
+    uint8_t raw[3];
+  };
+
+  enum HTMLColorCode : uint32_t {
+    Black = 0x000000, Blue = 0x0000FF, Green = 0x008000, Orange = 0xFFA500,
+    Purple = 0x800080, Red = 0xFF0000, White = 0xFFFFFF, Yellow = 0xFFFF00
+  };
+
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+  CRGB(HTMLColorCode colorcode) : CRGB((uint32_t)colorcode) {}
+
+  CRGB& nscale8(uint8_t scale);
+  CRGB& fadeToBlackBy(uint8_t amount) { return nscale8(255 - amount); }
+  bool operator==(const CRGB& o) const { return r == o.r && g == o.g && b == o.b; }
+  bool operator!=(const CRGB& o) const { return !(*this == o); }
+};
+
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+enum LEDColorCorrection { TypicalLEDStrip = 0xFFB0F0, UncorrectedColor = 0xFFFFFF };
+
+class CLEDController {
+public:
+  CLEDController(CRGB* leds, int count, EOrder order) : _leds(leds), _count(count), _order(order) {}
+  CLEDController& setCorrection(LEDColorCorrection correction) { (void)correction; return *this; }
+  CLEDController& setLeds(CRGB* leds, int count) { _leds = leds; _count = count; return *this; }
+  CRGB* leds() { return _leds; }
+  int size() const { return _count; }
+  EOrder order() const { return _order; }
+
+private:
+  CRGB* _leds;
+  int _count;
+  EOrder _order;
+};
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class WS2812B {};
+
+class CFastLED {
+public:
+  template <template <uint8_t, EOrder> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+  CLEDController& addLeds(CRGB* leds, int count) { return addController(leds, count, RGB_ORDER); }
+
+  void clear(bool writeData = false);
+  void show() { show(_brightness); }
+  void show(uint8_t scale);
+  void setBrightness(uint8_t scale) { _brightness = scale; }
+  uint8_t getBrightness() { return _brightness; }
+  int count();
+
+private:
+  CLEDController& addController(CRGB* leds, int count, EOrder order);
+  uint8_t _brightness = 255;
+};
+extern CFastLED FastLED;
+
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color);
+uint8_t scale8(uint8_t i, uint8_t scale);
+
+#endif
@@ -0,0 +1,74 @@
+// Host stand-in for PubSubClient, talking to the in-process loopback broker
+// in host/src/mqtt.cpp instead of a printer. Messages are dropped when they
+// do not fit the buffer, as with the real library.
+#ifndef HOST_PUBSUBCLIENT_H
+#define HOST_PUBSUBCLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <functional>
+#include <vector>
+
+#define MQTT_CONNECTION_TIMEOUT -4
+#define MQTT_CONNECTION_LOST -3
+#define MQTT_CONNECT_FAILED -2
+#define MQTT_DISCONNECTED -1
+#define MQTT_CONNECTED 0
+#define MQTT_CONNECT_BAD_PROTOCOL 1
+#define MQTT_CONNECT_BAD_CLIENT_ID 2
+#define MQTT_CONNECT_UNAVAILABLE 3
+#define MQTT_CONNECT_BAD_CREDENTIALS 4
+#define MQTT_CONNECT_UNAUTHORIZED 5
+
+#define MQTT_MAX_PACKET_SIZE 256
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char*, uint8_t*, unsigned int)> callback
+
+class PubSubClient : public Print {
+public:
+  PubSubClient() : _buffer(MQTT_MAX_PACKET_SIZE) {}
+  explicit PubSubClient(WiFiClient& client) : _buffer(MQTT_MAX_PACKET_SIZE) { (void)client; }
+
+  PubSubClient& setServer(const char* domain, uint16_t port);
+  PubSubClient& setServer(IPAddress ip, uint16_t port) { return setServer(ip.toString().c_str(), port); }
+  PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE) { _callback = callback; return *this; }
+  PubSubClient& setClient(WiFiClient& client) { (void)client; return *this; }
+  PubSubClient& setKeepAlive(uint16_t keepAlive) { (void)keepAlive; return *this; }
+  PubSubClient& setSocketTimeout(uint16_t timeout) { (void)timeout; return *this; }
+  bool setBufferSize(uint16_t size);
+  uint16_t getBufferSize() { return _bufferSize; }
+
+  bool connect(const char* id) { return connect(id, nullptr, nullptr); }
+  bool connect(const char* id, const char* user, const char* pass);
+  bool connect(const char* id, const char* user, const char* pass, const char* willTopic, uint8_t willQos,
+               bool willRetain, const char* willMessage);
+  void disconnect();
+
+  bool publish(const char* topic, const char* payload) { return publish(topic, payload, false); }
+  bool publish(const char* topic, const char* payload, bool retained);
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length) { return publish(topic, payload, length, false); }
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained);
+  bool beginPublish(const char* topic, unsigned int length, bool retained);
+  int endPublish();
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t size) override;
+  using Print::write;
+
+  bool subscribe(const char* topic, uint8_t qos = 0);
+  bool unsubscribe(const char* topic);
+  bool loop();
+  bool connected();
+  int state() { return _state; }
+
+private:
+  std::function<void(char*, uint8_t*, unsigned int)> _callback;
+  uint16_t _bufferSize = MQTT_MAX_PACKET_SIZE;
+  std::vector<uint8_t> _buffer;  // Received packet, allocated up front like the real client's
+  int _state = MQTT_DISCONNECTED;
+  std::string _clientId;
+  uint32_t _session = 0;   // Broker session this client is connected to
+  std::string _pendingTopic;
+  std::string _pendingPayload;
+  bool _pendingRetained = false;
+};
+
+#endif
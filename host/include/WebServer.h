@@ -0,0 +1,121 @@
+// Host stand-in for the ESP32 WebServer. Requests come from
+// host::httpSubmit() (host_hal.h) instead of a listening socket; responses
+// are written to the request's loopback connection in HTTP/1.1 form.
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <FS.h>
+#include <functional>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+
+#define HTTP_UPLOAD_BUFLEN 1436
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+struct HTTPUpload {
+  HTTPUploadStatus status;
+  String filename;
+  String name;
+  String type;
+  size_t totalSize;
+  size_t currentSize;
+  uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+namespace host { struct HttpRequest; }
+
+class WebServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  explicit WebServer(int port = 80) : _port(port) {}
+
+  void begin() { _running = true; }
+  void stop() { _running = false; }
+  void handleClient();
+
+  void on(const String& uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+  void on(const String& uri, HTTPMethod method, THandlerFunction fn) { on(uri, method, fn, nullptr); }
+  void on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn);
+  void onNotFound(THandlerFunction fn) { _notFoundHandler = fn; }
+  void onFileUpload(THandlerFunction ufn) { _fileUploadHandler = ufn; }
+
+  String uri() { return _currentUri; }
+  HTTPMethod method() { return _currentMethod; }
+  WiFiClient& client() { return _currentClient; }
+  HTTPUpload& upload() { return _upload; }
+
+  String arg(const String& name);
+  String arg(int i);
+  String argName(int i);
+  int args() { return (int)_args.size(); }
+  bool hasArg(const String& name);
+
+  void collectHeaders(const char* headerKeys[], const size_t headerKeysCount) { (void)headerKeys; (void)headerKeysCount; }
+  String header(const String& name);
+  bool hasHeader(const String& name);
+
+  void send(int code, const char* content_type = NULL, const String& content = String(""));
+  void send(int code, const String& content_type, const String& content) { send(code, content_type.c_str(), content); }
+  void send(int code, const char* content_type, const char* content) { send(code, content_type, String(content)); }
+  void send_P(int code, PGM_P content_type, PGM_P content) { send_P(code, content_type, content, strlen(content)); }
+  void send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
+
+  void setContentLength(const size_t contentLength) { _contentLength = contentLength; }
+  void sendHeader(const String& name, const String& value, bool first = false);
+  void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+  void sendContent(const char* content, size_t contentLength);
+  void sendContent_P(PGM_P content) { sendContent(content, strlen(content)); }
+  void sendContent_P(PGM_P content, size_t size) { sendContent(content, size); }
+
+  template <typename T> size_t streamFile(T& file, const String& contentType, int code = 200) {
+    setContentLength(file.size());
+    send(code, contentType.c_str(), "");
+    uint8_t buf[512];
+    size_t total = 0, n;
+    while ((n = file.read(buf, sizeof(buf))) > 0) {
+      _currentClient.write(buf, n);
+      total += n;
+    }
+    return total;
+  }
+
+private:
+  struct Route {
+    String uri;
+    HTTPMethod method;
+    THandlerFunction fn;
+    THandlerFunction ufn;
+  };
+  struct Pair {
+    String name;
+    String value;
+  };
+
+  void serve(const host::HttpRequest& request);
+  void runUpload(const host::HttpRequest& request, const Route* route);
+  void sendHeaders(int code, const char* content_type, size_t length);
+
+  int _port;
+  bool _running = false;
+  std::vector<Route> _routes;
+  THandlerFunction _notFoundHandler;
+  THandlerFunction _fileUploadHandler;
+
+  WiFiClient _currentClient;
+  String _currentUri;
+  HTTPMethod _currentMethod = HTTP_ANY;
+  std::vector<Pair> _args;
+  std::vector<Pair> _requestHeaders;
+  String _responseHeaders;
+  size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+  bool _chunked = false;
+  HTTPUpload _upload;
+};
+
+#endif
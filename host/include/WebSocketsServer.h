@@ -0,0 +1,59 @@
+// Host stand-in for the WebSockets library server. Clients are attached and
+// driven from host_hal.h; events are delivered from loop() like the real one.
+#ifndef HOST_WEBSOCKETSSERVER_H
+#define HOST_WEBSOCKETSSERVER_H
+
+#include <Arduino.h>
+#include <functional>
+
+#define WEBSOCKETS_SERVER_CLIENT_MAX 5
+
+typedef enum {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_FRAGMENT_TEXT_START,
+  WStype_FRAGMENT_BIN_START,
+  WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN,
+  WStype_PING,
+  WStype_PONG
+} WStype_t;
+
+class WebSocketsServer {
+public:
+  typedef std::function<void(uint8_t num, WStype_t type, uint8_t* payload, size_t length)> WebSocketServerEvent;
+
+  WebSocketsServer(uint16_t port, const String& origin = "", const String& protocol = "arduino")
+      : _port(port) { (void)origin; (void)protocol; }
+
+  void begin() { _running = true; }
+  void close() { _running = false; }
+  void loop();
+  void onEvent(WebSocketServerEvent cbEvent) { _event = cbEvent; }
+
+  bool sendTXT(uint8_t num, const char* payload, size_t length = 0);
+  bool sendTXT(uint8_t num, String& payload) { return sendTXT(num, payload.c_str(), payload.length()); }
+  bool sendBIN(uint8_t num, const uint8_t* payload, size_t length);
+  bool broadcastTXT(const char* payload, size_t length = 0);
+  bool broadcastTXT(String& payload) { return broadcastTXT(payload.c_str(), payload.length()); }
+  bool broadcastBIN(const uint8_t* payload, size_t length);
+
+  void disconnect();
+  void disconnect(uint8_t num);
+  bool clientIsConnected(uint8_t num);
+  uint8_t connectedClients(bool ping = false);
+  IPAddress remoteIP(uint8_t num) { (void)num; return IPAddress(127, 0, 0, 1); }
+  void enableHeartbeat(uint32_t pingInterval, uint32_t pongTimeout, uint8_t disconnectTimeoutCount) {
+    (void)pingInterval; (void)pongTimeout; (void)disconnectTimeoutCount;
+  }
+
+private:
+  uint16_t _port;
+  bool _running = false;
+  WebSocketServerEvent _event;
+};
+
+#endif
@@ -0,0 +1,85 @@
+// Host stand-in for the ESP32 WiFi library. The station is "associated" as
+// soon as it is started unless host::wifiSetAvailable(false) was called;
+// WiFiClient is a loopback connection (host_socket.h) with no outbound
+// network access.
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+#include <memory>
+#include "host_socket.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_POWER_19_5dBm = 78, WIFI_POWER_11dBm = 44, WIFI_POWER_8_5dBm = 34 } wifi_power_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+class WiFiClient : public Stream {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(std::shared_ptr<host::Socket> socket);
+  virtual ~WiFiClient() {}
+
+  virtual int connect(const char* host, uint16_t port);
+  virtual int connect(IPAddress ip, uint16_t port);
+  int connect(IPAddress ip, uint16_t port, int32_t timeout_ms);
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  int availableForWrite() override { return connected() ? 4096 : 0; }
+  void stop();
+  uint8_t connected();
+  operator bool() { return connected(); }
+  IPAddress remoteIP();
+  void setNoDelay(bool nodelay) { (void)nodelay; }
+
+private:
+  // Copies share one handle; like lwIP sockets on the ESP32 the connection
+  // stays open until stop() or the last copy is destroyed
+  struct Handle {
+    std::shared_ptr<host::Socket> socket;
+    ~Handle() { if (socket) socket->device_open = false; }
+  };
+  std::shared_ptr<Handle> _handle;
+};
+
+typedef WiFiClient NetworkClient;
+
+class WiFiClass {
+public:
+  wl_status_t status();
+  bool mode(wifi_mode_t mode) { _mode = mode; return true; }
+  wifi_mode_t getMode() { return _mode; }
+  wl_status_t begin();
+  wl_status_t begin(const char* ssid, const char* passphrase = nullptr);
+  uint8_t waitForConnectResult(unsigned long timeoutLength = 60000);
+  bool disconnect(bool wifioff = false);
+  bool setAutoReconnect(bool autoReconnect) { (void)autoReconnect; return true; }
+  bool setTxPower(wifi_power_t power) { _power = power; return true; }
+  bool setSleep(bool enabled) { (void)enabled; return true; }
+  bool setHostname(const char* name) { _hostname = name; return true; }
+  const char* getHostname() { return _hostname.c_str(); }
+  String SSID();
+  int8_t RSSI();
+  IPAddress localIP();
+  int hostByName(const char* name, IPAddress& result);
+  String macAddress() { return "A1:B2:C3:D4:E5:F6"; }
+
+private:
+  wifi_mode_t _mode = WIFI_OFF;
+  wifi_power_t _power = WIFI_POWER_19_5dBm;
+  bool _started = false;
+  String _hostname = "bambuled-host";
+};
+extern WiFiClass WiFi;
+
+#endif
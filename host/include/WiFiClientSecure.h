@@ -0,0 +1,14 @@
+#ifndef HOST_WIFICLIENTSECURE_H
+#define HOST_WIFICLIENTSECURE_H
+
+#include <WiFi.h>
+
+// No TLS on the host: the MQTT stand-in never opens a real connection
+class WiFiClientSecure : public WiFiClient {
+public:
+  void setInsecure() {}
+  void setCACert(const char* rootCA) { (void)rootCA; }
+  void setHandshakeTimeout(unsigned long seconds) { (void)seconds; }
+};
+
+#endif
@@ -0,0 +1,49 @@
+// Host stand-in for WiFiManager. There is no captive portal: autoConnect()
+// just starts the (simulated) station, and parameters keep their defaults.
+#ifndef HOST_WIFIMANAGER_H
+#define HOST_WIFIMANAGER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <functional>
+
+class WiFiManagerParameter {
+public:
+  explicit WiFiManagerParameter(const char* custom) : _id(nullptr), _label(nullptr), _custom(custom) {}
+  WiFiManagerParameter(const char* id, const char* label, const char* defaultValue, int length,
+                       const char* custom = "")
+      : _id(id), _label(label), _custom(custom), _length(length) { setValue(defaultValue, length); }
+
+  const char* getID() const { return _id; }
+  const char* getLabel() const { return _label; }
+  const char* getValue() const { return _value.c_str(); }
+  const char* getCustomHTML() const { return _custom; }
+  int getValueLength() const { return _length; }
+  void setValue(const char* value, int length) {
+    _value = value ? String(value).substring(0, length) : String("");
+    _length = length;
+  }
+
+private:
+  const char* _id;
+  const char* _label;
+  const char* _custom;
+  int _length = 0;
+  String _value;
+};
+
+class WiFiManager {
+public:
+  bool autoConnect(const char* apName = "", const char* apPassword = nullptr);
+  bool addParameter(WiFiManagerParameter* p) { (void)p; return true; }
+  void resetSettings() {}
+  void setSaveConfigCallback(std::function<void()> func) { (void)func; }
+  void setConfigPortalTimeout(unsigned long seconds) { (void)seconds; }
+  void setConnectTimeout(unsigned long seconds) { (void)seconds; }
+  void setWiFiAutoReconnect(bool enable) { (void)enable; }
+  void setCleanConnect(bool enable) { (void)enable; }
+  void setConfigPortalBlocking(bool blocking) { (void)blocking; }
+  bool process() { return false; }
+};
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef HOST_DRIVER_LEDC_H
+#define HOST_DRIVER_LEDC_H
+
+// ledcAttach()/ledcWrite() are declared in Arduino.h, as in core 3.x
+#include <Arduino.h>
+
+#endif
@@ -0,0 +1,10 @@
+// Host stand-in: there is no external RAM, so no pointer is in it.
+#ifndef HOST_ESP_MEMORY_UTILS_H
+#define HOST_ESP_MEMORY_UTILS_H
+
+inline bool esp_ptr_external_ram(const void* ptr) {
+  (void)ptr;
+  return false;
+}
+
+#endif
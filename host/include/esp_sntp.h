@@ -0,0 +1,10 @@
+#ifndef HOST_ESP_SNTP_H
+#define HOST_ESP_SNTP_H
+
+#include <sys/time.h>
+
+// Called once configTime() has "synced" the clock (see host/src/clock.cpp)
+typedef void (*sntp_sync_time_cb_t)(struct timeval* tv);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+
+#endif
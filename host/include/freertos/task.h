@@ -0,0 +1,39 @@
+// Host stand-in for FreeRTOS tasks: a task is a host thread
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+#include <chrono>
+#include <thread>
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+// Distinct per thread, stable for the thread's lifetime
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+  static thread_local char task;
+  return &task;
+}
+
+// Stack size, priority and core are ignored; the thread runs until exit
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* param,
+                                          UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+  std::thread(fn, param).detach();
+  if (handle) *handle = nullptr;
+  return pdPASS;
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* param,
+                              UBaseType_t priority, TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, param, priority, handle, tskNO_AFFINITY);
+}
+
+// Real time, also under the virtual clock: other tasks do not advance it
+inline void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+#endif
@@ -0,0 +1,124 @@
+// Control side of the host build. The firmware talks to the Arduino-style
+// stand-ins in this directory exactly as it talks to the real libraries on
+// the ESP32; a test driver or host/main.cpp uses the functions below to play
+// the printer, the network and the hardware around it.
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "host_socket.h"
+
+namespace host {
+
+// --- Clock ---
+// Virtual by default: millis()/micros() only move when the firmware calls
+// delay() (or advanceClock() is called), so runs are repeatable and
+// independent of how fast the host is. Real time suits perf/valgrind runs.
+void clockSetRealtime(bool realtime);
+bool clockIsRealtime();
+void advanceClock(uint32_t ms);
+uint64_t clockMicros();
+uint64_t sleptMicros();  // Total time spent in delay()
+
+// --- Serial ---
+void serialSetEnabled(bool enabled); // false: Serial output is discarded (fuzzing)
+
+// --- Network ---
+void wifiSetAvailable(bool available); // false: association and MQTT fail
+bool wifiAvailable();
+
+// --- MQTT loopback broker ---
+struct MqttMessage {
+  std::string topic;
+  std::string payload;
+  bool retained;
+};
+void mqttSetBrokerAvailable(bool available);
+void mqttDropConnection();  // Broker side closes the session
+bool mqttIsSubscribed(const std::string& topic);
+std::vector<std::string> mqttSubscriptions();
+// Queued for delivery from PubSubClient::loop(), if a subscription matches
+void mqttInject(const std::string& topic, const std::string& payload);
+const std::vector<MqttMessage>& mqttPublished();
+void mqttClearPublished();
+uint32_t mqttConnectCount();
+
+// --- LED output ---
+// Last frame pushed with FastLED.show(), brightness applied, as 0xRRGGBB
+const std::vector<uint32_t>& ledFrame();
+uint32_t ledShowCount();
+
+// --- GPIO / PWM ---
+uint32_t pwmDuty(uint8_t pin);     // Last ledcWrite() duty, 0 if never written
+bool pwmAttached(uint8_t pin);
+void pinSetInput(uint8_t pin, int level);
+
+// --- Filesystem ---
+// LittleFS is kept in memory. A directory can seed it and receive it back,
+// so settings survive between runs like they do across reboots.
+bool fsLoadDirectory(const std::string& dir);
+bool fsSaveDirectory(const std::string& dir);
+void fsFormat();
+
+// --- HTTP ---
+// Queues a request for WebServer::handleClient(). The response accumulates
+// in socket->from_device; the request is complete once !device_open.
+// Streams such as /events stay open while the firmware holds the client.
+struct HttpRequest {
+  std::string method = "GET";
+  std::string uri;  // Path plus optional ?query
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::string body;
+  std::string content_type;  // application/x-www-form-urlencoded bodies become args
+  // Multipart file upload, handed to the route's upload handler
+  std::string upload_filename;
+  std::string upload_data;
+  std::shared_ptr<Socket> socket;
+};
+std::shared_ptr<Socket> httpSubmit(const HttpRequest& request);
+void httpClose(const std::shared_ptr<Socket>& socket);  // Peer hangs up
+// Status code and body of a completed, non-chunked or chunked response
+int httpParseResponse(const std::string& raw, std::string* body);
+
+// --- WebSocket ---
+int wsConnect();  // Slot number, or -1 when all are taken
+void wsSendText(int num, const std::string& text);
+void wsClose(int num);
+bool wsIsOpen(int num);
+// Frames sent by the firmware since the last call; binary frames start with '\x01',
+// text frames with '\x00'
+std::vector<std::string> wsTakeFrames(int num);
+
+// --- Heap ---
+// Every malloc/new in the process is counted at host (64-bit) sizes and, as
+// on an ESP32 built with CONFIG_HEAP_USE_HOOKS, passed to the heap hooks the
+// firmware defines (heap_guard.cpp). Stand-ins and drivers pause the hooks
+// while they play the network or the printer, so the firmware's heap guard
+// only sees allocations the device would make.
+int64_t heapInUse();
+int64_t heapPeak();
+void heapResetPeak();  // Peak := in use
+uint64_t heapAllocCount();
+void heapPauseHooks();  // Nests
+void heapResumeHooks();
+
+class HeapHooksPaused {
+public:
+  HeapHooksPaused() { heapPauseHooks(); }
+  ~HeapHooksPaused() { heapResumeHooks(); }
+  HeapHooksPaused(const HeapHooksPaused&) = delete;
+  HeapHooksPaused& operator=(const HeapHooksPaused&) = delete;
+};
+
+// --- System ---
+void setResetReason(int reason);  // esp_reset_reason_t
+// ESP.restart() ends the process through this hook (default: exit(0))
+void onRestart(void (*hook)());
+
+}  // namespace host
+
+#endif
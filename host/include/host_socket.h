@@ -0,0 +1,22 @@
+// Loopback connection shared by a device-side WiFiClient and the host side
+// (host_hal.h). Internal to the host build.
+#ifndef HOST_SOCKET_H
+#define HOST_SOCKET_H
+
+#include <stdint.h>
+#include <string>
+
+namespace host {
+
+struct Socket {
+  std::string to_device;    // Written by the peer, read by the firmware
+  size_t read_pos = 0;
+  std::string from_device;  // Written by the firmware
+  bool device_open = true;  // Until stop() or the last device-side copy is gone
+  bool peer_open = true;
+  uint8_t remote_ip[4] = {127, 0, 0, 1};
+};
+
+}  // namespace host
+
+#endif
@@ -0,0 +1,245 @@
+// Runs the BambuLED firmware (setup() + loop()) as a Linux process.
+//
+//   bambuled_host [--seconds N] [--realtime] [--fs DIR] [--config FILE]
+//                 [--report FILE]... [--report-interval MS] [--get URI]...
+//                 [--check URI]...
+//
+// Serial output goes to stdout, the run summary to stderr. With the default
+// virtual clock a run is repeatable: the same inputs give the same loop
+// count, LED frames and MQTT traffic, which makes it usable as a
+// performance regression check.
+//
+// Built with ZERO_HEAP_AFTER_BOOT (bambuled_host_zero_heap), the run also
+// fails if loop() made a heap allocation outside the guard's exempt scopes.
+//
+// --check requests a URI like --get and fails the run if the body is not
+// well-formed (response_check.h).
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <time.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "host_hal.h"
+#include "heap_guard.h"
+#include "logger.h"
+#include "response_check.h"
+
+void setup();
+void loop();
+
+struct Options {
+  uint32_t seconds = 60;
+  bool realtime = false;
+  std::string fs_dir;
+  std::string config_file;
+  std::vector<std::string> report_files;
+  uint32_t report_interval_ms = 1000;
+  std::vector<std::string> gets;
+  std::vector<std::string> checks;
+};
+
+static Options options;
+
+static void usage() {
+  fprintf(stderr,
+          "usage: bambuled_host [--seconds N] [--realtime] [--fs DIR] [--config FILE]\n"
+          "                     [--report FILE]... [--report-interval MS] [--get URI]...\n"
+          "                     [--check URI]...\n"
+          "  --seconds N          Run for N seconds of device time (default 60)\n"
+          "  --realtime           Use the wall clock instead of the virtual clock\n"
+          "  --fs DIR             Load LittleFS from DIR and write it back on exit\n"
+          "  --config FILE        Install FILE as /config.json before setup()\n"
+          "  --report FILE        Publish FILE as the printer report while subscribed;\n"
+          "                       several are published in turn\n"
+          "  --report-interval MS Report period (default 1000)\n"
+          "  --get URI            Request URI after the run and print the response body\n"
+          "  --check URI          Request URI after the run and fail unless the body is\n"
+          "                       well-formed (/metrics: Prometheus text, else JSON)\n");
+}
+
+static bool readFile(const std::string& path, std::string* out) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+  std::stringstream buf;
+  buf << in.rdbuf();
+  *out = buf.str();
+  return true;
+}
+
+static bool parseArgs(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (a == "--seconds" && hasValue) {
+      options.seconds = strtoul(argv[++i], nullptr, 10);
+    } else if (a == "--realtime") {
+      options.realtime = true;
+    } else if (a == "--fs" && hasValue) {
+      options.fs_dir = argv[++i];
+    } else if (a == "--config" && hasValue) {
+      options.config_file = argv[++i];
+    } else if (a == "--report" && hasValue) {
+      options.report_files.push_back(argv[++i]);
+    } else if (a == "--report-interval" && hasValue) {
+      options.report_interval_ms = strtoul(argv[++i], nullptr, 10);
+    } else if (a == "--get" && hasValue) {
+      options.gets.push_back(argv[++i]);
+    } else if (a == "--check" && hasValue) {
+      options.checks.push_back(argv[++i]);
+    } else {
+      return false;
+    }
+  }
+  return options.report_interval_ms > 0;
+}
+
+static void saveFilesystem() {
+  if (!options.fs_dir.empty() && !host::fsSaveDirectory(options.fs_dir)) {
+    fprintf(stderr, "Could not write %s\n", options.fs_dir.c_str());
+  }
+}
+
+// Returns the status code; the body goes to *body
+static int runRequest(const std::string& uri, std::string* body) {
+  std::shared_ptr<host::Socket> socket;
+  {
+    host::HeapHooksPaused paused;  // Playing the browser
+    host::HttpRequest request;
+    request.uri = uri;
+    socket = host::httpSubmit(request);
+  }
+  // Served from the next loop(); an event stream never completes, so give up
+  // after a few iterations and show what arrived
+  for (int i = 0; i < 100 && socket->device_open; i++) loop();
+  host::HeapHooksPaused paused;
+  host::httpClose(socket);
+
+  int code = host::httpParseResponse(socket->from_device, body);
+  fprintf(stderr, "GET %s -> %d (%zu bytes)\n", uri.c_str(), code, body->size());
+  return code;
+}
+
+static bool checkResponse(const std::string& uri) {
+  std::string body;
+  int code = runRequest(uri, &body);
+  std::string error;
+  bool ok = (code == 200);
+  if (!ok) {
+    error = "status " + std::to_string(code);
+  } else if (uri.compare(0, 8, "/metrics") == 0) {
+    ok = checkPrometheusText(body, &error);
+  } else {
+    ok = checkJson(body, &error);
+  }
+  if (!ok) fprintf(stderr, "FAIL: %s: %s\n", uri.c_str(), error.c_str());
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  if (!parseArgs(argc, argv)) {
+    usage();
+    return 2;
+  }
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+  host::clockSetRealtime(options.realtime);
+  host::onRestart(saveFilesystem);
+
+  if (!options.fs_dir.empty()) host::fsLoadDirectory(options.fs_dir);
+  if (!options.config_file.empty()) {
+    std::string json;
+    if (!readFile(options.config_file, &json)) {
+      fprintf(stderr, "Cannot read %s\n", options.config_file.c_str());
+      return 1;
+    }
+    File f = LittleFS.open("/config.json", "w");
+    f.write((const uint8_t*)json.data(), json.size());
+    f.close();
+  }
+  std::vector<std::string> reports;
+  for (const auto& path : options.report_files) {
+    reports.emplace_back();
+    if (!readFile(path, &reports.back())) {
+      fprintf(stderr, "Cannot read %s\n", path.c_str());
+      return 1;
+    }
+  }
+
+  clock_t cpu_start = clock();
+  setup();
+
+  uint64_t setup_us = host::clockMicros();
+  uint64_t end_us = setup_us + (uint64_t)options.seconds * 1000000;
+  uint64_t slept_start = host::sleptMicros();
+  uint64_t next_report_us = setup_us;
+  uint32_t loops = 0;
+  uint32_t injected = 0;
+  size_t next_report = 0;
+
+  while (host::clockMicros() < end_us) {
+    if (!reports.empty() && host::clockMicros() >= next_report_us) {
+      host::HeapHooksPaused paused;  // Playing the printer
+      const std::string& report = reports[next_report++ % reports.size()];
+      for (const auto& topic : host::mqttSubscriptions()) {
+        // Subscriptions are filters; the printer publishes on the plain topic
+        if (topic.find_first_of("+#") == std::string::npos) {
+          host::mqttInject(topic, report);
+          injected++;
+        }
+      }
+      next_report_us += (uint64_t)options.report_interval_ms * 1000;
+    }
+    uint64_t before_us = host::clockMicros();
+    loop();
+    // Drain the log here rather than on the drain task's real-time schedule,
+    // so output lines up with the iteration that logged it
+    logFlush();
+    loops++;
+    // A build without the idle sleep (LOOP_MAX_SLEEP_MS 0) never calls
+    // delay(); let each pass cost a millisecond so the run still ends
+    if (!options.realtime && host::clockMicros() == before_us) host::advanceClock(1);
+  }
+  double cpu_s = (double)(clock() - cpu_start) / CLOCKS_PER_SEC;
+
+  for (const auto& uri : options.gets) {
+    std::string body;
+    runRequest(uri, &body);
+    fwrite(body.data(), 1, body.size(), stderr);
+    fputc('\n', stderr);
+  }
+  int status = 0;
+  for (const auto& uri : options.checks) {
+    if (!checkResponse(uri)) status = 1;
+  }
+  logFlush();
+
+  double run_s = (host::clockMicros() - setup_us) / 1e6;
+  double slept_s = (host::sleptMicros() - slept_start) / 1e6;
+  fprintf(stderr,
+          "--- %s clock, %.1f s after setup ---\n"
+          "loop() iterations:   %u (%.1f per second)\n"
+          "time asleep:         %.1f%%\n"
+          "reports injected:    %u\n"
+          "MQTT publishes:      %zu\n"
+          "LED frames shown:    %u\n"
+          "host CPU time:       %.3f s\n",
+          options.realtime ? "real" : "virtual", run_s, loops, run_s > 0 ? loops / run_s : 0.0,
+          run_s > 0 ? 100.0 * slept_s / run_s : 0.0, injected, host::mqttPublished().size(),
+          host::ledShowCount(), cpu_s);
+
+#if ZERO_HEAP_AFTER_BOOT
+  fprintf(stderr,
+          "loop() allocations:  %u (%u bytes, last %u bytes)\n"
+          "exempt allocations:  %u\n",
+          (unsigned)heapGuardAllocs(), (unsigned)heapGuardAllocBytes(), (unsigned)heapGuardLastAllocSize(),
+          (unsigned)heapGuardExemptAllocs());
+  if (heapGuardAllocs() > 0) {
+    fprintf(stderr, "FAIL: loop() allocated after boot; rebuild with -DHEAP_GUARD_ABORT=1 for a backtrace\n");
+    status = 1;
+  }
+#endif
+
+  saveFilesystem();
+  return status;
+}
@@ -0,0 +1,144 @@
+#include "response_check.h"
+#include <ArduinoJson.h>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+
+static bool isNameStart(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':';
+}
+
+static bool isNameChar(char c) {
+  return isNameStart(c) || (c >= '0' && c <= '9');
+}
+
+// Metric name at the start of s; its length, 0 if there is none
+static size_t nameLength(const std::string& s, size_t from = 0) {
+  if (from >= s.size() || !isNameStart(s[from])) return 0;
+  size_t i = from + 1;
+  while (i < s.size() && isNameChar(s[i])) i++;
+  return i - from;
+}
+
+static bool isNumber(const std::string& s) {
+  if (s == "+Inf" || s == "-Inf" || s == "NaN") return true;
+  if (s.empty()) return false;
+  char* end = nullptr;
+  strtod(s.c_str(), &end);
+  return end && *end == '\0';
+}
+
+// {name="value",...}; returns the length consumed, 0 if malformed
+static size_t labelsLength(const std::string& s, size_t from) {
+  size_t i = from + 1;
+  while (i < s.size() && s[i] != '}') {
+    size_t n = nameLength(s, i);
+    if (n == 0) return 0;
+    i += n;
+    if (i + 1 >= s.size() || s[i] != '=' || s[i + 1] != '"') return 0;
+    i += 2;
+    while (i < s.size() && s[i] != '"') i += (s[i] == '\\') ? 2 : 1;
+    if (i >= s.size()) return 0;
+    i++;
+    if (i < s.size() && s[i] == ',') i++;
+  }
+  return i < s.size() ? i + 1 - from : 0;
+}
+
+static bool fail(std::string* error, size_t lineNo, const std::string& line, const char* why) {
+  *error = "line " + std::to_string(lineNo) + ": " + why + ": " + line.substr(0, 120);
+  return false;
+}
+
+bool checkPrometheusText(const std::string& body, std::string* error) {
+  static const char* const TYPES[] = { "counter", "gauge", "histogram", "summary", "untyped" };
+  if (body.empty()) {
+    *error = "empty body";
+    return false;
+  }
+  if (body.back() != '\n') {
+    *error = "body does not end with a newline";
+    return false;
+  }
+
+  std::set<std::string> families;
+  std::string helpFor;  // Family of the last HELP line, waiting for its TYPE
+  std::string family;   // Family samples belong to
+  std::string type;
+  size_t lineNo = 0;
+  size_t start = 0;
+  while (start < body.size()) {
+    size_t end = body.find('\n', start);
+    std::string line = body.substr(start, end - start);
+    start = end + 1;
+    lineNo++;
+    if (line.empty()) continue;
+
+    if (line.compare(0, 7, "# HELP ") == 0) {
+      size_t n = nameLength(line, 7);
+      if (n == 0 || line.size() <= 7 + n || line[7 + n] != ' ') return fail(error, lineNo, line, "bad HELP line");
+      if (!helpFor.empty()) return fail(error, lineNo, line, "HELP without TYPE before it");
+      helpFor = line.substr(7, n);
+      continue;
+    }
+    if (line.compare(0, 7, "# TYPE ") == 0) {
+      size_t n = nameLength(line, 7);
+      if (n == 0 || line.size() <= 7 + n || line[7 + n] != ' ') return fail(error, lineNo, line, "bad TYPE line");
+      std::string name = line.substr(7, n);
+      std::string t = line.substr(8 + n);
+      bool known = false;
+      for (const char* candidate : TYPES) known |= (t == candidate);
+      if (!known) return fail(error, lineNo, line, "unknown metric type");
+      if (name != helpFor) return fail(error, lineNo, line, "TYPE does not follow its HELP");
+      if (!families.insert(name).second) return fail(error, lineNo, line, "family declared twice");
+      helpFor.clear();
+      family = name;
+      type = t;
+      continue;
+    }
+    if (line[0] == '#') continue; // Other comments are allowed
+
+    size_t n = nameLength(line);
+    if (n == 0) return fail(error, lineNo, line, "sample without a metric name");
+    if (!helpFor.empty()) return fail(error, lineNo, line, "sample between HELP and TYPE");
+    std::string name = line.substr(0, n);
+    bool belongs = (name == family);
+    if (type == "histogram" || type == "summary") {
+      belongs |= (name == family + "_sum" || name == family + "_count");
+      if (type == "histogram") belongs |= (name == family + "_bucket");
+    }
+    if (!belongs) return fail(error, lineNo, line, "sample outside its family");
+    size_t i = n;
+    if (i < line.size() && line[i] == '{') {
+      size_t labels = labelsLength(line, i);
+      if (labels == 0) return fail(error, lineNo, line, "malformed labels");
+      i += labels;
+    }
+    if (i >= line.size() || line[i] != ' ') return fail(error, lineNo, line, "no space before the value");
+    std::string value = line.substr(i + 1);
+    size_t space = value.find(' ');
+    if (space != std::string::npos) value.resize(space); // Optional timestamp
+    if (!isNumber(value)) return fail(error, lineNo, line, "value is not a number");
+  }
+  if (!helpFor.empty()) {
+    *error = "HELP for " + helpFor + " has no TYPE";
+    return false;
+  }
+  return true;
+}
+
+bool checkJson(const std::string& body, std::string* error) {
+  // Every value takes at least one byte of text, so this bounds the pool
+  DynamicJsonDocument doc(JSON_ARRAY_SIZE(body.size()) + body.size());
+  DeserializationError result = deserializeJson(doc, body.data(), body.size());
+  if (result) {
+    *error = std::string("invalid JSON: ") + result.c_str();
+    return false;
+  }
+  size_t end = body.find_last_not_of(" \t\r\n");
+  if (end == std::string::npos || (body[end] != '}' && body[end] != ']')) {
+    *error = "JSON body is not an object or array";
+    return false;
+  }
+  return true;
+}
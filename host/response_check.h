@@ -0,0 +1,18 @@
+#ifndef HOST_RESPONSE_CHECK_H
+#define HOST_RESPONSE_CHECK_H
+
+#include <string>
+
+// Format checks for response bodies, used by bambuled_host --check. Each
+// returns false and describes the first problem in *error.
+
+// Prometheus text exposition format (version 0.0.4), as served by /metrics:
+// every family has one HELP and one TYPE line before its samples, and every
+// sample line is a family name (plus _bucket/_sum/_count for histograms),
+// optional labels and a number.
+bool checkPrometheusText(const std::string& body, std::string* error);
+
+// A complete JSON object or array (a body cut short fails to parse)
+bool checkJson(const std::string& body, std::string* error);
+
+#endif
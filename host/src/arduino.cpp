@@ -0,0 +1,345 @@
+// Core Arduino pieces for the host build: String, Print/Stream, Serial,
+// GPIO/PWM bookkeeping, heap and system calls.
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <ctype.h>
+#include <strings.h>
+#include <map>
+#include "host_hal.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+#if defined(__GLIBC__) && (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+
+size_t strlcat(char* dst, const char* src, size_t size) {
+  size_t used = strnlen(dst, size);
+  if (used == size) return size + strlen(src);
+  return used + strlcpy(dst + used, src, size - used);
+}
+#endif
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  if (in_max == in_min) return out_min;
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// --- String ---
+
+// Digits are written backwards from the end of buf; returns the first one
+typedef char IntegerBuffer[8 * sizeof(long) + 2];
+static const char* integerDigits(IntegerBuffer& buf, unsigned long value, bool negative, unsigned char base) {
+  if (base < 2 || base > 36) base = 10;
+  char* p = buf + sizeof(buf) - 1;
+  *p = '\0';
+  do {
+    unsigned digit = value % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value);
+  if (negative) *--p = '-';
+  return p;
+}
+
+static std::string formatInteger(unsigned long value, bool negative, unsigned char base) {
+  IntegerBuffer buf;
+  return integerDigits(buf, value, negative, base);
+}
+
+static std::string formatFloat(double value, unsigned int decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+  return buf;
+}
+
+String::String(int v, unsigned char base) : String((long)v, base) {}
+String::String(unsigned int v, unsigned char base) : String((unsigned long)v, base) {}
+String::String(long v, unsigned char base)
+    : _s(base == 10 && v < 0 ? formatInteger(-(unsigned long)v, true, base) : formatInteger((unsigned long)v, false, base)) {}
+String::String(unsigned long v, unsigned char base) : _s(formatInteger(v, false, base)) {}
+String::String(float v, unsigned int decimalPlaces) : _s(formatFloat(v, decimalPlaces)) {}
+String::String(double v, unsigned int decimalPlaces) : _s(formatFloat(v, decimalPlaces)) {}
+
+int String::indexOf(char c, unsigned int from) const {
+  size_t i = _s.find(c, from);
+  return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::indexOf(const char* s, unsigned int from) const {
+  size_t i = _s.find(s, from);
+  return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::lastIndexOf(char c) const {
+  size_t i = _s.rfind(c);
+  return i == std::string::npos ? -1 : (int)i;
+}
+
+bool String::endsWith(const char* s) const {
+  size_t n = strlen(s);
+  return _s.length() >= n && _s.compare(_s.length() - n, n, s) == 0;
+}
+
+bool String::equalsIgnoreCase(const String& s) const {
+  return _s.length() == s._s.length() && strcasecmp(_s.c_str(), s._s.c_str()) == 0;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= _s.length()) return String();
+  return String(_s.substr(from, to - from));
+}
+
+void String::replace(const String& find, const String& with) {
+  if (find._s.empty()) return;
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+    _s.replace(pos, find._s.length(), with._s);
+    pos += with._s.length();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index < _s.length()) _s.erase(index, count);
+}
+
+void String::trim() {
+  size_t start = _s.find_first_not_of(" \t\r\n\f\v");
+  if (start == std::string::npos) {
+    _s.clear();
+    return;
+  }
+  size_t end = _s.find_last_not_of(" \t\r\n\f\v");
+  _s = _s.substr(start, end - start + 1);
+}
+
+void String::toUpperCase() {
+  for (auto& c : _s) c = toupper((unsigned char)c);
+}
+
+void String::toLowerCase() {
+  for (auto& c : _s) c = tolower((unsigned char)c);
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr[0], _addr[1], _addr[2], _addr[3]);
+  return String(buf);
+}
+
+bool IPAddress::fromString(const char* text) {
+  unsigned a, b, c, d;
+  char extra;
+  if (sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+    return false;
+  }
+  *this = IPAddress(a, b, c, d);
+  return true;
+}
+
+// --- Print / Stream ---
+
+size_t Print::write(const uint8_t* buf, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buf++);
+  return n;
+}
+
+// Numbers are formatted on the stack, as the ESP32 core does
+size_t Print::print(long v, int base) {
+  IntegerBuffer buf;
+  bool negative = base == 10 && v < 0;
+  return write(integerDigits(buf, negative ? -(unsigned long)v : (unsigned long)v, negative, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long v, int base) {
+  IntegerBuffer buf;
+  return write(integerDigits(buf, v, false, (unsigned char)base));
+}
+
+size_t Print::print(double v, int digits) {
+  char buf[64];
+  int len = snprintf(buf, sizeof(buf), "%.*f", digits, v);
+  return write((const uint8_t*)buf, std::min(len, (int)sizeof(buf) - 1));
+}
+
+size_t Print::printf(const char* format, ...) {
+  // Same stack buffer as the ESP32 core: longer lines go through the heap
+  char small[64];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  if ((size_t)len < sizeof(small)) return write((const uint8_t*)small, len);
+
+  std::string big(len + 1, '\0');
+  va_start(args, format);
+  vsnprintf(&big[0], big.size(), format, args);
+  va_end(args);
+  return write((const uint8_t*)big.data(), len);
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+  // Host streams are never "slow": whatever is not available now never comes
+  size_t n = 0;
+  while (n < length) {
+    int c = read();
+    if (c < 0) break;
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+String Stream::readString() {
+  String s;
+  int c;
+  while ((c = read()) >= 0) s += (char)c;
+  return s;
+}
+
+static bool serial_enabled = true;
+
+void host::serialSetEnabled(bool enabled) {
+  serial_enabled = enabled;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (!serial_enabled) return 1;
+  return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t size) {
+  if (!serial_enabled) return size;
+  return fwrite(buf, 1, size, stdout);
+}
+
+// --- GPIO / PWM ---
+
+struct PinState {
+  uint8_t mode = 0;
+  int level = LOW;
+  bool input_set = false;  // Level forced by host::pinSetInput()
+  bool pwm = false;
+  uint32_t duty = 0;
+};
+static std::map<uint8_t, PinState> pins;
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  PinState& p = pins[pin];
+  p.mode = mode;
+  if (mode == INPUT_PULLUP && !p.input_set) p.level = HIGH;
+}
+
+int digitalRead(uint8_t pin) {
+  return pins[pin].level;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  pins[pin].level = val ? HIGH : LOW;
+}
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+  (void)freq;
+  (void)resolution;
+  pins[pin].pwm = true;
+  return true;
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+  PinState& p = pins[pin];
+  if (!p.pwm) return false;
+  p.duty = duty;
+  return true;
+}
+
+bool ledcDetach(uint8_t pin) {
+  pins[pin].pwm = false;
+  return true;
+}
+
+// --- Heap ---
+// The host has no meaningful free-heap figure; these mimic an ESP32-S3 with
+// 8 MB PSRAM so the firmware takes its usual code paths.
+static const uint32_t HOST_HEAP_SIZE = 320 * 1024;
+static const uint32_t HOST_PSRAM_SIZE = 8 * 1024 * 1024;
+
+void* heap_caps_malloc(size_t size, uint32_t caps) { (void)caps; return malloc(size); }
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) { (void)caps; return realloc(ptr, size); }
+void heap_caps_free(void* ptr) { free(ptr); }
+size_t heap_caps_get_free_size(uint32_t caps) { return (caps & MALLOC_CAP_SPIRAM) ? HOST_PSRAM_SIZE : HOST_HEAP_SIZE; }
+size_t heap_caps_get_minimum_free_size(uint32_t caps) { return heap_caps_get_free_size(caps); }
+size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_free_size(caps); }
+
+bool psramFound() { return true; }
+void* ps_malloc(size_t size) { return malloc(size); }
+
+uint32_t EspClass::getFreeHeap() { return HOST_HEAP_SIZE; }
+uint32_t EspClass::getMinFreeHeap() { return HOST_HEAP_SIZE; }
+uint32_t EspClass::getMaxAllocHeap() { return HOST_HEAP_SIZE; }
+uint32_t EspClass::getHeapSize() { return HOST_HEAP_SIZE; }
+uint32_t EspClass::getPsramSize() { return HOST_PSRAM_SIZE; }
+uint32_t EspClass::getFreePsram() { return HOST_PSRAM_SIZE; }
+uint32_t EspClass::getMinFreePsram() { return HOST_PSRAM_SIZE; }
+uint32_t EspClass::getMaxAllocPsram() { return HOST_PSRAM_SIZE; }
+
+// --- System ---
+
+// Fixed seed: boot ids and the like repeat from run to run
+uint32_t esp_random() {
+  static uint32_t state = 0x2545F491;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+static esp_reset_reason_t reset_reason = ESP_RST_POWERON;
+static void (*restart_hook)() = nullptr;
+
+esp_reset_reason_t esp_reset_reason() {
+  return reset_reason;
+}
+
+void EspClass::restart() {
+  fflush(stdout);
+  if (restart_hook) restart_hook();
+  exit(0);
+}
+
+namespace host {
+
+uint32_t pwmDuty(uint8_t pin) {
+  auto it = pins.find(pin);
+  return it == pins.end() ? 0 : it->second.duty;
+}
+
+bool pwmAttached(uint8_t pin) {
+  auto it = pins.find(pin);
+  return it != pins.end() && it->second.pwm;
+}
+
+void pinSetInput(uint8_t pin, int level) {
+  PinState& p = pins[pin];
+  p.level = level;
+  p.input_set = true;
+}
+
+void setResetReason(int reason) {
+  reset_reason = (esp_reset_reason_t)reason;
+}
+
+void onRestart(void (*hook)()) {
+  restart_hook = hook;
+}
+
+}  // namespace host
@@ -0,0 +1,119 @@
+// millis()/micros()/delay() for the host build, plus the SNTP stand-in
+#include <Arduino.h>
+#include <esp_sntp.h>
+#include <chrono>
+#include <thread>
+#include "host_hal.h"
+
+static bool realtime = false;
+static uint64_t virtual_us = 0;
+static uint64_t slept_us = 0;
+static const auto start_time = std::chrono::steady_clock::now();
+
+// SNTP: configTime() "syncs" a little later, from delay()/yield()
+static const uint32_t SNTP_SYNC_DELAY_MS = 50;
+static sntp_sync_time_cb_t sntp_callback = nullptr;
+static bool sntp_pending = false;
+static bool time_synced = false;
+static uint64_t sntp_due_us = 0;
+
+static void serviceSntp() {
+  if (!sntp_pending || host::clockMicros() < sntp_due_us) return;
+  sntp_pending = false;
+  time_synced = true;
+  if (sntp_callback) {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    sntp_callback(&tv);
+  }
+}
+
+unsigned long millis() {
+  return (unsigned long)(uint32_t)(host::clockMicros() / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(uint32_t)host::clockMicros();
+}
+
+int64_t esp_timer_get_time() {
+  return (int64_t)host::clockMicros();
+}
+
+void delay(unsigned long ms) {
+  slept_us += (uint64_t)ms * 1000;
+  if (realtime) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  } else {
+    virtual_us += (uint64_t)ms * 1000;
+  }
+  serviceSntp();
+}
+
+void delayMicroseconds(unsigned int us) {
+  slept_us += us;
+  if (realtime) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+  } else {
+    virtual_us += us;
+  }
+}
+
+void yield() {
+  serviceSntp();
+}
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+  sntp_callback = callback;
+}
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1, const char* server2,
+                const char* server3) {
+  (void)gmtOffset_sec;
+  (void)daylightOffset_sec;
+  (void)server1;
+  (void)server2;
+  (void)server3;
+  // The wall clock is the host's; only the "synced" edge is simulated
+  sntp_pending = true;
+  sntp_due_us = host::clockMicros() + SNTP_SYNC_DELAY_MS * 1000ULL;
+}
+
+bool getLocalTime(struct tm* info, uint32_t ms) {
+  uint32_t start = millis();
+  while (!time_synced) {
+    if (millis() - start >= ms) return false;
+    delay(10);
+  }
+  time_t now = time(nullptr);
+  localtime_r(&now, info);
+  return true;
+}
+
+namespace host {
+
+void clockSetRealtime(bool rt) {
+  realtime = rt;
+}
+
+bool clockIsRealtime() {
+  return realtime;
+}
+
+void advanceClock(uint32_t ms) {
+  virtual_us += (uint64_t)ms * 1000;
+  serviceSntp();
+}
+
+uint64_t clockMicros() {
+  if (realtime) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+  }
+  return virtual_us;
+}
+
+uint64_t sleptMicros() {
+  return slept_us;
+}
+
+}  // namespace host
@@ -0,0 +1,68 @@
+// FastLED and ArduinoOTA stand-ins
+#include <ArduinoOTA.h>
+#include <FastLED.h>
+#include <memory>
+#include <vector>
+#include "host_hal.h"
+
+CFastLED FastLED;
+ArduinoOTAClass ArduinoOTA;
+
+static std::vector<std::unique_ptr<CLEDController>> controllers;
+static std::vector<uint32_t> frame;
+static uint32_t show_count = 0;
+
+uint8_t scale8(uint8_t i, uint8_t scale) {
+  return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;
+}
+
+CRGB& CRGB::nscale8(uint8_t scale) {
+  r = scale8(r, scale);
+  g = scale8(g, scale);
+  b = scale8(b, scale);
+  return *this;
+}
+
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color) {
+  for (int i = 0; i < numToFill; i++) leds[i] = color;
+}
+
+CLEDController& CFastLED::addController(CRGB* leds, int count, EOrder order) {
+  controllers.emplace_back(new CLEDController(leds, count, order));
+  return *controllers.back();
+}
+
+int CFastLED::count() {
+  return (int)controllers.size();
+}
+
+void CFastLED::clear(bool writeData) {
+  for (auto& c : controllers) fill_solid(c->leds(), c->size(), CRGB::Black);
+  if (writeData) show(0);
+}
+
+void CFastLED::show(uint8_t scale) {
+  // Every controller drives the same pin; the one with LEDs wins
+  host::HeapHooksPaused paused;  // The frame record is the host's, not the RMT driver's
+  frame.clear();
+  for (auto& c : controllers) {
+    for (int i = 0; i < c->size(); i++) {
+      CRGB px = c->leds()[i];
+      px.nscale8(scale);
+      frame.push_back((uint32_t)px.r << 16 | (uint32_t)px.g << 8 | px.b);
+    }
+  }
+  show_count++;
+}
+
+namespace host {
+
+const std::vector<uint32_t>& ledFrame() {
+  return frame;
+}
+
+uint32_t ledShowCount() {
+  return show_count;
+}
+
+}  // namespace host
@@ -0,0 +1,218 @@
+// In-memory LittleFS for the host build, optionally loaded from and saved to
+// a directory on the host.
+#include <FS.h>
+#include <LittleFS.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include "host_hal.h"
+
+LittleFSFS LittleFS;
+
+// Same size as the littlefs partition in partitions.csv
+static const size_t FS_TOTAL_BYTES = 1536 * 1024;
+
+typedef std::shared_ptr<std::string> FileData;
+static std::map<std::string, FileData> files;
+
+namespace fs {
+
+struct FileImpl {
+  std::string path;
+  FileData data;      // Null for directories
+  size_t pos = 0;
+  bool writable = false;
+  std::vector<std::string> entries;  // Directory listing
+  size_t next_entry = 0;
+};
+
+size_t File::write(const uint8_t* buf, size_t size) {
+  if (!_impl || !_impl->data || !_impl->writable) return 0;
+  host::HeapHooksPaused paused;  // Flash on the device, not its heap
+  std::string& d = *_impl->data;
+  if (_impl->pos > d.size()) d.resize(_impl->pos);
+  d.replace(_impl->pos, std::min(size, d.size() - _impl->pos), (const char*)buf, size);
+  _impl->pos += size;
+  return size;
+}
+
+int File::available() {
+  if (!_impl || !_impl->data) return 0;
+  return (int)(_impl->data->size() - std::min(_impl->pos, _impl->data->size()));
+}
+
+int File::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+  if (available() <= 0) return -1;
+  return (uint8_t)(*_impl->data)[_impl->pos];
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+  size_t n = std::min(size, (size_t)std::max(available(), 0));
+  if (n) memcpy(buf, _impl->data->data() + _impl->pos, n);
+  if (_impl) _impl->pos += n;
+  return n;
+}
+
+bool File::seek(uint32_t pos) {
+  if (!_impl || !_impl->data || pos > _impl->data->size()) return false;
+  _impl->pos = pos;
+  return true;
+}
+
+size_t File::position() const {
+  return _impl ? _impl->pos : 0;
+}
+
+size_t File::size() const {
+  return _impl && _impl->data ? _impl->data->size() : 0;
+}
+
+void File::close() {
+  _impl.reset();
+}
+
+const char* File::name() const {
+  if (!_impl) return "";
+  size_t slash = _impl->path.rfind('/');
+  return _impl->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+const char* File::path() const {
+  return _impl ? _impl->path.c_str() : "";
+}
+
+bool File::isDirectory() const {
+  return _impl && !_impl->data;
+}
+
+File File::openNextFile() {
+  if (!isDirectory() || _impl->next_entry >= _impl->entries.size()) return File();
+  return LittleFS.open(_impl->entries[_impl->next_entry++].c_str(), "r");
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+  (void)create;
+  std::string p = path;
+  auto impl = std::make_shared<FileImpl>();
+  impl->path = p;
+
+  if (mode[0] == 'r') {
+    auto it = files.find(p);
+    if (it != files.end()) {
+      impl->data = it->second;
+      impl->writable = strchr(mode, '+') != nullptr;
+      return File(impl);
+    }
+    // A path that prefixes stored files is a directory
+    std::string prefix = p == "/" ? p : p + "/";
+    for (auto& f : files) {
+      if (f.first.compare(0, prefix.size(), prefix) == 0) impl->entries.push_back(f.first);
+    }
+    return impl->entries.empty() ? File() : File(impl);
+  }
+
+  FileData& data = files[p];
+  if (!data) data = std::make_shared<std::string>();
+  if (mode[0] == 'w') data->clear();
+  impl->data = data;
+  impl->writable = true;
+  impl->pos = mode[0] == 'a' ? data->size() : 0;
+  return File(impl);
+}
+
+bool FS::exists(const char* path) {
+  return files.count(path) != 0;
+}
+
+bool FS::remove(const char* path) {
+  return files.erase(path) != 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+  auto it = files.find(from);
+  if (it == files.end()) return false;
+  files[to] = it->second;
+  files.erase(it);
+  return true;
+}
+
+}  // namespace fs
+
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+  (void)formatOnFail;
+  (void)basePath;
+  (void)maxOpenFiles;
+  (void)partitionLabel;
+  return true;
+}
+
+bool LittleFSFS::format() {
+  files.clear();
+  return true;
+}
+
+size_t LittleFSFS::totalBytes() {
+  return FS_TOTAL_BYTES;
+}
+
+size_t LittleFSFS::usedBytes() {
+  size_t used = 0;
+  for (auto& f : files) used += f.second->size();
+  return used;
+}
+
+namespace host {
+
+static bool loadTree(const std::string& dir, const std::string& prefix) {
+  DIR* d = opendir(dir.c_str());
+  if (!d) return false;
+  while (struct dirent* e = readdir(d)) {
+    std::string name = e->d_name;
+    if (name == "." || name == "..") continue;
+    std::string full = dir + "/" + name;
+    struct stat st;
+    if (stat(full.c_str(), &st) != 0) continue;
+    if (S_ISDIR(st.st_mode)) {
+      loadTree(full, prefix + name + "/");
+    } else {
+      std::ifstream in(full, std::ios::binary);
+      std::stringstream buf;
+      buf << in.rdbuf();
+      files[prefix + name] = std::make_shared<std::string>(buf.str());
+    }
+  }
+  closedir(d);
+  return true;
+}
+
+bool fsLoadDirectory(const std::string& dir) {
+  return loadTree(dir, "/");
+}
+
+bool fsSaveDirectory(const std::string& dir) {
+  mkdir(dir.c_str(), 0755);
+  bool ok = true;
+  for (auto& f : files) {
+    // Recreate subdirectories of nested paths
+    for (size_t slash = f.first.find('/', 1); slash != std::string::npos; slash = f.first.find('/', slash + 1)) {
+      mkdir((dir + f.first.substr(0, slash)).c_str(), 0755);
+    }
+    std::ofstream out(dir + f.first, std::ios::binary | std::ios::trunc);
+    out.write(f.second->data(), f.second->size());
+    ok = ok && out.good();
+  }
+  return ok;
+}
+
+void fsFormat() {
+  files.clear();
+}
+
+}  // namespace host
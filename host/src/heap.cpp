@@ -0,0 +1,127 @@
+// Heap accounting for the host build: every malloc/new made by the process,
+// firmware and stand-ins alike, at host (64-bit) sizes. Under ASan (the
+// libFuzzer build) the sanitizer allocator has hooks for it; otherwise the
+// malloc family is interposed here and forwarded to glibc. Aligned
+// allocations (posix_memalign & co.) are not seen by the glibc variant;
+// nothing in the firmware makes them.
+//
+// As on an ESP32 built with CONFIG_HEAP_USE_HOOKS, every allocation and free
+// is also passed to esp_heap_trace_alloc_hook()/esp_heap_trace_free_hook()
+// when the firmware defines them (heap_guard.cpp).
+#include <esp_heap_caps.h>
+#include <stddef.h>
+#include <atomic>
+#include "host_hal.h"
+
+// Atomic: tasks (freertos/task.h) are threads
+static std::atomic<int64_t> current_bytes(0);
+static std::atomic<int64_t> peak_bytes(0);
+static std::atomic<uint64_t> alloc_count(0);
+// Also set while a hook runs, so a hook that allocates cannot recurse
+static thread_local int hooks_paused = 0;
+
+static inline void heapAdd(void* ptr, size_t n) {
+  int64_t now = current_bytes += (int64_t)n;
+  int64_t peak = peak_bytes.load();
+  while (now > peak && !peak_bytes.compare_exchange_weak(peak, now)) {
+  }
+  alloc_count++;
+  if (!hooks_paused && esp_heap_trace_alloc_hook) {
+    hooks_paused++;
+    esp_heap_trace_alloc_hook(ptr, n, MALLOC_CAP_DEFAULT);
+    hooks_paused--;
+  }
+}
+
+static inline void heapSub(void* ptr, size_t n) {
+  current_bytes -= (int64_t)n;
+  if (!hooks_paused && esp_heap_trace_free_hook) {
+    hooks_paused++;
+    esp_heap_trace_free_hook(ptr);
+    hooks_paused--;
+  }
+}
+
+#if BAMBULED_FUZZ_SANITIZER
+
+#include <sanitizer/allocator_interface.h>
+
+static void onMalloc(const volatile void* ptr, size_t size) {
+  if (ptr) heapAdd((void*)ptr, size);
+}
+
+static void onFree(const volatile void* ptr) {
+  if (ptr) heapSub((void*)ptr, __sanitizer_get_allocated_size((const void*)ptr));
+}
+
+__attribute__((constructor)) static void installSanitizerHooks() {
+  __sanitizer_install_malloc_and_free_hooks(onMalloc, onFree);
+}
+
+#else
+
+#include <malloc.h>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+  void* p = __libc_malloc(size);
+  if (p) heapAdd(p, malloc_usable_size(p));
+  return p;
+}
+
+void* calloc(size_t count, size_t size) {
+  void* p = __libc_calloc(count, size);
+  if (p) heapAdd(p, malloc_usable_size(p));
+  return p;
+}
+
+void* realloc(void* ptr, size_t size) {
+  size_t old = ptr ? malloc_usable_size(ptr) : 0;
+  void* p = __libc_realloc(ptr, size);
+  if (p || size == 0) {
+    if (ptr) heapSub(ptr, old);
+    if (p) heapAdd(p, malloc_usable_size(p));
+  }
+  return p;
+}
+
+void free(void* ptr) {
+  if (ptr) heapSub(ptr, malloc_usable_size(ptr));
+  __libc_free(ptr);
+}
+}
+
+#endif
+
+namespace host {
+
+int64_t heapInUse() {
+  return current_bytes;
+}
+
+int64_t heapPeak() {
+  return peak_bytes;
+}
+
+void heapResetPeak() {
+  peak_bytes = current_bytes.load();
+}
+
+uint64_t heapAllocCount() {
+  return alloc_count;
+}
+
+void heapPauseHooks() {
+  hooks_paused++;
+}
+
+void heapResumeHooks() {
+  hooks_paused--;
+}
+
+}  // namespace host
@@ -0,0 +1,238 @@
+// Loopback MQTT broker and the PubSubClient stand-in that talks to it
+#include <PubSubClient.h>
+#include <deque>
+#include <map>
+#include "host_hal.h"
+
+// Fixed header plus topic length field, as counted by PubSubClient
+static const size_t MQTT_PACKET_OVERHEAD = 7;
+
+// One session per client id, so the printer connection and the bridge
+// (mqtt_bridge.cpp) can be connected at the same time
+struct Session {
+  uint32_t id = 0;   // Bumped on every connect with this client id
+  bool open = false;
+  std::vector<std::string> subscriptions;
+};
+
+static bool broker_available = true;
+static uint32_t session_count = 0;
+static std::map<std::string, Session> sessions;
+static uint32_t connect_count = 0;
+static std::deque<host::MqttMessage> inbox;
+static std::vector<host::MqttMessage> published;
+
+// MQTT topic filter match with + and # wildcards
+static bool topicMatches(const std::string& filter, const std::string& topic) {
+  size_t f = 0, t = 0;
+  while (f < filter.size()) {
+    if (filter[f] == '#') return true;
+    if (filter[f] == '+') {
+      while (t < topic.size() && topic[t] != '/') t++;
+      f++;
+      continue;
+    }
+    if (t >= topic.size() || filter[f] != topic[t]) return false;
+    f++;
+    t++;
+  }
+  return t == topic.size();
+}
+
+static bool sessionSubscribed(const Session& session, const std::string& topic) {
+  if (!session.open) return false;
+  for (const auto& filter : session.subscriptions) {
+    if (topicMatches(filter, topic)) return true;
+  }
+  return false;
+}
+
+static void closeSessions() {
+  for (auto& entry : sessions) entry.second.open = false;
+}
+
+PubSubClient& PubSubClient::setServer(const char* domain, uint16_t port) {
+  (void)domain;
+  (void)port;
+  return *this;
+}
+
+bool PubSubClient::setBufferSize(uint16_t size) {
+  if (size == 0) return false;
+  _bufferSize = size;
+  _buffer.assign(size, 0);
+  return true;
+}
+
+bool PubSubClient::connect(const char* id, const char* user, const char* pass) {
+  return connect(id, user, pass, nullptr, 0, false, nullptr);
+}
+
+bool PubSubClient::connect(const char* id, const char* user, const char* pass, const char* willTopic,
+                           uint8_t willQos, bool willRetain, const char* willMessage) {
+  (void)user;
+  (void)pass;
+  (void)willTopic;
+  (void)willQos;
+  (void)willRetain;
+  (void)willMessage;
+  if (!host::wifiAvailable() || !broker_available) {
+    _state = MQTT_CONNECT_FAILED;
+    return false;
+  }
+  // A new connection replaces the previous session with this client id
+  host::HeapHooksPaused paused;  // Broker side
+  _clientId = id ? id : "";
+  Session& session = sessions[_clientId];
+  session.subscriptions.clear();
+  session.id = ++session_count;
+  session.open = true;
+  connect_count++;
+  _session = session.id;
+  _state = MQTT_CONNECTED;
+  return true;
+}
+
+void PubSubClient::disconnect() {
+  if (connected()) sessions[_clientId].open = false;
+  _state = MQTT_DISCONNECTED;
+}
+
+bool PubSubClient::connected() {
+  if (_state != MQTT_CONNECTED) return false;
+  auto it = sessions.find(_clientId);
+  if (it == sessions.end() || !it->second.open || it->second.id != _session || !host::wifiAvailable()) {
+    _state = MQTT_CONNECTION_LOST;
+    return false;
+  }
+  return true;
+}
+
+bool PubSubClient::publish(const char* topic, const char* payload, bool retained) {
+  return publish(topic, (const uint8_t*)payload, payload ? strlen(payload) : 0, retained);
+}
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained) {
+  if (!connected()) return false;
+  if (strlen(topic) + length + MQTT_PACKET_OVERHEAD > _bufferSize) return false;
+  host::HeapHooksPaused paused;  // Broker side; the real client writes from its buffer
+  published.push_back({topic, std::string((const char*)payload, length), retained});
+  return true;
+}
+
+bool PubSubClient::beginPublish(const char* topic, unsigned int length, bool retained) {
+  if (!connected()) return false;
+  host::HeapHooksPaused paused;
+  _pendingTopic = topic;
+  _pendingPayload.clear();
+  _pendingPayload.reserve(length);
+  _pendingRetained = retained;
+  return true;
+}
+
+size_t PubSubClient::write(const uint8_t* buf, size_t size) {
+  host::HeapHooksPaused paused;
+  _pendingPayload.append((const char*)buf, size);
+  return size;
+}
+
+int PubSubClient::endPublish() {
+  if (!connected()) return 0;
+  // Streamed publishes bypass the buffer limit, as in the real client
+  host::HeapHooksPaused paused;
+  published.push_back({_pendingTopic, _pendingPayload, _pendingRetained});
+  return 1;
+}
+
+bool PubSubClient::subscribe(const char* topic, uint8_t qos) {
+  (void)qos;
+  if (!connected()) return false;
+  host::HeapHooksPaused paused;
+  sessions[_clientId].subscriptions.push_back(topic);
+  return true;
+}
+
+bool PubSubClient::unsubscribe(const char* topic) {
+  if (!connected()) return false;
+  std::vector<std::string>& subscriptions = sessions[_clientId].subscriptions;
+  for (auto it = subscriptions.begin(); it != subscriptions.end(); ++it) {
+    if (*it == topic) {
+      subscriptions.erase(it);
+      break;
+    }
+  }
+  return true;
+}
+
+bool PubSubClient::loop() {
+  if (!connected()) return false;
+  // One packet per call, like the real client reading its socket
+  const Session& session = sessions[_clientId];
+  while (!inbox.empty()) {
+    // Left for the client whose subscription it matches
+    if (!sessionSubscribed(session, inbox.front().topic) && host::mqttIsSubscribed(inbox.front().topic)) break;
+    size_t topicLen = inbox.front().topic.size();
+    size_t payloadLen = inbox.front().payload.size();
+    bool deliver = sessionSubscribed(session, inbox.front().topic) &&
+                   topicLen + payloadLen + MQTT_PACKET_OVERHEAD <= _bufferSize;
+    if (deliver) {
+      // Topic, NUL, payload: laid out in the packet buffer as the real client does
+      memcpy(&_buffer[0], inbox.front().topic.data(), topicLen);
+      _buffer[topicLen] = 0;
+      memcpy(&_buffer[topicLen + 1], inbox.front().payload.data(), payloadLen);
+    }
+    {
+      host::HeapHooksPaused paused;  // Broker side
+      inbox.pop_front();
+    }
+    if (!deliver) continue;
+    if (_callback) _callback((char*)&_buffer[0], &_buffer[topicLen + 1], payloadLen);
+    break;
+  }
+  return true;
+}
+
+namespace host {
+
+void mqttSetBrokerAvailable(bool available) {
+  broker_available = available;
+  if (!available) closeSessions();
+}
+
+void mqttDropConnection() {
+  closeSessions();
+}
+
+bool mqttIsSubscribed(const std::string& topic) {
+  for (const auto& entry : sessions) {
+    if (sessionSubscribed(entry.second, topic)) return true;
+  }
+  return false;
+}
+
+std::vector<std::string> mqttSubscriptions() {
+  std::vector<std::string> all;
+  for (const auto& entry : sessions) {
+    if (!entry.second.open) continue;
+    all.insert(all.end(), entry.second.subscriptions.begin(), entry.second.subscriptions.end());
+  }
+  return all;
+}
+
+void mqttInject(const std::string& topic, const std::string& payload) {
+  inbox.push_back({topic, payload, false});
+}
+
+const std::vector<MqttMessage>& mqttPublished() {
+  return published;
+}
+
+void mqttClearPublished() {
+  published.clear();
+}
+
+uint32_t mqttConnectCount() {
+  return connect_count;
+}
+
+}  // namespace host
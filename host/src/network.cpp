@@ -0,0 +1,149 @@
+// WiFi, loopback WiFiClient and WiFiManager for the host build
+#include <WiFi.h>
+#include <WiFiManager.h>
+#include "host_hal.h"
+
+WiFiClass WiFi;
+
+static bool wifi_available = true;
+
+// --- WiFiClient ---
+
+WiFiClient::WiFiClient(std::shared_ptr<host::Socket> socket) : _handle(std::make_shared<Handle>()) {
+  _handle->socket = socket;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+  // No outbound network from the host build
+  (void)host;
+  (void)port;
+  return 0;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) {
+  (void)ip;
+  (void)port;
+  return 0;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeout_ms) {
+  // The MQTT bridge opens its TCP connection itself, then PubSubClient talks
+  // to the loopback broker (mqtt.cpp), which decides whether it connects
+  (void)ip;
+  (void)port;
+  (void)timeout_ms;
+  return wifi_available ? 1 : 0;
+}
+
+size_t WiFiClient::write(const uint8_t* buf, size_t size) {
+  if (!connected()) return 0;
+  _handle->socket->from_device.append((const char*)buf, size);
+  return size;
+}
+
+int WiFiClient::available() {
+  if (!_handle || !_handle->socket) return 0;
+  host::Socket& s = *_handle->socket;
+  return (int)(s.to_device.size() - s.read_pos);
+}
+
+int WiFiClient::read() {
+  if (available() <= 0) return -1;
+  host::Socket& s = *_handle->socket;
+  return (uint8_t)s.to_device[s.read_pos++];
+}
+
+int WiFiClient::peek() {
+  if (available() <= 0) return -1;
+  host::Socket& s = *_handle->socket;
+  return (uint8_t)s.to_device[s.read_pos];
+}
+
+void WiFiClient::stop() {
+  if (_handle && _handle->socket) _handle->socket->device_open = false;
+  _handle.reset();
+}
+
+uint8_t WiFiClient::connected() {
+  if (!_handle || !_handle->socket) return 0;
+  host::Socket& s = *_handle->socket;
+  return s.device_open && (s.peer_open || available() > 0);
+}
+
+IPAddress WiFiClient::remoteIP() {
+  if (!_handle || !_handle->socket) return IPAddress();
+  const uint8_t* ip = _handle->socket->remote_ip;
+  return IPAddress(ip[0], ip[1], ip[2], ip[3]);
+}
+
+// --- WiFiClass ---
+
+wl_status_t WiFiClass::status() {
+  if (!_started) return WL_IDLE_STATUS;
+  return wifi_available ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+wl_status_t WiFiClass::begin() {
+  _started = true;
+  return status();
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase) {
+  (void)ssid;
+  (void)passphrase;
+  return begin();
+}
+
+uint8_t WiFiClass::waitForConnectResult(unsigned long timeoutLength) {
+  // Association is instant; a missing network fails after the full timeout
+  if (_started && !wifi_available) delay(timeoutLength);
+  return status();
+}
+
+bool WiFiClass::disconnect(bool wifioff) {
+  _started = false;
+  if (wifioff) _mode = WIFI_OFF;
+  return true;
+}
+
+String WiFiClass::SSID() {
+  return status() == WL_CONNECTED ? String("host-loopback") : String("");
+}
+
+int8_t WiFiClass::RSSI() {
+  return status() == WL_CONNECTED ? -55 : 0;
+}
+
+IPAddress WiFiClass::localIP() {
+  return status() == WL_CONNECTED ? IPAddress(127, 0, 0, 1) : IPAddress();
+}
+
+int WiFiClass::hostByName(const char* name, IPAddress& result) {
+  // Every name is the loopback broker
+  if (result.fromString(name)) return 1;
+  if (status() != WL_CONNECTED) return 0;
+  result = IPAddress(127, 0, 0, 1);
+  return 1;
+}
+
+// --- WiFiManager ---
+
+bool WiFiManager::autoConnect(const char* apName, const char* apPassword) {
+  (void)apName;
+  (void)apPassword;
+  WiFi.mode(WIFI_STA);
+  WiFi.begin();
+  return WiFi.waitForConnectResult() == WL_CONNECTED;
+}
+
+namespace host {
+
+void wifiSetAvailable(bool available) {
+  wifi_available = available;
+}
+
+bool wifiAvailable() {
+  return wifi_available;
+}
+
+}  // namespace host
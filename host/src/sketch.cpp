@@ -0,0 +1,2 @@
+// The sketch itself, compiled as ordinary C++ against the stand-ins
+#include "BambuLed.ino"
@@ -0,0 +1,276 @@
+// WebServer stand-in: requests queued by host::httpSubmit() are served from
+// handleClient(), one per call like the real server.
+#include <WebServer.h>
+#include <deque>
+#include <strings.h>
+#include "host_hal.h"
+
+static std::deque<host::HttpRequest> pending_requests;
+
+static const char* reasonPhrase(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 302: return "Found";
+    case 303: return "See Other";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 413: return "Payload Too Large";
+    case 429: return "Too Many Requests";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "";
+  }
+}
+
+static HTTPMethod parseMethod(const std::string& m) {
+  if (m == "GET") return HTTP_GET;
+  if (m == "HEAD") return HTTP_HEAD;
+  if (m == "POST") return HTTP_POST;
+  if (m == "PUT") return HTTP_PUT;
+  if (m == "PATCH") return HTTP_PATCH;
+  if (m == "DELETE") return HTTP_DELETE;
+  if (m == "OPTIONS") return HTTP_OPTIONS;
+  return HTTP_ANY;
+}
+
+static String urlDecode(const std::string& s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s[i] == '+') {
+      out += ' ';
+    } else if (s[i] == '%' && i + 2 < s.size()) {
+      out += (char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16);
+      i += 2;
+    } else {
+      out += s[i];
+    }
+  }
+  return String(out);
+}
+
+template <typename Pairs>
+static void parseQuery(const std::string& query, Pairs& args) {
+  size_t start = 0;
+  while (start < query.size()) {
+    size_t end = query.find('&', start);
+    if (end == std::string::npos) end = query.size();
+    std::string item = query.substr(start, end - start);
+    size_t eq = item.find('=');
+    if (!item.empty()) {
+      args.push_back({urlDecode(item.substr(0, eq)), eq == std::string::npos ? String("") : urlDecode(item.substr(eq + 1))});
+    }
+    start = end + 1;
+  }
+}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn) {
+  _routes.push_back({uri, method, fn, ufn});
+}
+
+void WebServer::handleClient() {
+  if (!_running || pending_requests.empty()) return;
+  host::HttpRequest request = pending_requests.front();
+  pending_requests.pop_front();
+  serve(request);
+}
+
+void WebServer::serve(const host::HttpRequest& request) {
+  _currentClient = WiFiClient(request.socket);
+  size_t q = request.uri.find('?');
+  _currentUri = String(request.uri.substr(0, q));
+  _currentMethod = parseMethod(request.method);
+  _args.clear();
+  _requestHeaders.clear();
+  _responseHeaders = "";
+  _contentLength = CONTENT_LENGTH_NOT_SET;
+  _chunked = false;
+
+  if (q != std::string::npos) parseQuery(request.uri.substr(q + 1), _args);
+  for (const auto& h : request.headers) _requestHeaders.push_back({String(h.first), String(h.second)});
+  if (request.content_type == "application/x-www-form-urlencoded") {
+    parseQuery(request.body, _args);
+  } else if (!request.body.empty()) {
+    _args.push_back({String("plain"), String(request.body)});
+  }
+
+  const Route* route = nullptr;
+  for (const auto& r : _routes) {
+    if (r.uri == _currentUri && (r.method == HTTP_ANY || r.method == _currentMethod)) {
+      route = &r;
+      break;
+    }
+  }
+
+  if (!request.upload_filename.empty()) runUpload(request, route);
+
+  if (route) {
+    route->fn();
+  } else if (_notFoundHandler) {
+    _notFoundHandler();
+  } else {
+    send(404, "text/plain", String("Not found: ") + _currentUri);
+  }
+
+  // Finish a chunked response the handler left open. A handler that kept a
+  // copy of client() (event streams) keeps the connection open.
+  if (_chunked) sendContent("", 0);
+  _currentClient = WiFiClient();
+}
+
+void WebServer::runUpload(const host::HttpRequest& request, const Route* route) {
+  THandlerFunction handler = route && route->ufn ? route->ufn : _fileUploadHandler;
+  if (!handler) return;
+
+  _upload.filename = String(request.upload_filename);
+  _upload.name = "file";
+  _upload.type = "application/octet-stream";
+  _upload.totalSize = 0;
+  _upload.currentSize = 0;
+  _upload.status = UPLOAD_FILE_START;
+  handler();
+
+  for (size_t off = 0; off < request.upload_data.size(); off += HTTP_UPLOAD_BUFLEN) {
+    size_t n = std::min((size_t)HTTP_UPLOAD_BUFLEN, request.upload_data.size() - off);
+    memcpy(_upload.buf, request.upload_data.data() + off, n);
+    _upload.currentSize = n;
+    _upload.status = UPLOAD_FILE_WRITE;
+    handler();
+    _upload.totalSize += n;
+  }
+
+  _upload.currentSize = 0;
+  _upload.status = UPLOAD_FILE_END;
+  handler();
+}
+
+String WebServer::arg(const String& name) {
+  for (const auto& a : _args) {
+    if (a.name == name) return a.value;
+  }
+  return String("");
+}
+
+String WebServer::arg(int i) {
+  return i >= 0 && i < (int)_args.size() ? _args[i].value : String("");
+}
+
+String WebServer::argName(int i) {
+  return i >= 0 && i < (int)_args.size() ? _args[i].name : String("");
+}
+
+bool WebServer::hasArg(const String& name) {
+  for (const auto& a : _args) {
+    if (a.name == name) return true;
+  }
+  return false;
+}
+
+String WebServer::header(const String& name) {
+  for (const auto& h : _requestHeaders) {
+    if (h.name.equalsIgnoreCase(name)) return h.value;
+  }
+  return String("");
+}
+
+bool WebServer::hasHeader(const String& name) {
+  for (const auto& h : _requestHeaders) {
+    if (h.name.equalsIgnoreCase(name)) return true;
+  }
+  return false;
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+  String line = name + ": " + value + "\r\n";
+  if (first) {
+    _responseHeaders = line + _responseHeaders;
+  } else {
+    _responseHeaders += line;
+  }
+}
+
+void WebServer::sendHeaders(int code, const char* content_type, size_t length) {
+  String head = String("HTTP/1.1 ") + String(code) + " " + reasonPhrase(code) + "\r\n";
+  if (content_type && *content_type) head += String("Content-Type: ") + content_type + "\r\n";
+  if (_contentLength == CONTENT_LENGTH_UNKNOWN) {
+    _chunked = true;
+    head += "Transfer-Encoding: chunked\r\n";
+  } else {
+    size_t len = _contentLength == CONTENT_LENGTH_NOT_SET ? length : _contentLength;
+    head += String("Content-Length: ") + String((unsigned long)len) + "\r\n";
+  }
+  head += _responseHeaders;
+  head += "Connection: close\r\n\r\n";
+  _responseHeaders = "";
+  _currentClient.write(head.c_str(), head.length());
+}
+
+void WebServer::send(int code, const char* content_type, const String& content) {
+  send_P(code, content_type, content.c_str(), content.length());
+}
+
+void WebServer::send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength) {
+  sendHeaders(code, content_type, contentLength);
+  if (_currentMethod == HTTP_HEAD) return;
+  if (_chunked) {
+    if (contentLength) sendContent(content, contentLength);
+  } else {
+    _currentClient.write((const uint8_t*)content, contentLength);
+  }
+}
+
+void WebServer::sendContent(const char* content, size_t contentLength) {
+  if (_chunked) {
+    char size[12];
+    snprintf(size, sizeof(size), "%zx\r\n", contentLength);
+    _currentClient.write(size, strlen(size));
+    _currentClient.write((const uint8_t*)content, contentLength);
+    _currentClient.write("\r\n", 2);
+    if (contentLength == 0) _chunked = false;
+  } else {
+    _currentClient.write((const uint8_t*)content, contentLength);
+  }
+}
+
+namespace host {
+
+std::shared_ptr<Socket> httpSubmit(const HttpRequest& request) {
+  HttpRequest queued = request;
+  queued.socket = std::make_shared<Socket>();
+  pending_requests.push_back(queued);
+  return queued.socket;
+}
+
+void httpClose(const std::shared_ptr<Socket>& socket) {
+  socket->peer_open = false;
+}
+
+int httpParseResponse(const std::string& raw, std::string* body) {
+  if (raw.compare(0, 9, "HTTP/1.1 ") != 0) return 0;
+  int code = atoi(raw.c_str() + 9);
+  size_t start = raw.find("\r\n\r\n");
+  if (start == std::string::npos) return code;
+  start += 4;
+  if (!body) return code;
+
+  std::string head = raw.substr(0, start);
+  if (strcasestr(head.c_str(), "Transfer-Encoding: chunked") == nullptr) {
+    *body = raw.substr(start);
+    return code;
+  }
+  body->clear();
+  size_t pos = start;
+  while (pos < raw.size()) {
+    size_t eol = raw.find("\r\n", pos);
+    if (eol == std::string::npos) break;
+    size_t len = strtoul(raw.substr(pos, eol - pos).c_str(), nullptr, 16);
+    if (len == 0) break;
+    body->append(raw, eol + 2, len);
+    pos = eol + 2 + len + 2;
+  }
+  return code;
+}
+
+}  // namespace host
@@ -0,0 +1,124 @@
+// WebSocketsServer stand-in: clients are attached from host_hal.h and their
+// events delivered from loop()
+#include <WebSocketsServer.h>
+#include <deque>
+#include "host_hal.h"
+
+struct WsClient {
+  bool open = false;
+  bool announced = false;            // CONNECTED event delivered
+  bool closing = false;              // Peer closed, DISCONNECTED pending
+  std::deque<std::string> inbox;     // Text frames from the peer
+  std::vector<std::string> outbox;   // Frames from the firmware, tagged
+};
+
+static WsClient ws_clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+
+void WebSocketsServer::loop() {
+  if (!_running) return;
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    WsClient& c = ws_clients[num];
+    if (c.closing) {
+      c = WsClient();
+      if (_event) _event(num, WStype_DISCONNECTED, nullptr, 0);
+      continue;
+    }
+    if (!c.open) continue;
+    if (!c.announced) {
+      c.announced = true;
+      if (_event) {
+        uint8_t url[] = "/";
+        _event(num, WStype_CONNECTED, url, 1);
+      }
+    }
+    // One frame per client per call
+    if (!c.inbox.empty()) {
+      std::string text = c.inbox.front();
+      c.inbox.pop_front();
+      if (_event) _event(num, WStype_TEXT, (uint8_t*)&text[0], text.size());
+    }
+  }
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, const char* payload, size_t length) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !ws_clients[num].announced) return false;
+  if (length == 0) length = strlen(payload);
+  ws_clients[num].outbox.push_back(std::string(1, '\0') + std::string(payload, length));
+  return true;
+}
+
+bool WebSocketsServer::sendBIN(uint8_t num, const uint8_t* payload, size_t length) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !ws_clients[num].announced) return false;
+  ws_clients[num].outbox.push_back(std::string(1, '\x01') + std::string((const char*)payload, length));
+  return true;
+}
+
+bool WebSocketsServer::broadcastTXT(const char* payload, size_t length) {
+  bool ok = true;
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    if (ws_clients[num].announced) ok &= sendTXT(num, payload, length);
+  }
+  return ok;
+}
+
+bool WebSocketsServer::broadcastBIN(const uint8_t* payload, size_t length) {
+  bool ok = true;
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    if (ws_clients[num].announced) ok &= sendBIN(num, payload, length);
+  }
+  return ok;
+}
+
+void WebSocketsServer::disconnect() {
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) disconnect(num);
+}
+
+void WebSocketsServer::disconnect(uint8_t num) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !ws_clients[num].open) return;
+  ws_clients[num] = WsClient();
+  if (_event) _event(num, WStype_DISCONNECTED, nullptr, 0);
+}
+
+bool WebSocketsServer::clientIsConnected(uint8_t num) {
+  return num < WEBSOCKETS_SERVER_CLIENT_MAX && ws_clients[num].announced;
+}
+
+uint8_t WebSocketsServer::connectedClients(bool ping) {
+  (void)ping;
+  uint8_t n = 0;
+  for (const auto& c : ws_clients) n += c.announced;
+  return n;
+}
+
+namespace host {
+
+int wsConnect() {
+  for (int num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    if (!ws_clients[num].open) {
+      ws_clients[num] = WsClient();
+      ws_clients[num].open = true;
+      return num;
+    }
+  }
+  return -1;
+}
+
+void wsSendText(int num, const std::string& text) {
+  if (num >= 0 && num < WEBSOCKETS_SERVER_CLIENT_MAX && ws_clients[num].open) ws_clients[num].inbox.push_back(text);
+}
+
+void wsClose(int num) {
+  if (num >= 0 && num < WEBSOCKETS_SERVER_CLIENT_MAX && ws_clients[num].open) ws_clients[num].closing = true;
+}
+
+bool wsIsOpen(int num) {
+  return num >= 0 && num < WEBSOCKETS_SERVER_CLIENT_MAX && ws_clients[num].open && !ws_clients[num].closing;
+}
+
+std::vector<std::string> wsTakeFrames(int num) {
+  std::vector<std::string> frames;
+  if (num >= 0 && num < WEBSOCKETS_SERVER_CLIENT_MAX) frames.swap(ws_clients[num].outbox);
+  return frames;
+}
+
+}  // namespace host
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Compress the static web UI in web/ into BambuLed/web_assets.h.
+
+The Arduino IDE has no pre-build step, so the generated header is committed
+alongside the sources. Re-run this script after editing anything in web/:
+
+    python3 tools/build_web_assets.py
+
+CSS/JS files are served under fingerprinted URLs (/static/<name>.<hash>.<ext>)
+so they can be cached forever; page shells keep a fixed URL and are
+revalidated with their ETag instead.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUT_FILE = os.path.join(ROOT, "BambuLed", "web_assets.h")
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+# Fingerprinted, immutable resources. Order defines the generated symbols.
+STATIC_FILES = ["status.css", "status.js", "config.css", "config.js", "mqtt.css", "mqtt.js",
+                "profile.css", "profile.js"]
+
+# Page shells: (source file, fixed URI).
+PAGE_FILES = [("status.html", "/"), ("mqtt.html", "/mqtt"), ("profile.html", "/profile")]
+
+# Assets only compiled in when a config.h flag is set: file -> macro.
+GUARDS = {
+    "profile.css": "ENABLE_PROFILER",
+    "profile.js": "ENABLE_PROFILER",
+    "profile.html": "ENABLE_PROFILER",
+}
+
+
+def symbol_for(name):
+    return "WEB_ASSET_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def read(name):
+    with open(os.path.join(WEB_DIR, name), "rb") as f:
+        return f.read()
+
+
+def compress(data):
+    # mtime=0 keeps the output (and therefore the ETag) reproducible.
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        chunk = data[i:i + 16]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    assets = []
+    uris = {}
+
+    for name in STATIC_FILES:
+        raw = read(name)
+        stem, ext = os.path.splitext(name)
+        fingerprint = hashlib.sha256(raw).hexdigest()[:8]
+        uri = "/static/%s.%s%s" % (stem, fingerprint, ext)
+        uris[name] = uri
+        assets.append((name, uri, ext, raw, True))
+
+    for name, uri in PAGE_FILES:
+        text = read(name).decode("utf-8")
+        text = re.sub(r"\{\{asset:([^}]+)\}\}", lambda m: uris[m.group(1)], text)
+        ext = os.path.splitext(name)[1]
+        assets.append((name, uri, ext, text.encode("utf-8"), False))
+
+    out = []
+    out.append("// Generated by tools/build_web_assets.py from web/ -- do not edit by hand.")
+    out.append("#ifndef WEB_ASSETS_H")
+    out.append("#define WEB_ASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append('#include "config.h"')
+    out.append("")
+    out.append("struct WebAsset {")
+    out.append("  const char* uri;")
+    out.append("  const char* content_type;")
+    out.append("  const char* etag;")
+    out.append("  bool immutable;          // Fingerprinted URI, safe to cache forever")
+    out.append("  const uint8_t* gz_data;  // gzip-compressed body")
+    out.append("  size_t gz_length;")
+    out.append("  size_t raw_length;       // Before compression")
+    out.append("};")
+    out.append("")
+
+    for name in STATIC_FILES:
+        out.append('#define %s_URI "%s"' % (symbol_for(name), uris[name]))
+    out.append("")
+
+    for name, uri, ext, raw, immutable in assets:
+        gz = compress(raw)
+        if name in GUARDS:
+            out.append("#if %s" % GUARDS[name])
+        out.append("// %s: %d bytes, %d gzipped" % (name, len(raw), len(gz)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % symbol_for(name))
+        out.append(c_array(gz))
+        out.append("};")
+        if name in GUARDS:
+            out.append("#endif")
+        out.append("")
+
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    for name, uri, ext, raw, immutable in assets:
+        gz = compress(raw)
+        etag = '"%s"' % hashlib.sha256(gz).hexdigest()[:16]
+        if name in GUARDS:
+            out.append("#if %s" % GUARDS[name])
+        out.append('  { "%s", "%s", "%s", %s, %s, sizeof(%s), %d },' % (
+            uri, CONTENT_TYPES[ext], etag.replace('"', '\\"'),
+            "true" if immutable else "false", symbol_for(name), symbol_for(name), len(raw)))
+        if name in GUARDS:
+            out.append("#endif")
+    out.append("};")
+    out.append("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    out.append("")
+    out.append("#endif")
+
+    with open(OUT_FILE, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+    total_raw = sum(len(a[3]) for a in assets)
+    total_gz = sum(len(compress(a[3])) for a in assets)
+    print("Wrote %s (%d assets, %d -> %d bytes)" % (OUT_FILE, len(assets), total_raw, total_gz))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,22 @@
+function updatePreview() {
+  try {
+    let state = document.querySelector('input[name="preview_state"]:checked').value;
+    let color = document.getElementById(state + '_color').value;
+    if (!color.match(/^[0-9a-fA-F]{6}$/)) { color = '000000'; }
+    let bright = parseInt(document.getElementById(state + '_bright').value, 10);
+    if (isNaN(bright) || bright < 0 || bright > 255) { bright = 0; }
+    let opacity = (bright / 255).toFixed(2);
+    let vleds = document.querySelectorAll('.vled');
+    vleds.forEach(led => {
+      led.style.backgroundColor = '#' + color;
+      led.style.opacity = opacity;
+    });
+    let states = ['idle', 'print', 'pause', 'error', 'finish'];
+    states.forEach(s => {
+      let c = document.getElementById(s + '_color').value;
+      if (!c.match(/^[0-9a-fA-F]{6}$/)) { c = '000000'; }
+      document.getElementById(s + '_color_swatch').style.backgroundColor = '#' + c;
+    });
+  } catch (e) { console.error('Preview update failed:', e); }
+}
+document.addEventListener('DOMContentLoaded', updatePreview);
@@ -0,0 +1,58 @@
+// Pages through /mqtt/history.json with a cursor, then keeps polling for new
+// entries. The device only ever holds one page of output in memory.
+const PAGE_SIZE = 25;
+const POLL_MS = 3000;
+
+let cursor = 0;
+let shown = 0;
+let generation = 0;
+
+function appendEntry(log, entry) {
+  let line = document.createElement('span');
+  if (entry.hl) line.className = 'highlight';
+  line.textContent = entry.msg + '\n';
+  log.appendChild(line);
+  shown++;
+}
+
+async function fetchPage(gen) {
+  const hlOnly = document.getElementById('highlight-only').checked ? '&highlight_only=1' : '';
+  const res = await fetch('/mqtt/history.json?after=' + cursor + '&limit=' + PAGE_SIZE + hlOnly);
+  const page = await res.json();
+  if (gen !== generation) return false;
+
+  const log = document.getElementById('log');
+  if (shown === 0) log.textContent = page.entries.length ? '' : 'No data received yet.';
+  if (page.gap && shown > 0) {
+    let gap = document.createElement('span');
+    gap.className = 'gap';
+    gap.textContent = '... older entries were dropped before they could be loaded ...\n';
+    log.appendChild(gap);
+  }
+  page.entries.forEach(entry => appendEntry(log, entry));
+
+  cursor = page.next;
+  document.getElementById('shown').innerText = shown;
+  document.getElementById('max').innerText = page.max;
+  return page.more;
+}
+
+async function load(gen) {
+  try {
+    while (await fetchPage(gen)) {}
+  } catch (e) {
+    console.error('History fetch failed:', e);
+  }
+  if (gen === generation) setTimeout(() => load(gen), POLL_MS);
+}
+
+function restart() {
+  generation++;
+  cursor = 0;
+  shown = 0;
+  document.getElementById('log').textContent = 'Loading...';
+  load(generation);
+}
+
+document.getElementById('highlight-only').addEventListener('change', restart);
+restart();
@@ -0,0 +1,43 @@
+function cell(row, text) {
+  const td = document.createElement('td');
+  td.innerText = text;
+  row.appendChild(td);
+}
+
+function render(data) {
+  document.getElementById('window').innerText = data.window;
+  document.getElementById('stall-threshold').innerText = data.stall_threshold_us;
+  document.getElementById('stall-total').innerText = data.stall_total;
+
+  const stages = document.querySelector('#stages tbody');
+  stages.innerHTML = '';
+  data.stages.forEach(s => {
+    const row = document.createElement('tr');
+    if (s.p99 >= data.stall_threshold_us) row.className = 'slow';
+    [s.name, s.count, s.min, s.avg, s.p99, s.max, s.max_ever].forEach(v => cell(row, v));
+    stages.appendChild(row);
+  });
+
+  const stalls = document.querySelector('#stalls tbody');
+  stalls.innerHTML = '';
+  data.stalls.forEach(st => {
+    const row = document.createElement('tr');
+    cell(row, (st.age_ms / 1000).toFixed(1) + ' s');
+    cell(row, st.total_us);
+    const parts = Object.entries(st.stages)
+      .sort((a, b) => b[1] - a[1])
+      .map(([name, us]) => name + ' ' + us);
+    cell(row, parts.join(', '));
+    stalls.appendChild(row);
+  });
+}
+
+function refresh() {
+  fetch('/profile.json')
+    .then(r => r.json())
+    .then(render)
+    .catch(e => console.error('Profile fetch failed:', e));
+}
+
+refresh();
+setInterval(() => { if (!document.hidden) refresh(); }, 2000);
@@ -0,0 +1,399 @@
+let ws;
+let detailsVersion; // details_version of the HMS/AMS lists on the page
+
+// --- Binary status frames ---
+// Must match StatusFrame and the code enums in BambuLed/status_cache.h.
+const FRAME_MAGIC = 0xB1;
+const FRAME_VERSION = 2;
+const GCODE_STATES = ['UNKNOWN', 'IDLE', 'PREPARE', 'RUNNING', 'PAUSE', 'PAUSED',
+  'FINISH', 'FAILED', 'STOP', 'SLICING', 'INIT', 'OFFLINE'];
+const LIGHT_MODES = ['UNKNOWN', 'on', 'off', 'flashing'];
+const LIGHT_EXTRAS = ['', ' (Finish light ON - timing out...)', ' (Finish light OFF - timeout complete)'];
+const LED_STATUSES = [
+  ['Disabled', 'disconnected'],
+  ['Error (Blinking Red)', 'error'],
+  ['Paused (Pulsing Orange)', 'warning'],
+  ['Print Finished (Green)', 'connected'],
+  ['Print Finished (Green) (Timing out...)', 'connected'],
+  ['Idle (Finish Timeout)', 'light-on'],
+  ['Printing Progress', 'warning'],
+  ['Idle/Off', 'light-on'],
+  ['HMS Fatal Error (Strobing Red)', 'error'],
+  ['HMS Error (Blinking Red)', 'error'],
+  ['HMS Warning (Double Flash Orange)', 'warning']
+];
+
+function decodeStatusFrame(buf) {
+  const v = new DataView(buf);
+  if (v.byteLength < 40 || v.getUint8(0) !== FRAME_MAGIC || v.getUint8(1) !== FRAME_VERSION) return null;
+  const flags = v.getUint16(2, true);
+  const percent = v.getUint8(9);
+  const dbm = v.getInt8(26);
+  const ledStatus = LED_STATUSES[v.getUint8(30)] || ['Unknown', 'disconnected'];
+  return {
+    version: v.getUint32(4, true),
+    mqtt_connected: !!(flags & 1),
+    light_is_on: !!(flags & 2),
+    manual_control: !!(flags & 4),
+    is_printing: !!(flags & 8),
+    invert_output: !!(flags & 16),
+    state_stale: !!(flags & 32),
+    gcode_state: GCODE_STATES[v.getUint8(8)] || 'UNKNOWN',
+    print_percentage: percent,
+    stage: v.getInt16(10, true),
+    layer_num: v.getUint16(12, true),
+    time_remaining: v.getInt32(14, true),
+    nozzle_temp: v.getInt16(18, true) / 10,
+    nozzle_target_temp: v.getInt16(20, true) / 10,
+    bed_temp: v.getInt16(22, true) / 10,
+    bed_target_temp: v.getInt16(24, true) / 10,
+    wifi_signal: dbm ? dbm + 'dBm' : 'N/A',
+    bambu_light_mode: LIGHT_MODES[v.getUint8(27)],
+    chamber_bright: v.getUint8(28),
+    light_mode_extra: LIGHT_EXTRAS[v.getUint8(29)] || '',
+    led_status_str: v.getUint8(30) === 6 ? 'Printing Progress (' + percent + '%)' : ledStatus[0],
+    led_status_class: ledStatus[1],
+    led_bright_val: v.getUint8(31),
+    led_color_val: (v.getUint8(32) << 16) | (v.getUint8(33) << 8) | v.getUint8(34),
+    light_pin: v.getUint8(35),
+    led_pin: v.getUint8(36),
+    num_leds: v.getUint8(37),
+    details_version: v.getUint16(38, true)
+  };
+}
+
+function formatTime(s) {
+  if (s <= 0) return '--:--:--';
+  let h = Math.floor(s / 3600); s %= 3600;
+  let m = Math.floor(s / 60); s %= 60;
+  let m_str = m < 10 ? '0' + m : m;
+  let s_str = s < 10 ? '0' + s : s;
+  return h > 0 ? h + ':' + m_str + ':' + s_str : m_str + ':' + s_str;
+}
+
+function buildVirtualLeds(count) {
+  let bar = document.getElementById('virtual-bar');
+  if (bar.dataset.count === String(count)) return;
+  bar.dataset.count = count;
+  if (count === 0) {
+    bar.innerHTML = "<div style='flex-grow: 1; height: 100%; text-align: center; color: #888; padding-top: 5px; font-size: 0.9em;'>LEDs disabled</div>";
+    return;
+  }
+  bar.innerHTML = "<div class='vled' style='flex-grow: 1; height: 100%;'></div>".repeat(count);
+}
+
+function updateDeviceInfo(data) {
+  if (data.wifi_ssid !== undefined) {
+    document.getElementById('wifi-status').innerText = 'CONNECTED (' + data.wifi_ssid + ' / ' + data.ip + ')';
+  }
+  document.getElementById('light-pin').innerText = data.light_pin;
+  document.getElementById('light-logic').innerText = data.invert_output ? 'Active LOW' : 'Active HIGH';
+  document.getElementById('led-pin').innerText = data.led_pin;
+  document.getElementById('led-count').innerText = data.num_leds;
+  buildVirtualLeds(data.num_leds);
+}
+
+// Binary frames carry no HMS list (only the LED status); keep the last one.
+// fetchStatusJson() brings it up to date when their details_version moves.
+function updateHms(data) {
+  if (data.hms === undefined) return;
+  const div = document.getElementById('hms-div');
+  const list = document.getElementById('hms-list');
+  list.replaceChildren();
+  data.hms.forEach(e => {
+    const item = document.createElement('li');
+    item.textContent = e.severity.toUpperCase() + ' ' + e.code + ': ' +
+      (e.description || e.module + ' error, see the Bambu Lab wiki');
+    list.appendChild(item);
+  });
+  if (data.hms_more) {
+    const item = document.createElement('li');
+    item.textContent = '+' + data.hms_more + ' more';
+    list.appendChild(item);
+  }
+  div.style.display = data.hms.length ? '' : 'none';
+  const worst = data.hms.length ? data.hms[0].severity : '';
+  div.className = 'status ' + (worst === 'fatal' || worst === 'serious' ? 'error' : 'warning');
+}
+
+// Binary frames carry no AMS trays either and are refreshed the same way
+// (JSON always has "hms", and omits "ams" without units). Trays are numbered across units, four per unit, as in
+// tray_now.
+function updateAms(data) {
+  if (data.hms === undefined) return;
+  const div = document.getElementById('ams-div');
+  const container = document.getElementById('ams-units');
+  container.replaceChildren();
+  const units = data.ams ? data.ams.units : [];
+  units.forEach(unit => {
+    const row = document.createElement('div');
+    row.className = 'ams-unit';
+    const label = document.createElement('span');
+    label.className = 'ams-label';
+    label.textContent = 'AMS ' + String.fromCharCode(65 + unit.id) +
+      (unit.humidity !== undefined ? ' (humidity ' + unit.humidity + '/5)' : '');
+    row.appendChild(label);
+    unit.trays.forEach((tray, i) => {
+      const slot = document.createElement('span');
+      slot.className = 'ams-tray';
+      if (tray) {
+        slot.style.backgroundColor = '#' + tray.color;
+        slot.title = tray.type + (tray.remain !== undefined ? ', ' + tray.remain + ' % left' : '');
+        slot.textContent = tray.type;
+      } else {
+        slot.classList.add('empty');
+        slot.title = 'Empty';
+      }
+      if (data.ams.tray_now === unit.id * 4 + i) slot.classList.add('active');
+      row.appendChild(slot);
+    });
+    container.appendChild(row);
+  });
+  div.style.display = units.length ? '' : 'none';
+}
+
+// Full status, including the HMS and AMS lists binary frames leave out
+function fetchStatusJson() {
+  fetch('/status.json').then(r => r.json()).then(updateUI).catch(() => {});
+}
+
+function updateUI(data) {
+  if (data.error) { // The device could not fit the status, e.g. "truncated"
+    console.warn('Status unavailable: ' + data.error);
+    return;
+  }
+  try {
+    if (data.hms !== undefined) detailsVersion = data.details_version;
+    updateDeviceInfo(data);
+
+    document.getElementById('mqtt-status').innerText = data.mqtt_connected ? 'CONNECTED' : 'DISCONNECTED';
+    document.getElementById('mqtt-status-div').className = 'status ' + (data.mqtt_connected ? 'connected' : 'disconnected');
+    
+    document.getElementById('gcode-state').innerText = data.gcode_state + (data.state_stale ? ' (last known)' : '');
+    document.getElementById('print-percent').innerText = data.print_percentage + ' %';
+    document.getElementById('layer-num').innerText = data.layer_num;
+    document.getElementById('stage').innerText = data.stage;
+    document.getElementById('print-time').innerText = formatTime(data.time_remaining);
+    document.getElementById('nozzle-temp').innerHTML = data.nozzle_temp.toFixed(1) + ' / ' + data.nozzle_target_temp.toFixed(1) + ' &deg;C';
+    document.getElementById('bed-temp').innerHTML = data.bed_temp.toFixed(1) + ' / ' + data.bed_target_temp.toFixed(1) + ' &deg;C';
+    document.getElementById('wifi-signal').innerText = data.wifi_signal;
+    updateHms(data);
+    updateAms(data);
+    
+    document.getElementById('light-status').innerText = data.light_is_on ? ('ON (' + data.chamber_bright + '%)') : 'OFF';
+    document.getElementById('light-status-div').className = 'status ' + (data.light_is_on ? 'light-on' : 'disconnected');
+    document.getElementById('light-mode').innerText = data.manual_control ? 'MANUAL' : ('AUTO' + data.light_mode_extra);
+    document.getElementById('bambu-light-mode').innerText = data.bambu_light_mode;
+    
+    document.getElementById('led-status').innerText = data.led_status_str;
+    document.getElementById('led-status-div').className = 'status ' + data.led_status_class;
+
+    let color = data.led_color_val.toString(16).padStart(6, '0');
+    let brightness = data.led_bright_val;
+    let opacity = (brightness / 255).toFixed(2);
+    let vleds = document.querySelectorAll('#virtual-bar .vled');
+    let numLeds = vleds.length;
+    
+    if (data.is_printing && data.print_percentage > 0 && numLeds > 0) {
+      let leds_to_light = Math.ceil((data.print_percentage / 100) * numLeds);
+      for (let i = 0; i < numLeds; i++) {
+        if (i < leds_to_light) {
+          vleds[i].style.backgroundColor = '#' + color;
+          vleds[i].style.opacity = opacity;
+        } else {
+          vleds[i].style.backgroundColor = '#000';
+          vleds[i].style.opacity = '1.0';
+        }
+      }
+    } else {
+      vleds.forEach(led => {
+        led.style.backgroundColor = '#' + color;
+        led.style.opacity = opacity;
+      });
+    }
+  } catch (e) {
+    console.error('Error updating UI:', e);
+  }
+}
+
+function connectWebSocket() {
+  console.log('Connecting WebSocket...');
+  let opened = false;
+  ws = new WebSocket('ws://' + window.location.hostname + ':81/');
+  ws.binaryType = 'arraybuffer';
+
+  ws.onopen = function() {
+    opened = true;
+    console.log('WebSocket connected.');
+    // Ask for compact binary frames; the first frame may still arrive as JSON
+    ws.send('PROTO:BIN');
+  };
+
+  ws.onmessage = function(evt) {
+    // New message from server!
+    let data;
+    if (evt.data instanceof ArrayBuffer) {
+      data = decodeStatusFrame(evt.data);
+      if (!data) {
+        // Unknown frame layout (e.g. after a firmware update): fall back to JSON
+        ws.send('PROTO:JSON');
+        return;
+      }
+      if (data.details_version !== detailsVersion) {
+        detailsVersion = data.details_version; // One fetch per change
+        fetchStatusJson();
+      }
+    } else {
+      data = JSON.parse(evt.data);
+    }
+    updateUI(data); // Update the page
+  };
+
+  ws.onclose = function() {
+    ws = null;
+    if (!opened) {
+      // Port 81 unreachable (proxy) or WebSocket server not built in
+      connectEventSource();
+      return;
+    }
+    console.log('WebSocket disconnected. Reconnecting in 3s...');
+    // Try to reconnect every 3 seconds
+    setTimeout(connectWebSocket, 3000);
+  };
+
+  ws.onerror = function(err) {
+    console.error('WebSocket Error:', err);
+    ws.close();
+  };
+}
+
+function connectEventSource() {
+  console.log('Using Server-Sent Events on /events.');
+  // EventSource reconnects on its own and resumes with Last-Event-ID
+  const es = new EventSource('/events');
+  es.onmessage = function(evt) {
+    updateUI(JSON.parse(evt.data));
+  };
+}
+
+// --- Temperature history chart ---
+let historyRange = 600;
+
+function historySeries(data, channel) {
+  // Returns [{t, avg, min, max}] with t in seconds before now
+  const idx = data.channels.indexOf(channel);
+  const scale = data.scale[idx];
+  const width = data.fields === 'avg' ? 1 : 3;
+  const n = data.rows.length;
+  return data.rows.map((row, i) => {
+    const avg = row[idx * width];
+    const min = width === 3 ? row[idx * width + 1] : avg;
+    const max = width === 3 ? row[idx * width + 2] : avg;
+    return {
+      t: data.end_age + (n - 1 - i) * data.step,
+      avg: avg === null ? null : avg / scale,
+      min: min === null ? null : min / scale,
+      max: max === null ? null : max / scale
+    };
+  });
+}
+
+function drawHistory(data) {
+  const canvas = document.getElementById('history-chart');
+  const ctx = canvas.getContext('2d');
+  const w = canvas.width = canvas.clientWidth;
+  const h = canvas.height;
+  const pad = 30;
+  ctx.clearRect(0, 0, w, h);
+
+  const series = [
+    { pts: historySeries(data, 'nozzle'), target: historySeries(data, 'nozzle_target'), color: '#ff8c42' },
+    { pts: historySeries(data, 'bed'), target: historySeries(data, 'bed_target'), color: '#378cf0' }
+  ];
+  let maxT = 50;
+  series.forEach(s => s.pts.concat(s.target).forEach(p => { if (p.max !== null) maxT = Math.max(maxT, p.max); }));
+  maxT = Math.ceil(maxT / 50) * 50;
+
+  const x = t => w - (t / historyRange) * (w - pad);
+  const y = v => h - pad / 2 - (v / maxT) * (h - pad);
+
+  ctx.strokeStyle = '#444';
+  ctx.fillStyle = '#aaa';
+  ctx.font = '10px sans-serif';
+  for (let v = 0; v <= maxT; v += 50) {
+    ctx.beginPath();
+    ctx.moveTo(pad, y(v));
+    ctx.lineTo(w, y(v));
+    ctx.stroke();
+    ctx.fillText(v, 2, y(v) + 3);
+  }
+
+  series.forEach(s => {
+    // Min/max band (coarser tiers only)
+    if (data.fields !== 'avg') {
+      ctx.fillStyle = s.color + '33';
+      s.pts.forEach(p => {
+        if (p.min === null) return;
+        ctx.fillRect(x(p.t), y(p.max), Math.max(1, (w - pad) * data.step / historyRange), y(p.min) - y(p.max) || 1);
+      });
+    }
+    [[s.pts, []], [s.target, [4, 4]]].forEach(([pts, dash]) => {
+      ctx.strokeStyle = s.color;
+      ctx.setLineDash(dash);
+      ctx.beginPath();
+      let pen = false;
+      pts.forEach(p => {
+        if (p.avg === null) { pen = false; return; }
+        if (pen) ctx.lineTo(x(p.t), y(p.avg));
+        else ctx.moveTo(x(p.t), y(p.avg));
+        pen = true;
+      });
+      ctx.stroke();
+    });
+    ctx.setLineDash([]);
+  });
+}
+
+function loadHistory() {
+  fetch('/history.json?range=' + historyRange)
+    .then(r => r.ok ? r.json() : null)
+    .then(data => { if (data) drawHistory(data); })
+    .catch(() => {});
+}
+
+function sendLightCommand(command, path) {
+  if (ws && ws.readyState === WebSocket.OPEN) {
+    ws.send(command);
+  } else {
+    // The status stream picks up the change; don't follow the redirect to /
+    fetch(path, { redirect: 'manual' });
+  }
+}
+
+document.addEventListener('DOMContentLoaded', () => {
+  // Binary frames leave out the network details, so fetch them once
+  fetchStatusJson();
+  connectWebSocket();
+
+  loadHistory();
+  setInterval(() => { if (!document.hidden) loadHistory(); }, 10000);
+  document.querySelectorAll('.chart-ranges .range').forEach(btn => {
+    btn.addEventListener('click', () => {
+      document.querySelectorAll('.chart-ranges .range').forEach(b => b.classList.remove('active'));
+      btn.classList.add('active');
+      historyRange = parseInt(btn.dataset.range);
+      loadHistory();
+    });
+  });
+  
+  // Light control goes over the WebSocket when there is one
+  document.getElementById('btn-light-on').addEventListener('click', () => {
+    sendLightCommand('LIGHT_ON', '/light/on');
+  });
+  document.getElementById('btn-light-off').addEventListener('click', () => {
+    sendLightCommand('LIGHT_OFF', '/light/off');
+  });
+  document.getElementById('btn-light-auto').addEventListener('click', () => {
+    sendLightCommand('LIGHT_AUTO', '/light/auto');
+  });
+});